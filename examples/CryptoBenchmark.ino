@@ -0,0 +1,99 @@
+#include <Arduino.h>
+#include <crypto/ecc.h>
+#include <crypto/ecdsa.h>
+#include <crypto/nn_radix29.h>
+#include <crypto/sha256.h>
+#include <crypto/sha256_hw.h>
+
+// Cycle counts of the P-256 field products and of the key, sign and verify
+// operations built on them. Build once as is and once with NN_RADIX29 defined
+// for the library (build_flags = -DNN_RADIX29 with PlatformIO) to compare the
+// saturated and the unsaturated field products. SHA-256 is checked against
+// known answers, then timed on 1 KiB messages, through whichever transform
+// backend the chip selected: build with SHA256_HW_ESP32 defined to check the
+// SHA peripheral of the chip before turning it on.
+
+const int RUNS = 5;
+
+uint32_t best;
+
+BYTE message[1024];
+BYTE digest[SHA256_DIGEST_LENGTH];
+
+void hash_message() {
+    Sha256 sha;
+    sha.update(message, sizeof(message));
+    sha.final(digest);
+    message[0] ^= digest[0];
+}
+
+// FIPS 180-2 examples: one block, and two blocks with the length in the second
+const char *const kat_messages[2] = {
+    "abc",
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+};
+const BYTE kat_digests[2][SHA256_DIGEST_LENGTH] = {
+    {0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+     0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad},
+    {0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+     0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67, 0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1},
+};
+
+bool sha256_known_answers() {
+    BYTE out[SHA256_DIGEST_LENGTH];
+    for (int i = 0; i < 2; i++) {
+        Sha256::hash((const BYTE *)kat_messages[i], strlen(kat_messages[i]), out);
+        if (memcmp(out, kat_digests[i], sizeof(out)) != 0) return false;
+    }
+    return true;
+}
+
+#define CYCLES(label, N, expr)                                   \
+    best = UINT32_MAX;                                           \
+    for (int run = 0; run < RUNS; run++) {                       \
+        uint32_t start = ESP.getCycleCount();                    \
+        for (int i = 0; i < N; i++) {                            \
+            expr;                                                \
+        }                                                        \
+        uint32_t cycles = (ESP.getCycleCount() - start) / N;     \
+        if (cycles < best) best = cycles;                        \
+    }                                                            \
+    Serial.printf("%-8s %10u cycles\n", label, best);
+
+void setup() {
+    Serial.begin(115200);
+    delay(10);
+
+    ecc_init();
+
+    NN_DIGIT a[NUMWORDS], b[NUMWORDS], c[NUMWORDS];
+    ecc_gen_private_key(b);
+    ecc_gen_private_key(c);
+
+#ifdef NN_RADIX29_KERNELS
+    Serial.println("field products: radix 2^29");
+#else
+    Serial.println("field products: saturated");
+#endif
+
+    // each result feeds the next call so nothing is hoisted out of the loop
+    CYCLES("mult", 1000, (NN_ModMultP256(a, b, c, NUMWORDS), b[0] ^= a[1]));
+    CYCLES("sqr", 1000, (NN_ModSqrP256(a, b, NUMWORDS), b[0] ^= a[1]));
+
+    point_t pub;
+    NN_DIGIT r[NUMWORDS], s[NUMWORDS];
+    uint8_t sha256[SHA256_DIGEST_LENGTH] = {1};
+    CYCLES("pubkey", 1, ecc_gen_pub_key(b, &pub));
+    ecdsa_init(&pub);
+    CYCLES("sign", 1, ecdsa_sign(sha256, r, s, b));
+    CYCLES("verify", 1, ecdsa_verify(sha256, r, s, &pub));
+
+    Serial.printf("sha256 backend: %s\n", sha256_backend_name());
+    Serial.printf("sha256 known answers: %s\n", sha256_known_answers() ? "pass" : "FAIL");
+    CYCLES("sha256", 10, hash_message());
+    Serial.printf("%-8s %10.3f bytes/cycle\n", "", (float)sizeof(message) / best);
+}
+
+void loop() {
+    delay(1000);
+}
@@ -50,14 +50,14 @@ int CloudIoTCoreDevice::getJwtExpSecs() {
 
 String CloudIoTCoreDevice::createJWT(long long int current_time) {
   exp_millis = millis() + (jwt_exp_secs * 1000);
-  jwt = CreateJwt(project_id, current_time, priv_key, this->jwt_exp_secs);
+  jwt = CreateJwt(project_id, current_time, &sign_ctx, this->jwt_exp_secs);
   return jwt;
 }
 
 String CloudIoTCoreDevice::createJWT(long long int current_time, int exp_in_secs) {
   jwt_exp_secs = exp_in_secs;
   exp_millis = millis() + (jwt_exp_secs * 1000);
-  jwt = CreateJwt(project_id, current_time, priv_key, exp_in_secs);
+  jwt = CreateJwt(project_id, current_time, &sign_ctx, exp_in_secs);
   return jwt;
 }
 
@@ -114,14 +114,14 @@ String CloudIoTCoreDevice::getSetStatePath() {
 }
 
 void CloudIoTCoreDevice::fillPrivateKey() {
-  priv_key[8] = 0;
-  for (int i = 7; i >= 0; i--) {
-    priv_key[i] = 0;
-    for (int byte_num = 0; byte_num < 4; byte_num++) {
+  NN_AssignZero(priv_key, NUMWORDS);
+  for (int i = KEYDIGITS - 1; i >= 0; i--) {
+    for (int byte_num = 0; byte_num < NN_DIGIT_LEN; byte_num++) {
       priv_key[i] = (priv_key[i] << 8) + strtoul(private_key, NULL, 16);
       private_key += 3;
     }
   }
+  ecdsa_sign_ctx_init(&sign_ctx, priv_key);
 }
 
 void CloudIoTCoreDevice::setJwtExpSecs(int exp_in_secs) {
@@ -27,7 +27,8 @@ class CloudIoTCoreDevice {
   const char *device_id;
   const char *private_key;
 
-  NN_DIGIT priv_key[9];
+  NN_DIGIT priv_key[NUMWORDS];
+  ecdsa_sign_ctx_t sign_ctx;
   String jwt;
   int jwt_exp_secs;
   unsigned long exp_millis = 0;
@@ -149,7 +149,12 @@ void vTaskLoop( void * pvParameters )
           iotHandler->lastReconnect = millis();
         }
       }
-      else iotHandler->connectionBackoffTime = MIN_BACKOFF;
+      else {
+        iotHandler->connectionBackoffTime = MIN_BACKOFF;
+#if ECDSA_NONCE_POOL > 0
+        if (iotHandler->fillNoncePool) ecdsa_nonce_pool_step();
+#endif
+      }
     }
     vTaskDelay(pdMS_TO_TICKS(50));
 }
@@ -166,7 +171,12 @@ void GCloudHandler::loop() {
             lastReconnect = millis();
         }
     }
-    else connectionBackoffTime = MIN_BACKOFF;
+    else {
+        connectionBackoffTime = MIN_BACKOFF;
+#if ECDSA_NONCE_POOL > 0
+        if (fillNoncePool) ecdsa_nonce_pool_step();
+#endif
+    }
 }
 #endif /*GCLOUD_USE_FREERTOS*/
 
@@ -177,6 +187,11 @@ void GCloudHandler::setup() {
       IOT_PROJECT_ID.c_str(), IOT_LOCATION.c_str(), IOT_REGISTRY_ID.c_str(), IOT_DEVICE_ID.c_str(),
       IOT_PRIVATE_KEY[0].c_str());	  
     Serial.print("GCloudHandler device created: "); Serial.println(iotDevice->getDeviceId());
+#if ECDSA_NONCE_POOL > 0
+    // Nonces do not depend on the key, the pool keeps running across setup() calls.
+    // Without a background task (targets other than ESP32) loop() fills it
+    fillNoncePool = ecdsa_nonce_pool_start() == 0;
+#endif
     netClient = new WiFiClientSecure();
     Serial.println("GCloudHandler netClient created");
     iotMqttClient = new MQTTClient(512);
@@ -14,6 +14,9 @@ Released into the public domain.
 // Defince this if FreeRTOS used in your project. This will run a handler thread.
 // If not defined then ::loop() function should be called in cycle
 // #define GCLOUD_USE_FREERTOS
+// Build with ECDSA_NONCE_POOL defined (e.g. -DECDSA_NONCE_POOL=4) to prepare JWT signing
+// nonces ahead, reconnect() then signs without a point multiplication. ESP32 fills the
+// pool in a background task, other targets from loop() while connected, a few nonces per call
 // Define this if debug output required to Serial
 // #define __DEBUG
 
@@ -74,6 +77,9 @@ public:
     MQTTClient *iotMqttClient;
     long lastReconnect = 0;
     unsigned long connectionBackoffTime = MIN_BACKOFF;
+    // No background task keeps the nonce pool full, the loop refills it. Declared
+    // whatever ECDSA_NONCE_POOL is, so that the class is the same in every unit
+    bool fillNoncePool = false;
 
 public:
     // Setup internal components and start inner RTOS task or prepare to loop() calls.
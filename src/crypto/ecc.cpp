@@ -13,7 +13,20 @@
  *
  */
 #include "ecc.h"
+#include "nn_fixed.h"
+#include "nn_host.h"
 #include "prng.h"
+#if defined(ESP32) || !defined(ARDUINO)
+#include <pthread.h>
+/* threads may call ecc_init together, the context is built under a once guard */
+#define ECC_INIT_ONCE
+#endif
+#if ECC_COMB
+#include "secp256r1_comb.h"
+#if ECC_COMB_TABLE_TEETH != ECC_COMB_TEETH || ECC_COMB_TABLE_BLOCKS != ECC_COMB_BLOCKS
+#error "secp256r1_comb.h does not match ECC_COMB_TEETH/ECC_COMB_BLOCKS, run tools/gen_comb_table.py"
+#endif
+#endif
 
 #define TRUE  1
 #define FALSE 0
@@ -28,17 +41,16 @@
 #define REPEAT_DOUBLE
 
 /*
- * parameters for ECC operations
- */
-static curve_params_t param;
-/*
- * precomputed array for base point
+ * the curve context, written by ecc_init only
  */
-static point_t pBaseArray[NUM_POINTS];
+static ecc_ctx_t curve;
 /*
- * masks for sliding window method
+ * set once curve holds the curve context
  */
-static NN_DIGIT mask[NUM_MASKS];
+static volatile char initialized = FALSE;
+#ifdef ECC_INIT_ONCE
+static pthread_once_t init_once = PTHREAD_ONCE_INIT;
+#endif
 
 
 /**
@@ -51,6 +63,93 @@ b_testbit(NN_DIGIT * a, int16_t i)
   return (*(a + (i / NN_DIGIT_BITS)) & ((NN_DIGIT)1 << (i % NN_DIGIT_BITS)));
 }
 /*---------------------------------------------------------------------------*/
+/*
+ * Field arithmetic modulo param.p, on the fixed-width primitives of
+ * nn_fixed.h. Operands are NUMWORDS long and reduced, the digits above
+ * KEYDIGITS are kept zero.
+ */
+static inline void
+fp_add(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c)
+{
+  NN_ModAddFixed<KEYDIGITS>(a, b, c, curve.param.p);
+  NN_AssignZero(a + KEYDIGITS, NUMWORDS - KEYDIGITS);
+}
+
+static inline void
+fp_sub(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c)
+{
+  NN_ModSubFixed<KEYDIGITS>(a, b, c, curve.param.p);
+  NN_AssignZero(a + KEYDIGITS, NUMWORDS - KEYDIGITS);
+}
+
+/* a = 2 * b */
+static inline void
+fp_dbl(NN_DIGIT * a, NN_DIGIT * b)
+{
+  fp_add(a, b, b);
+}
+
+/* a = b / 2 */
+static inline void
+fp_half(NN_DIGIT * a, NN_DIGIT * b)
+{
+  NN_ModHalfFixed<KEYDIGITS>(a, b, curve.param.p);
+  NN_AssignZero(a + KEYDIGITS, NUMWORDS - KEYDIGITS);
+}
+
+/*
+ * Lazily reduced results, below 2^(KEYDIGITS*NN_DIGIT_BITS) but not
+ * always below p (omega = 2^(KEYDIGITS*NN_DIGIT_BITS) - p). fp_mul and
+ * fp_sqr take them as either operand; fp_sub, fp_add_lazy and fp_mulk*
+ * only as b, and fp_sub of a lazy b is lazy itself. Every other operand,
+ * and every coordinate stored in a point, is reduced.
+ */
+
+/* a = b + c, c reduced */
+static inline void
+fp_add_lazy(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c)
+{
+  NN_ModAddLazyFixed<KEYDIGITS>(a, b, c, curve.param.omega);
+  NN_AssignZero(a + KEYDIGITS, NUMWORDS - KEYDIGITS);
+}
+
+/* a = k * b, 2 <= k <= 8 */
+static inline void
+fp_mulk_lazy(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT k)
+{
+  NN_ModMultSmallLazyFixed<KEYDIGITS>(a, b, k, curve.param.omega);
+  NN_AssignZero(a + KEYDIGITS, NUMWORDS - KEYDIGITS);
+}
+
+/* a = k * b reduced, 2 <= k <= 8 */
+static inline void
+fp_mulk(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT k)
+{
+  NN_ModMultSmallLazyFixed<KEYDIGITS>(a, b, k, curve.param.omega);
+  NN_ModReduceLazyFixed<KEYDIGITS>(a, a, curve.param.p);
+  NN_AssignZero(a + KEYDIGITS, NUMWORDS - KEYDIGITS);
+}
+
+static inline void
+fp_mul(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c)
+{
+#ifdef NN_HAVE_P256_REDUCTION
+  NN_ModMultP256(a, b, c, NUMWORDS);
+#else
+  NN_ModMultOpt(a, b, c, curve.param.p, curve.param.omega, NUMWORDS);
+#endif
+}
+
+static inline void
+fp_sqr(NN_DIGIT * a, NN_DIGIT * b)
+{
+#ifdef NN_HAVE_P256_REDUCTION
+  NN_ModSqrP256(a, b, NUMWORDS);
+#else
+  NN_ModSqrOpt(a, b, curve.param.p, curve.param.omega, NUMWORDS);
+#endif
+}
+/*---------------------------------------------------------------------------*/
 /**
  * \brief             Set P0's x and y to zero
  */
@@ -87,6 +186,7 @@ p_iszero(point_t * P0)
   return result;
 }
 /*---------------------------------------------------------------------------*/
+#if !ECC_COMPLETE
 /**
  * \brief             Test whether points P1 and P2 are equal
  */
@@ -100,6 +200,7 @@ p_equal(point_t * P1, point_t * P2)
   }
   return FALSE;
 }
+#endif
 /*---------------------------------------------------------------------------*/
 /**
  * \brief             Test whether Z is one
@@ -121,7 +222,49 @@ Z_is_one(NN_DIGIT *Z)
   return FALSE;
 }
 /*---------------------------------------------------------------------------*/
+/**
+ * \brief             (P0,Z0) = the point at infinity
+ */
+static void
+p_set_infinity(point_t * P0, NN_DIGIT * Z0)
+{
+  p_clear(P0);
+  NN_AssignZero(Z0, NUMWORDS);
+#if ECC_COMPLETE
+  /* (0:1:0), the complete formulas take no (0:0:0) */
+  P0->y[0] = 1;
+#endif
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Converts (P0,Z0) back to affine coordinate, the point at
+ *                    infinity becomes (0, 0). Z0 is destroyed.
+ */
+static void
+p_to_affine(point_t * P0, NN_DIGIT * Z0)
+{
+  NN_DIGIT Z1[NUMWORDS];
+
+  if(Z_is_one(Z0)) {
+    return;
+  }
+
+  ecc_field_inv(Z1, Z0);
+#if ECC_COMPLETE
+  /* x = X/Z, y = Y/Z */
+  fp_mul(P0->x, P0->x, Z1);
+  fp_mul(P0->y, P0->y, Z1);
+#else
+  /* x = X/Z^2, y = Y/Z^3 */
+  fp_mul(Z0, Z1, Z1);
+  fp_mul(P0->x, P0->x, Z0);
+  fp_mul(Z0, Z0, Z1);
+  fp_mul(P0->y, P0->y, Z0);
+#endif
+}
+/*---------------------------------------------------------------------------*/
 
+#if !ECC_COMPLETE
 static void
 c_add_mix(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t * P2)
 {
@@ -148,17 +291,17 @@ c_add_mix(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t * P2)
   }
 
   /* T1 = Z1^2 */
-  NN_ModSqrOpt(t1, Z1, param.p, param.omega, NUMWORDS);
+  fp_sqr(t1, Z1);
   /* T2 = T1*Z1 */
-  NN_ModMultOpt(t2, t1, Z1, param.p, param.omega, NUMWORDS);
+  fp_mul(t2, t1, Z1);
   /* T1 = T1*P2->x */
-  NN_ModMultOpt(t1, t1, P2->x, param.p, param.omega, NUMWORDS);
+  fp_mul(t1, t1, P2->x);
   /* T2 = T2*P2->y */
-  NN_ModMultOpt(t2, t2, P2->y, param.p, param.omega, NUMWORDS);
+  fp_mul(t2, t2, P2->y);
   /* T1 = T1-P1->x */
-  NN_ModSub(t1, t1, P1->x, param.p, NUMWORDS);
+  fp_sub(t1, t1, P1->x);
   /* T2 = T2-P1->y */
-  NN_ModSub(t2, t2, P1->y, param.p, NUMWORDS);
+  fp_sub(t2, t2, P1->y);
 
   if(NN_Zero(t1, NUMWORDS)) {
     if(NN_Zero(t2, NUMWORDS)) {
@@ -171,56 +314,189 @@ c_add_mix(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t * P2)
     }
   }
   /* Z3 = Z1*T1 */
-  NN_ModMultOpt(Z0, Z1, t1, param.p, param.omega, NUMWORDS);
+  fp_mul(Z0, Z1, t1);
   /* T3 = T1^2 */
-  NN_ModSqrOpt(t3, t1, param.p, param.omega, NUMWORDS);
+  fp_sqr(t3, t1);
   /* T4 = T3*T1 */
-  NN_ModMultOpt(t4, t3, t1, param.p, param.omega, NUMWORDS);
+  fp_mul(t4, t3, t1);
   /* T3 = T3*P1->x */
-  NN_ModMultOpt(t3, t3, P1->x, param.p, param.omega, NUMWORDS);
+  fp_mul(t3, t3, P1->x);
   /* T1 = 2*T3 */
-  NN_LShift(t1, t3, 1, NUMWORDS);
-  NN_ModSmall(t1, param.p, NUMWORDS);
+  fp_dbl(t1, t3);
   /* P0->x = T2^2 */
-  NN_ModSqrOpt(P0->x, t2, param.p, param.omega, NUMWORDS);
+  fp_sqr(P0->x, t2);
   /* P0->x = P0->x-T1 */
-  NN_ModSub(P0->x, P0->x, t1, param.p, NUMWORDS);
+  fp_sub(P0->x, P0->x, t1);
   /* P0->x = P0->x-T4 */
-  NN_ModSub(P0->x, P0->x, t4, param.p, NUMWORDS);
+  fp_sub(P0->x, P0->x, t4);
   /* T3 = T3-P0->x */
-  NN_ModSub(t3, t3, P0->x, param.p, NUMWORDS);
+  fp_sub(t3, t3, P0->x);
   /* T3 = T3*T2 */
-  NN_ModMultOpt(t3, t3, t2, param.p, param.omega, NUMWORDS);
+  fp_mul(t3, t3, t2);
   /* T4 = T4*P1->y */
-  NN_ModMultOpt(t4, t4, P1->y, param.p, param.omega, NUMWORDS);
+  fp_mul(t4, t4, P1->y);
   /* P0->y = T3-T4 */
-  NN_ModSub(P0->y, t3, t4, param.p, NUMWORDS);
+  fp_sub(P0->y, t3, t4);
 
   return;
 }
+#else
+/*
+ * (P0,Z0) = (P1,Z1) + P2, P2 affine and not the point at infinity,
+ * Algorithm 5 of Renes, Costello, Batina, 11M + 2m_b + 23a
+ */
+static void
+c_add_mix(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t * P2)
+{
+  NN_DIGIT t0[NUMWORDS];
+  NN_DIGIT t1[NUMWORDS];
+  NN_DIGIT t2[NUMWORDS];
+  NN_DIGIT t3[NUMWORDS];
+  NN_DIGIT t4[NUMWORDS];
+  NN_DIGIT X3[NUMWORDS];
+  NN_DIGIT Y3[NUMWORDS];
+  NN_DIGIT Z3[NUMWORDS];
+
+  /* the sums that are only multiplied stay lazy */
+  fp_mul(t0, P1->x, P2->x);
+  fp_mul(t1, P1->y, P2->y);
+  fp_add_lazy(t3, P2->x, P2->y);
+  fp_add_lazy(t4, P1->x, P1->y);
+  fp_mul(t3, t3, t4);
+  fp_add(t4, t0, t1);
+  fp_sub(t3, t3, t4);
+  fp_mul(t4, P2->y, Z1);
+  fp_add_lazy(t4, t4, P1->y);
+  fp_mul(Y3, P2->x, Z1);
+  fp_add_lazy(Y3, Y3, P1->x);
+  fp_mul(Z3, curve.param.E.b, Z1);
+  fp_sub(X3, Y3, Z3);
+  fp_mulk(X3, X3, 3);
+  fp_sub(Z3, t1, X3);
+  fp_add_lazy(X3, t1, X3);
+  fp_mul(Y3, curve.param.E.b, Y3);
+  fp_mulk(t2, Z1, 3);
+  fp_sub(Y3, Y3, t2);
+  fp_sub(Y3, Y3, t0);
+  fp_mulk_lazy(Y3, Y3, 3);
+  fp_mulk_lazy(t0, t0, 3);
+  fp_sub(t0, t0, t2);
+  fp_mul(t1, t4, Y3);
+  fp_mul(t2, t0, Y3);
+  fp_mul(Y3, X3, Z3);
+  fp_add(Y3, Y3, t2);
+  fp_mul(X3, t3, X3);
+  fp_sub(P0->x, X3, t1);
+  fp_mul(Z3, t4, Z3);
+  fp_mul(t1, t3, t0);
+  fp_add(Z0, Z3, t1);
+  NN_Assign(P0->y, Y3, NUMWORDS);
+}
+#endif /* ECC_COMPLETE */
 
 /*---------------------------------------------------------------------------*/
-void
-ecc_init()
+#ifdef ECC_COMB_X4
+static void ecc_comb_x4_build(void);
+#endif
+
+/**
+ * \brief             Builds the curve context, run once by ecc_init.
+ */
+static void
+ecc_build_ctx(void)
 {
+#if !ECC_WNAF
+ uint8_t i;
+#endif
+
  /* get parameters */
- get_curve_param(&param);
+ get_curve_param(&curve.param);
+
+#if !ECC_WNAF
+ for(i = 0; i < NUM_MASKS; i++) {
+   curve.mask[i] = (NN_DIGIT)BASIC_MASK << (W_BITS*i);
+ }
+#endif
 
+#if !ECC_COMB
  /* precompute array for base point */
- ecc_win_precompute(&(param.G), pBaseArray);
+ ecc_win_precompute(&(curve.param.G), curve.pBaseArray);
+#endif
 
+#ifdef NN_HOST_KERNELS
+ /* pick the field kernels now, before threads can race on the choice */
+ NN_HostKernelName();
+#endif
+
+#ifdef ECC_COMB_X4
+ if(NN_X4Available()) {
+   ecc_comb_x4_build();
+ }
+#endif
+
+ initialized = TRUE;
+}
+/*---------------------------------------------------------------------------*/
+void
+ecc_init()
+{
+ /* the curve context never changes, build it only once */
+#ifdef ECC_INIT_ONCE
+ pthread_once(&init_once, ecc_build_ctx);
+#else
+ if(!initialized) {
+   ecc_build_ctx();
+ }
+#endif
+}
+/*---------------------------------------------------------------------------*/
+const ecc_ctx_t *
+ecc_get_ctx()
+{
+  ecc_init();
+  return &curve;
+}
+/*---------------------------------------------------------------------------*/
+int
+ecc_is_initialized()
+{
+  return initialized;
 }
 /*---------------------------------------------------------------------------*/
-curve_params_t *
+const curve_params_t *
 ecc_get_param()
 {
-	return &param;
+	return &curve.param;
 }
 /*---------------------------------------------------------------------------*/
 void
 ecc_get_order(NN_DIGIT * order)
 {
-  NN_Assign(order, param.r, NUMWORDS);
+  NN_Assign(order, curve.param.r, NUMWORDS);
+}
+/*---------------------------------------------------------------------------*/
+void
+ecc_field_inv(NN_DIGIT *a, NN_DIGIT *b)
+{
+#if ECC_FIELD_INV == ECC_INV_SAFEGCD
+  NN_ModInvSafegcd(a, b, curve.param.p, NUMWORDS);
+#elif ECC_FIELD_INV == ECC_INV_FERMAT
+  NN_ModInvOpt(a, b, curve.param.p, curve.param.omega, NUMWORDS);
+#else
+  NN_ModInv(a, b, curve.param.p, NUMWORDS);
+#endif
+}
+/*---------------------------------------------------------------------------*/
+void
+ecc_order_inv(NN_DIGIT *a, NN_DIGIT *b)
+{
+#if ECC_ORDER_INV == ECC_INV_SAFEGCD
+  NN_ModInvSafegcd(a, b, curve.param.r, NUMWORDS);
+#elif ECC_ORDER_INV == ECC_INV_EUCLID
+  NN_ModInv(a, b, curve.param.r, NUMWORDS);
+#else
+#error "ECC_ORDER_INV: no Fermat chain for the group order"
+#endif
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -229,6 +505,23 @@ ecc_add(point_t * P0, point_t * P1, point_t * P2)
   NN_DIGIT Z0[NUMWORDS];
   NN_DIGIT Z1[NUMWORDS];
   NN_DIGIT Z2[NUMWORDS];
+#if ECC_COMPLETE
+  point_t Q1, Q2;
+
+  /* (x, y) = (x:y:1), the affine (0, 0) is the point at infinity */
+  p_copy(&Q1, P1);
+  p_copy(&Q2, P2);
+  NN_AssignDigit(Z1, 1, NUMWORDS);
+  NN_AssignDigit(Z2, 1, NUMWORDS);
+  if(p_iszero(&Q1)) {
+    p_set_infinity(&Q1, Z1);
+  }
+  if(p_iszero(&Q2)) {
+    p_set_infinity(&Q2, Z2);
+  }
+
+  ecc_add_proj(P0, Z0, &Q1, Z1, &Q2, Z2);
+#else
 
   p_clear(P0);
   NN_AssignZero(Z0, NUMWORDS);
@@ -242,17 +535,12 @@ ecc_add(point_t * P0, point_t * P1, point_t * P2)
 #else
     ecc_add_proj(P0, Z0, P1, Z1, P2, Z2);
 #endif
+#endif /* ECC_COMPLETE */
 
-  if(!Z_is_one(Z0)) {
-    NN_ModInv(Z1, Z0, param.p, NUMWORDS);
-    NN_ModMultOpt(Z0, Z1, Z1, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(P0->x, P0->x, Z0, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(Z0, Z0, Z1, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(P0->y, P0->y, Z0, param.p, param.omega, NUMWORDS);
-  }
-
+  p_to_affine(P0, Z0);
 }
 /*---------------------------------------------------------------------------*/
+#if !ECC_COMPLETE
 void
 ecc_dbl_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1)
 {
@@ -266,43 +554,35 @@ ecc_dbl_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1)
     return;
   }
 
-  // n1
+  // n1, lazy: it only feeds multiplications
   if(Z_is_one(Z1)) {
     /* n1 = 3 * P1->x^2 + param.E.a */
-    NN_ModSqrOpt(n0, P1->x, param.p, param.omega, NUMWORDS);
-    NN_LShift(n1, n0, 1, NUMWORDS);
-    NN_ModSmall(n1, param.p, NUMWORDS);
-    NN_ModAdd(n0, n0, n1, param.p, NUMWORDS);
-    NN_ModAdd(n1, n0, param.E.a, param.p, NUMWORDS);
+    fp_sqr(n0, P1->x);
+    fp_mulk_lazy(n0, n0, 3);
+    fp_add_lazy(n1, n0, curve.param.E.a);
   } else {
-    if(param.E.a_minus3) {
+    if(curve.param.E.a_minus3) {
       /* for a = -3
        * n1 = 3 * (X1 + Z1^2) * (X1 - Z1^2) = 3 * X1^2 - 3 * Z1^4
        */
-      NN_ModSqrOpt(n1, Z1, param.p, param.omega, NUMWORDS);
-      NN_ModAdd(n0, P1->x, n1, param.p, NUMWORDS);
-      NN_ModSub(n2, P1->x, n1, param.p, NUMWORDS);
-      NN_ModMultOpt(n1, n0, n2, param.p, param.omega, NUMWORDS);
-      NN_LShift(n0, n1, 1, NUMWORDS);
-      NN_ModSmall(n0, param.p, NUMWORDS);
-      NN_ModAdd(n1, n0, n1, param.p, NUMWORDS);
-
-    } else if (param.E.a_zero) {
+      fp_sqr(n1, Z1);
+      fp_add_lazy(n0, P1->x, n1);
+      fp_sub(n2, P1->x, n1);
+      fp_mul(n1, n0, n2);
+      fp_mulk_lazy(n1, n1, 3);
+
+    } else if (curve.param.E.a_zero) {
       /* n1 = 3 * P1->x^2 */
-      NN_ModSqrOpt(n0, P1->x, param.p, param.omega, NUMWORDS);
-      NN_LShift(n1, n0, 1, NUMWORDS);
-      NN_ModSmall(n1, param.p, NUMWORDS);
-      NN_ModAdd(n1, n0, n1, param.p, NUMWORDS);
+      fp_sqr(n0, P1->x);
+      fp_mulk_lazy(n1, n0, 3);
     } else {
       /* n1 = 3 * P1->x^2 + param.E.a * Z1^4 */
-      NN_ModSqrOpt(n0, P1->x, param.p, param.omega, NUMWORDS);
-      NN_LShift(n1, n0, 1, NUMWORDS);
-      NN_ModSmall(n1, param.p, NUMWORDS);
-      NN_ModAdd(n0, n0, n1, param.p, NUMWORDS);
-      NN_ModSqrOpt(n1, Z1, param.p, param.omega, NUMWORDS);
-      NN_ModSqrOpt(n1, n1, param.p, param.omega, NUMWORDS);
-      NN_ModMultOpt(n1, n1, param.E.a, param.p, param.omega, NUMWORDS);
-      NN_ModAdd(n1, n1, n0, param.p, NUMWORDS);
+      fp_sqr(n0, P1->x);
+      fp_mulk_lazy(n0, n0, 3);
+      fp_sqr(n1, Z1);
+      fp_sqr(n1, n1);
+      fp_mul(n1, n1, curve.param.E.a);
+      fp_add_lazy(n1, n0, n1);
     }
   }
 
@@ -310,35 +590,80 @@ ecc_dbl_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1)
   if(Z_is_one(Z1)) {
     NN_Assign(n0, P1->y, NUMWORDS);
   } else {
-    NN_ModMultOpt(n0, P1->y, Z1, param.p, param.omega, NUMWORDS);
+    fp_mul(n0, P1->y, Z1);
   }
-  NN_LShift(Z0, n0, 1, NUMWORDS);
-  NN_ModSmall(Z0, param.p, NUMWORDS);
+  fp_dbl(Z0, n0);
 
-  /* n2 = 4 * P1->x * P1->y^2 */
-  NN_ModSqrOpt(n3, P1->y, param.p, param.omega, NUMWORDS);
-  NN_ModMultOpt(n2, P1->x, n3, param.p, param.omega, NUMWORDS);
-  NN_LShift(n2, n2, 2, NUMWORDS);
-  NN_ModSmall(n2, param.p, NUMWORDS);
+  /* n2 = 4 * P1->x * P1->y^2, lazy: only ever subtracted from */
+  fp_sqr(n3, P1->y);
+  fp_mul(n0, P1->x, n3);
+  fp_mulk_lazy(n2, n0, 4);
 
   /* P0->x = n1^2 - 2 * n2 */
-  NN_LShift(n0, n2, 1, NUMWORDS);
-  NN_ModSmall(n0, param.p, NUMWORDS);
-  NN_ModSqrOpt(P0->x, n1, param.p, param.omega, NUMWORDS);
-  NN_ModSub(P0->x, P0->x, n0, param.p, NUMWORDS);
+  fp_mulk(n0, n0, 8);
+  fp_sqr(P0->x, n1);
+  fp_sub(P0->x, P0->x, n0);
 
   /* n3 = 8 * P1->y^4 */
-  NN_ModSqrOpt(n0, n3, param.p, param.omega, NUMWORDS);
-  NN_LShift(n3, n0, 3, NUMWORDS);
-  NN_ModSmall(n3, param.p, NUMWORDS);
+  fp_sqr(n0, n3);
+  fp_mulk(n3, n0, 8);
 
   /* P0->y = n1 * (n2 - P0->x) - n3 */
-  NN_ModSub(n0, n2, P0->x, param.p, NUMWORDS);
-  NN_ModMultOpt(n0, n1, n0, param.p, param.omega, NUMWORDS);
-  NN_ModSub(P0->y, n0, n3, param.p, NUMWORDS);
+  fp_sub(n0, n2, P0->x);
+  fp_mul(n0, n1, n0);
+  fp_sub(P0->y, n0, n3);
 
 }
+#else
+/*
+ * Algorithm 6 of Renes, Costello, Batina, 8M + 3S + 2m_b + 21a
+ */
+void
+ecc_dbl_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1)
+{
+  NN_DIGIT t0[NUMWORDS];
+  NN_DIGIT t1[NUMWORDS];
+  NN_DIGIT t2[NUMWORDS];
+  NN_DIGIT t3[NUMWORDS];
+  NN_DIGIT X3[NUMWORDS];
+  NN_DIGIT Y3[NUMWORDS];
+  NN_DIGIT Z3[NUMWORDS];
+
+  /* the sums that are only multiplied stay lazy */
+  fp_sqr(t0, P1->x);
+  fp_sqr(t1, P1->y);
+  fp_sqr(t2, Z1);
+  fp_mul(t3, P1->x, P1->y);
+  fp_mulk_lazy(t3, t3, 2);
+  fp_mul(Z3, P1->x, Z1);
+  fp_dbl(Z3, Z3);
+  fp_mul(Y3, curve.param.E.b, t2);
+  fp_sub(Y3, Y3, Z3);
+  fp_mulk(Y3, Y3, 3);
+  fp_sub(X3, t1, Y3);
+  fp_add_lazy(Y3, t1, Y3);
+  fp_mul(Y3, X3, Y3);
+  fp_mul(X3, X3, t3);
+  fp_mulk(t2, t2, 3);
+  fp_mul(Z3, curve.param.E.b, Z3);
+  fp_sub(Z3, Z3, t2);
+  fp_sub(Z3, Z3, t0);
+  fp_mulk_lazy(Z3, Z3, 3);
+  fp_mulk_lazy(t0, t0, 3);
+  fp_sub(t0, t0, t2);
+  fp_mul(t0, t0, Z3);
+  fp_add(Y3, Y3, t0);
+  fp_mul(t0, P1->y, Z1);
+  fp_mulk_lazy(t0, t0, 2);
+  fp_mul(Z3, t0, Z3);
+  fp_sub(P0->x, X3, Z3);
+  fp_mul(Z3, t0, t1);
+  fp_mulk(Z0, Z3, 4);
+  NN_Assign(P0->y, Y3, NUMWORDS);
+}
+#endif /* ECC_COMPLETE */
 /*---------------------------------------------------------------------------*/
+#if !ECC_COMPLETE
 void
 ecc_add_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t * P2, NN_DIGIT * Z2)
 {
@@ -377,11 +702,11 @@ ecc_add_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t *
     NN_Assign(n2, P1->y, NUMWORDS);
   } else {
     /* n1 = P1->x * Z2^2 */
-    NN_ModSqrOpt(n0, Z2, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(n1, P1->x, n0, param.p, param.omega, NUMWORDS);
+    fp_sqr(n0, Z2);
+    fp_mul(n1, P1->x, n0);
     /* n2 = P1->y * Z2^3 */
-    NN_ModMultOpt(n0, n0, Z2, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(n2, P1->y, n0, param.p, param.omega, NUMWORDS);
+    fp_mul(n0, n0, Z2);
+    fp_mul(n2, P1->y, n0);
   }
 
   /* n3, n4 */
@@ -391,32 +716,31 @@ ecc_add_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t *
     NN_Assign(n4, P2->y, NUMWORDS);
   } else {
     /* n3 = P2->x * Z1^2 */
-    NN_ModSqrOpt(n0, Z1, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(n3, P2->x, n0, param.p, param.omega, NUMWORDS);
+    fp_sqr(n0, Z1);
+    fp_mul(n3, P2->x, n0);
     /* n4 = P2->y * Z1^3 */
-    NN_ModMultOpt(n0, n0, Z1, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(n4, P2->y, n0, param.p, param.omega, NUMWORDS);
+    fp_mul(n0, n0, Z1);
+    fp_mul(n4, P2->y, n0);
   }
 
   /* n5 = n1 - n3, n6 = n2 - n4 */
-  NN_ModSub(n5, n1, n3, param.p, NUMWORDS);
-  NN_ModSub(n6, n2, n4, param.p, NUMWORDS);
+  fp_sub(n5, n1, n3);
+  fp_sub(n6, n2, n4);
 
   if(NN_Zero(n5, NUMWORDS)) {
     if(NN_Zero(n6, NUMWORDS)) {
       /* P1 and P2 are same point */
       ecc_dbl_proj(P0, Z0, P1, Z1);
-      return;
+    } else {
+      /* P1 is the inverse of P2 */
+      NN_AssignZero(Z0, NUMWORDS);
     }
-  } else {
-    /* P1 is the inverse of P2 */
-    NN_AssignZero(Z0, NUMWORDS);
     return;
   }
 
-  /* 'n7' = n1 + n3, 'n8' = n2 + n4 */
-  NN_ModAdd(n1, n1, n3, param.p, NUMWORDS);
-  NN_ModAdd(n2, n2, n4, param.p, NUMWORDS);
+  /* 'n7' = n1 + n3, 'n8' = n2 + n4, both only multiplied */
+  fp_add_lazy(n1, n1, n3);
+  fp_add_lazy(n2, n2, n4);
 
   /* Z0 = Z1 * Z2 * n5 */
   if(Z_is_one(Z1) && Z_is_one(Z2)) {
@@ -427,52 +751,189 @@ ecc_add_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t *
     } else if(Z_is_one(Z2)) {
       NN_Assign(n0, Z1, NUMWORDS);
     } else {
-      NN_ModMultOpt(n0, Z1, Z2, param.p, param.omega, NUMWORDS);
+      fp_mul(n0, Z1, Z2);
     }
-    NN_ModMultOpt(Z0, n0, n5, param.p, param.omega, NUMWORDS);
+    fp_mul(Z0, n0, n5);
   }
 
   /* P0->x = n6^2 - n5^2 * 'n7' */
-  NN_ModSqrOpt(n0, n6, param.p, param.omega, NUMWORDS);
-  NN_ModSqrOpt(n4, n5, param.p, param.omega, NUMWORDS);
-  NN_ModMultOpt(n3, n1, n4, param.p, param.omega, NUMWORDS);
-  NN_ModSub(P0->x, n0, n3, param.p, NUMWORDS);
+  fp_sqr(n0, n6);
+  fp_sqr(n4, n5);
+  fp_mul(n3, n1, n4);
+  fp_sub(P0->x, n0, n3);
 
   /* 'n9' = n5^2 * 'n7' - 2 * P0->x */
-  NN_LShift(n0, P0->x, 1, NUMWORDS);
-  NN_ModSmall(n0, param.p, NUMWORDS);
-  NN_ModSub(n0, n3, n0, param.p, NUMWORDS);
+  fp_dbl(n0, P0->x);
+  fp_sub(n0, n3, n0);
 
   /* P0->y = (n6 * 'n9' - 'n8' * 'n5^3') / 2 */
-  NN_ModMultOpt(n0, n0, n6, param.p, param.omega, NUMWORDS);
-  NN_ModMultOpt(n5, n4, n5, param.p, param.omega, NUMWORDS);
-  NN_ModMultOpt(n1, n2, n5, param.p, param.omega, NUMWORDS);
-  NN_ModSub(n0, n0, n1, param.p, NUMWORDS);
+  fp_mul(n0, n0, n6);
+  fp_mul(n5, n4, n5);
+  fp_mul(n1, n2, n5);
+  fp_sub(n0, n0, n1);
 
-  if((n0[0] % 2) == 1) {
-    NN_Add(n0, n0, param.p, NUMWORDS);
-  }
+  fp_half(P0->y, n0);
+
+}
+#else
+/*
+ * Algorithm 4 of Renes, Costello, Batina, 14M + 2m_b + 29a
+ */
+void
+ecc_add_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1, point_t * P2, NN_DIGIT * Z2)
+{
+  NN_DIGIT t0[NUMWORDS];
+  NN_DIGIT t1[NUMWORDS];
+  NN_DIGIT t2[NUMWORDS];
+  NN_DIGIT t3[NUMWORDS];
+  NN_DIGIT t4[NUMWORDS];
+  NN_DIGIT X3[NUMWORDS];
+  NN_DIGIT Y3[NUMWORDS];
+  NN_DIGIT Z3[NUMWORDS];
+
+  /* the sums that are only multiplied stay lazy */
+  fp_mul(t0, P1->x, P2->x);
+  fp_mul(t1, P1->y, P2->y);
+  fp_mul(t2, Z1, Z2);
+  fp_add_lazy(t3, P1->x, P1->y);
+  fp_add_lazy(t4, P2->x, P2->y);
+  fp_mul(t3, t3, t4);
+  fp_add(t4, t0, t1);
+  fp_sub(t3, t3, t4);
+  fp_add_lazy(t4, P1->y, Z1);
+  fp_add_lazy(X3, P2->y, Z2);
+  fp_mul(t4, t4, X3);
+  fp_add(X3, t1, t2);
+  fp_sub(t4, t4, X3);
+  fp_add_lazy(X3, P1->x, Z1);
+  fp_add_lazy(Y3, P2->x, Z2);
+  fp_mul(X3, X3, Y3);
+  fp_add(Y3, t0, t2);
+  fp_sub(Y3, X3, Y3);
+  fp_mul(Z3, curve.param.E.b, t2);
+  fp_sub(X3, Y3, Z3);
+  fp_mulk(X3, X3, 3);
+  fp_sub(Z3, t1, X3);
+  fp_add_lazy(X3, t1, X3);
+  fp_mul(Y3, curve.param.E.b, Y3);
+  fp_mulk(t2, t2, 3);
+  fp_sub(Y3, Y3, t2);
+  fp_sub(Y3, Y3, t0);
+  fp_mulk_lazy(Y3, Y3, 3);
+  fp_mulk_lazy(t0, t0, 3);
+  fp_sub(t0, t0, t2);
+  fp_mul(t1, t4, Y3);
+  fp_mul(t2, t0, Y3);
+  fp_mul(Y3, X3, Z3);
+  fp_add(Y3, Y3, t2);
+  fp_mul(X3, t3, X3);
+  fp_sub(P0->x, X3, t1);
+  fp_mul(Z3, t4, Z3);
+  fp_mul(t1, t3, t0);
+  fp_add(Z0, Z3, t1);
+  NN_Assign(P0->y, Y3, NUMWORDS);
+}
+#endif /* ECC_COMPLETE */
+/*---------------------------------------------------------------------------*/
+void
+ecc_batch_normalize(point_t * P, NN_DIGIT Z[][NUMWORDS], uint16_t n)
+{
+  NN_DIGIT pre[ECC_NORMALIZE_CHUNK][NUMWORDS];
+  NN_DIGIT t[NUMWORDS];
+  NN_DIGIT zi[NUMWORDS];
+#if !ECC_COMPLETE
+  NN_DIGIT z2[NUMWORDS];
+#endif
+  uint16_t base, m;
+  int16_t i, last, prev;
+
+  for(base = 0; base < n; base += m) {
+    m = n - base;
+    if(m > ECC_NORMALIZE_CHUNK) {
+      m = ECC_NORMALIZE_CHUNK;
+    }
+
+    /* pre[i] = product of the nonzero Z[j], j <= i */
+    last = -1;
+    for(i = 0; i < m; i++) {
+      if(NN_Zero(Z[base + i], NUMWORDS)) {
+        p_clear(&(P[base + i]));
+        continue;
+      }
+      if(last < 0) {
+        NN_Assign(pre[i], Z[base + i], NUMWORDS);
+      } else {
+        fp_mul(pre[i], pre[last], Z[base + i]);
+      }
+      last = i;
+    }
+    if(last < 0) {
+      continue;
+    }
+
+    ecc_field_inv(t, pre[last]);
 
-  NN_RShift(P0->y, n0, 1, NUMWORDS);
+    /* walk back, t = 1/pre[i] */
+    for(i = last; i >= 0; i = prev) {
+      for(prev = i - 1; prev >= 0 && NN_Zero(Z[base + prev], NUMWORDS); prev--);
 
+      if(prev >= 0) {
+        fp_mul(zi, t, pre[prev]);
+        fp_mul(t, t, Z[base + i]);
+      } else {
+        NN_Assign(zi, t, NUMWORDS);
+      }
+
+#if ECC_COMPLETE
+      /* x = X/Z, y = Y/Z */
+      fp_mul(P[base + i].x, P[base + i].x, zi);
+      fp_mul(P[base + i].y, P[base + i].y, zi);
+#else
+      /* x = X/Z^2, y = Y/Z^3 */
+      fp_sqr(z2, zi);
+      fp_mul(P[base + i].x, P[base + i].x, z2);
+      fp_mul(z2, z2, zi);
+      fp_mul(P[base + i].y, P[base + i].y, z2);
+#endif
+      NN_AssignDigit(Z[base + i], 1, NUMWORDS);
+    }
+  }
 }
 /*---------------------------------------------------------------------------*/
 void
-ecc_win_precompute(point_t * baseP, point_t * pointArray)
+ecc_win_precompute_proj(point_t * baseP, point_t * pointArray, NN_DIGIT Z[][NUMWORDS])
 {
   uint8_t i;
+#if ECC_WNAF
+  point_t P2;
+  NN_DIGIT Z2[NUMWORDS];
+#endif
 
-  NN_Assign(pointArray[0].x, baseP->x, NUMWORDS);
-  NN_Assign(pointArray[0].y, baseP->y, NUMWORDS);
+  p_copy(&(pointArray[0]), baseP);
+  NN_AssignDigit(Z[0], 1, NUMWORDS);
 
-  for(i = 1; i < NUM_POINTS; i++) {
-    ecc_add(&(pointArray[i]), &(pointArray[i-1]), baseP);
-  }
+#if ECC_WNAF
+  /* odd multiples, stepping by 2*baseP */
+  ecc_dbl_proj(&P2, Z2, baseP, Z[0]);
+#endif
 
-  for(i = 0; i < NUM_MASKS; i++) {
-    mask[i] = BASIC_MASK << (W_BITS*i);
+  for(i = 1; i < NUM_POINTS; i++) {
+#if ECC_WNAF
+    ecc_add_proj(&(pointArray[i]), Z[i], &(pointArray[i-1]), Z[i-1], &P2, Z2);
+#else
+    c_add_mix(&(pointArray[i]), Z[i], &(pointArray[i-1]), Z[i-1], baseP);
+#endif
   }
+}
+/*---------------------------------------------------------------------------*/
+void
+ecc_win_precompute(point_t * baseP, point_t * pointArray)
+{
+  NN_DIGIT Z[NUM_POINTS][NUMWORDS];
 
+  /* projective chain, then one conversion of the whole table */
+  ecc_win_precompute_proj(baseP, pointArray, Z);
+  ecc_batch_normalize(pointArray, Z, NUM_POINTS);
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -482,13 +943,16 @@ ecc_mul(point_t * P0, point_t * P1, NN_DIGIT * n)
   NN_DIGIT Z0[NUMWORDS];
   NN_DIGIT Z1[NUMWORDS];
 
-  /* clear point */
-  p_clear(P0);
-
-  /* convert to Jprojective coordinate */
-  NN_AssignZero(Z0, NUMWORDS);
-  NN_AssignZero(Z1, NUMWORDS);
-  Z1[0] = 0x01;
+  /* start at the point at infinity */
+  p_set_infinity(P0, Z0);
+  NN_AssignDigit(Z1, 1, NUMWORDS);
+#if ECC_COMPLETE
+  /* the mixed addition takes no point at infinity */
+  if(p_iszero(P1)) {
+    p_clear(P0);
+    return;
+  }
+#endif
 
   tmp = NN_Bits(n, NUMWORDS);
 
@@ -505,16 +969,11 @@ ecc_mul(point_t * P0, point_t * P1, NN_DIGIT * n)
     }
   }
   /* convert back to affine coordinate */
-  if(!Z_is_one(Z0)) {
-    NN_ModInv(Z1, Z0, param.p, NUMWORDS);
-    NN_ModMultOpt(Z0, Z1, Z1, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(P0->x, P0->x, Z0, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(Z0, Z0, Z1, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(P0->y, P0->y, Z0, param.p, param.omega, NUMWORDS);
-  }
+  p_to_affine(P0, Z0);
 
 }
 /*---------------------------------------------------------------------------*/
+#if !ECC_COMPLETE
 void
 ecc_m_dbl_projective(point_t * P0, NN_DIGIT *Z0, uint8_t m)
 {
@@ -530,144 +989,1409 @@ ecc_m_dbl_projective(point_t * P0, NN_DIGIT *Z0, uint8_t m)
   }
 
   /* P0->y = 2*P0->y */
-  NN_LShift(P0->y, P0->y, 1, NUMWORDS);
-  NN_ModSmall(P0->y, param.p, NUMWORDS);
+  fp_dbl(P0->y, P0->y);
   /* W = Z^4 */
-  NN_ModSqrOpt(W, Z0, param.p, param.omega, NUMWORDS);
-  NN_ModSqrOpt(W, W, param.p, param.omega, NUMWORDS);
+  fp_sqr(W, Z0);
+  fp_sqr(W, W);
 
   for(i=0; i<m; i++) {
-    if(param.E.a_minus3) {
+    /* A is lazy, it is only multiplied */
+    if(curve.param.E.a_minus3) {
       /* A = 3(X^2-W) */
-      NN_ModSqrOpt(A, P0->x, param.p, param.omega, NUMWORDS);
-      NN_ModSub(A, A, W, param.p, NUMWORDS);
-      NN_LShift(t1, A, 1, NUMWORDS);
-      NN_ModSmall(t1, param.p, NUMWORDS);
-      NN_ModAdd(A, A, t1, param.p, NUMWORDS);
-    } else if(param.E.a_zero) {
+      fp_sqr(A, P0->x);
+      fp_sub(A, A, W);
+      fp_mulk_lazy(A, A, 3);
+    } else if(curve.param.E.a_zero) {
       /* A = 3*X^2 */
-      NN_ModSqrOpt(t1, P0->x, param.p, param.omega, NUMWORDS);
-      NN_LShift(A, t1, 1, NUMWORDS);
-      NN_ModSmall(A, param.p, NUMWORDS);
-      NN_ModAdd(A, A, t1, param.p, NUMWORDS);
+      fp_sqr(t1, P0->x);
+      fp_mulk_lazy(A, t1, 3);
     } else {
       /* A = 3*X^2 + a*W */
-      NN_ModSqrOpt(t1, P0->x, param.p, param.omega, NUMWORDS);
-      NN_LShift(A, t1, 1, NUMWORDS);
-      NN_ModSmall(A, param.p, NUMWORDS);
-      NN_ModAdd(A, A, t1, param.p, NUMWORDS);
-      NN_ModMultOpt(t1, param.E.a, W, param.p, param.omega, NUMWORDS);
-      NN_ModAdd(A, A, t1, param.p, NUMWORDS);
+      fp_sqr(t1, P0->x);
+      fp_mulk_lazy(A, t1, 3);
+      fp_mul(t1, curve.param.E.a, W);
+      fp_add_lazy(A, A, t1);
     }
       /* B = X*Y^2 */
-      NN_ModSqrOpt(y2, P0->y, param.p, param.omega, NUMWORDS);
-      NN_ModMultOpt(B, P0->x, y2, param.p, param.omega, NUMWORDS);
+      fp_sqr(y2, P0->y);
+      fp_mul(B, P0->x, y2);
       /* X = A^2 - 2B */
-      NN_ModSqrOpt(P0->x, A, param.p, param.omega, NUMWORDS);
-      NN_LShift(t1, B, 1, NUMWORDS);
-      NN_ModSmall(t1, param.p, NUMWORDS);
-      NN_ModSub(P0->x, P0->x, t1, param.p, NUMWORDS);
+      fp_sqr(P0->x, A);
+      fp_dbl(t1, B);
+      fp_sub(P0->x, P0->x, t1);
       /* Z = Z*Y */
-      NN_ModMultOpt(Z0, Z0, P0->y, param.p, param.omega, NUMWORDS);
-      NN_ModSqrOpt(y2, y2, param.p, param.omega, NUMWORDS);
+      fp_mul(Z0, Z0, P0->y);
+      fp_sqr(y2, y2);
       if (i < m-1) {
 	      /* W = W*Y^4 */
-	      NN_ModMultOpt(W, W, y2, param.p, param.omega, NUMWORDS);
+	      fp_mul(W, W, y2);
       }
       /* Y = 2A(B-X)-Y^4 */
-      NN_LShift(A, A, 1, NUMWORDS);
-      NN_ModSmall(A, param.p, NUMWORDS);
-      NN_ModSub(B, B, P0->x, param.p, NUMWORDS);
-      NN_ModMultOpt(A, A, B, param.p, param.omega, NUMWORDS);
-      NN_ModSub(P0->y, A, y2, param.p, NUMWORDS);
-    }
-    if((P0->y[0] % 2) == 1) {
-      NN_Add(P0->y, P0->y, param.p, NUMWORDS);
+      fp_mulk_lazy(A, A, 2);
+      fp_sub(B, B, P0->x);
+      fp_mul(A, A, B);
+      fp_sub(P0->y, A, y2);
     }
-    NN_RShift(P0->y, P0->y, 1, NUMWORDS);
+    fp_half(P0->y, P0->y);
+}
+#else
+void
+ecc_m_dbl_projective(point_t * P0, NN_DIGIT *Z0, uint8_t m)
+{
+  uint8_t i;
+
+  for(i = 0; i < m; i++) {
+    ecc_dbl_proj(P0, Z0, P0, Z0);
+  }
 }
+#endif /* ECC_COMPLETE */
 
 /*---------------------------------------------------------------------------*/
-/*
- * scalar point multiplication
- * P0 = n*basepoint
- * pointArray is array of basepoint, pointArray[0] = basepoint, pointArray[1] = 2*basepoint ...
+#if ECC_WNAF
+/**
+ * \brief             Returns bits [i, i+count) of a, count <= 8
  */
-void
-ecc_win_mul(point_t * P0, NN_DIGIT * n, point_t * pointArray)
+static uint8_t
+b_getbits(NN_DIGIT * a, int16_t i, uint8_t count)
 {
+  NN_DIGIT lo;
+  uint8_t shift;
 
-  int16_t i, tmp;
-  int8_t j;
-  NN_DIGIT windex;
-  NN_DIGIT Z0[NUMWORDS];
-  NN_DIGIT Z1[NUMWORDS];
-#ifndef REPEAT_DOUBLE
-  int8_t k;
-#endif
-
-  p_clear(P0);
+  shift = i % NN_DIGIT_BITS;
+  lo = a[i / NN_DIGIT_BITS] >> shift;
+  if(shift + count > NN_DIGIT_BITS) {
+    lo |= a[i / NN_DIGIT_BITS + 1] << (NN_DIGIT_BITS - shift);
+  }
 
-  /* Convert to Jprojective coordinate */
-  NN_AssignZero(Z0, NUMWORDS);
-  NN_AssignZero(Z1, NUMWORDS);
-  Z1[0] = 0x01;
+  return (uint8_t)lo & ((1 << count) - 1);
+}
 
-  tmp = NN_Digits(n, NUMWORDS);
+/**
+ * \brief             Width WNAF_BITS NAF of n, n < 2^KEY_BIT_LEN.
+ *                    Lengths: naf[KEY_BIT_LEN+1].
+ *                    Returns the number of digits up to the highest nonzero
+ *                    one, 0 for n = 0.
+ */
+static int16_t
+ecc_wnaf_recode(int8_t * naf, NN_DIGIT * n)
+{
+  int16_t bit, top;
+  uint8_t now, carry;
+  int16_t word;
 
-  for(i = tmp - 1; i >= 0; i--) {
-    for(j = NN_DIGIT_BITS/W_BITS - 1; j >= 0; j--) {
+  memset(naf, 0, KEY_BIT_LEN + 1);
 
-#ifndef REPEAT_DOUBLE
-      for(k = 0; k < W_BITS; k++) {
-        ecc_dbl_proj(P0, Z0, P0, Z0);
-      }
-#else
-      ecc_m_dbl_projective(P0, Z0, W_BITS);
-#endif
+  /*
+   * scan from the low end, a digit d takes the next WNAF_BITS bits plus the
+   * carry of the previous digit, digits above 2^(WNAF_BITS-1) become
+   * negative and carry one into the bits above
+   */
+  carry = 0;
+  top = 0;
+  bit = 0;
+  while(bit < KEY_BIT_LEN) {
+    if((b_testbit(n, bit) ? 1 : 0) == carry) {
+      bit++;
+      continue;
+    }
 
-      windex = mask[j] & n[i];
+    now = WNAF_BITS;
+    if(now > KEY_BIT_LEN - bit) {
+      now = KEY_BIT_LEN - bit;
+    }
 
-      if(windex) {
-        windex = windex >> (j*W_BITS);
+    word = b_getbits(n, bit, now) + carry;
+    carry = (word >> (WNAF_BITS - 1)) & 1;
+    word -= carry << WNAF_BITS;
 
-#ifdef ADD_MIX
-        c_add_mix(P0, Z0, P0, Z0, &(pointArray[windex-1]));
-#else
-	ecc_add_proj(P0, Z0, P0, Z0, &(pointArray[windex-1]), Z1);
-#endif
-      }
-    }
+    naf[bit] = (int8_t)word;
+    top = bit + 1;
+    bit += now;
   }
 
-
-  /* Convert back to affine coordinate */
-  if(!Z_is_one(Z0)) {
-    NN_ModInv(Z1, Z0, param.p, NUMWORDS);
-    NN_ModMultOpt(Z0, Z1, Z1, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(P0->x, P0->x, Z0, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(Z0, Z0, Z1, param.p, param.omega, NUMWORDS);
-    NN_ModMultOpt(P0->y, P0->y, Z0, param.p, param.omega, NUMWORDS);
+  if(carry) {
+    naf[KEY_BIT_LEN] = 1;
+    top = KEY_BIT_LEN + 1;
   }
 
+  return top;
 }
 
-/*---------------------------------------------------------------------------*/
-void
-ecc_win_mul_base(point_t * P0, NN_DIGIT * n)
-{
-  ecc_win_mul(P0, n, pBaseArray);
+/**
+ * \brief             (P0,Z0) += digit * Point, digit odd and nonzero,
+ *                    pointArray[i] = (2i+1)*Point
+ */
+static void
+ecc_wnaf_add(point_t * P0, NN_DIGIT * Z0, point_t * pointArray, int8_t digit)
+{
+  point_t T;
+
+  if(digit > 0) {
+    c_add_mix(P0, Z0, P0, Z0, &(pointArray[digit >> 1]));
+  } else {
+    /* -(x, y) = (x, p - y) */
+    p_copy(&T, &(pointArray[(-digit) >> 1]));
+    NN_SubFixed<KEYDIGITS>(T.y, curve.param.p, T.y);
+    c_add_mix(P0, Z0, P0, Z0, &T);
+  }
+}
+
+/*
+ * scalar point multiplication with the width WNAF_BITS NAF of n
+ * P0 = n*Point
+ * pointArray holds the odd multiples, pointArray[i] = (2i+1)*Point
+ */
+static void
+ecc_wnaf_mul(point_t * P0, NN_DIGIT * n, point_t * pointArray)
+{
+  int8_t naf[KEY_BIT_LEN + 1];
+  int16_t i, top;
+  uint8_t dbls;
+  NN_DIGIT Z0[NUMWORDS];
+
+  p_set_infinity(P0, Z0);
+
+  top = ecc_wnaf_recode(naf, n);
+
+  /* runs of zero digits are done as one repeated doubling */
+  dbls = 0;
+  for(i = top - 1; i >= 0; i--) {
+    if(naf[i]) {
+      if(dbls) {
+        ecc_m_dbl_projective(P0, Z0, dbls);
+        dbls = 0;
+      }
+
+      ecc_wnaf_add(P0, Z0, pointArray, naf[i]);
+    }
+
+    if(i > 0) {
+      if(dbls == 255) {
+        ecc_m_dbl_projective(P0, Z0, dbls);
+        dbls = 0;
+      }
+      dbls++;
+    }
+  }
+
+  if(dbls) {
+    ecc_m_dbl_projective(P0, Z0, dbls);
+  }
+
+  /* convert back to affine coordinate */
+  p_to_affine(P0, Z0);
+}
+#endif /* ECC_WNAF */
+/*---------------------------------------------------------------------------*/
+/*
+ * scalar point multiplication
+ * P0 = n*basepoint
+ * pointArray is array of basepoint, pointArray[0] = basepoint, pointArray[1] = 2*basepoint ...
+ */
+void
+ecc_win_mul(point_t * P0, NN_DIGIT * n, point_t * pointArray)
+{
+#if ECC_WNAF
+  ecc_wnaf_mul(P0, n, pointArray);
+#else
+  int16_t i, tmp;
+  int8_t j;
+  NN_DIGIT windex;
+  NN_DIGIT Z0[NUMWORDS];
+  NN_DIGIT Z1[NUMWORDS];
+#ifndef REPEAT_DOUBLE
+  int8_t k;
+#endif
+
+  p_set_infinity(P0, Z0);
+  NN_AssignDigit(Z1, 1, NUMWORDS);
+
+  tmp = NN_Digits(n, NUMWORDS);
+
+  for(i = tmp - 1; i >= 0; i--) {
+    for(j = NN_DIGIT_BITS/W_BITS - 1; j >= 0; j--) {
+
+#ifndef REPEAT_DOUBLE
+      for(k = 0; k < W_BITS; k++) {
+        ecc_dbl_proj(P0, Z0, P0, Z0);
+      }
+#else
+      ecc_m_dbl_projective(P0, Z0, W_BITS);
+#endif
+
+      windex = curve.mask[j] & n[i];
+
+      if(windex) {
+        windex = windex >> (j*W_BITS);
+
+#ifdef ADD_MIX
+        c_add_mix(P0, Z0, P0, Z0, &(pointArray[windex-1]));
+#else
+	ecc_add_proj(P0, Z0, P0, Z0, &(pointArray[windex-1]), Z1);
+#endif
+      }
+    }
+  }
+
+
+  /* convert back to affine coordinate */
+  p_to_affine(P0, Z0);
+#endif /* ECC_WNAF */
+}
+
+/*---------------------------------------------------------------------------*/
+#if ECC_COMB
+/**
+ * \brief             Returns the index into the table of comb block b for
+ *                    the bits of n at position s, 0 for none
+ *                    Bit s + ECC_COMB_SPACING*(ECC_COMB_TEETH*b + t) of n is
+ *                    tooth t of comb block b, the teeth of a block index its
+ *                    table.
+ */
+static uint8_t
+ecc_comb_index(NN_DIGIT * n, int16_t s, uint8_t b)
+{
+  int16_t bit;
+  uint8_t t;
+  uint8_t cindex = 0;
+
+  for(t = 0; t < ECC_COMB_TEETH; t++) {
+    bit = s + ECC_COMB_SPACING * (ECC_COMB_TEETH * b + t);
+    /* no branch on the bit, ecc_comb_mul_regular takes secret n */
+    if(bit < KEY_BIT_LEN) {
+      cindex |= ((n[bit / NN_DIGIT_BITS] >> (bit % NN_DIGIT_BITS)) & 1) << t;
+    }
+  }
+  return cindex;
+}
+
+/**
+ * \brief             (P0,Z0) += the comb entries of n at position s
+ */
+static void
+ecc_comb_add(point_t * P0, NN_DIGIT * Z0, NN_DIGIT * n, int16_t s)
+{
+  uint8_t b;
+  uint8_t cindex;
+  point_t T;
+
+  p_clear(&T);
+
+  for(b = 0; b < ECC_COMB_BLOCKS; b++) {
+    cindex = ecc_comb_index(n, s, b);
+
+    if(cindex) {
+      NN_Assign(T.x, (NN_DIGIT *)ecc_comb_table[b][cindex-1][0], KEYDIGITS);
+      NN_Assign(T.y, (NN_DIGIT *)ecc_comb_table[b][cindex-1][1], KEYDIGITS);
+      c_add_mix(P0, Z0, P0, Z0, &T);
+    }
+  }
+}
+
+/*
+ * scalar point multiplication with the fixed-base comb
+ * P0 = n*basepoint
+ */
+static void
+ecc_comb_mul(point_t * P0, NN_DIGIT * n)
+{
+  int16_t s;
+  NN_DIGIT Z0[NUMWORDS];
+
+  p_set_infinity(P0, Z0);
+
+  for(s = ECC_COMB_SPACING - 1; s >= 0; s--) {
+    ecc_dbl_proj(P0, Z0, P0, Z0);
+    ecc_comb_add(P0, Z0, n, s);
+  }
+
+  /* convert back to affine coordinate */
+  p_to_affine(P0, Z0);
+}
+
+/**
+ * \brief             T = entry cindex of comb block b, the first entry for
+ *                    cindex 0. Every entry of the block is read and one is
+ *                    kept with a mask, no branch and no address depends on
+ *                    cindex.
+ */
+static void
+ecc_comb_select(point_t * T, uint8_t b, uint8_t cindex)
+{
+  NN_DIGIT m;
+  uint32_t want;
+  uint8_t e, i;
+
+  /* cindex | (cindex == 0) */
+  want = cindex | (((uint32_t)cindex - 1) >> 31);
+
+  p_clear(T);
+  for(e = 0; e < (1 << ECC_COMB_TEETH) - 1; e++) {
+    m = (NN_DIGIT)0 - (NN_DIGIT)(((((uint32_t)e + 1) ^ want) - 1) >> 31);
+    for(i = 0; i < KEYDIGITS; i++) {
+      T->x[i] |= ecc_comb_table[b][e][0][i] & m;
+      T->y[i] |= ecc_comb_table[b][e][1][i] & m;
+    }
+  }
+}
+
+/*
+ * scalar point multiplication with the fixed-base comb, the same steps for
+ * every scalar, P0 = n*basepoint, 0 < n < r
+ */
+static void
+ecc_comb_mul_regular(point_t * P0, NN_DIGIT * n)
+{
+  NN_DIGIT k[NUMWORDS];
+  NN_DIGIT Z0[NUMWORDS];
+  NN_DIGIT Z1[NUMWORDS];
+  NN_DIGIT m;
+  point_t T, R;
+  int16_t s;
+  uint8_t b, cindex;
+  NN_UINT j;
+
+  /*
+   * k = n - 2^ECC_COMB_SPACING mod r on a chain that starts at G instead
+   * of infinity: the doublings take G to 2^ECC_COMB_SPACING * G, so the
+   * chain never sits at infinity and every column is one addition, its
+   * result dropped with a mask when the column of k is empty. Left are
+   * the additions that meet their own point or its negative, which the
+   * Jacobian formulas still branch on and a random secret scalar hits
+   * with negligible probability.
+   */
+  NN_AssignZero(Z1, NUMWORDS);
+  Z1[ECC_COMB_SPACING / NN_DIGIT_BITS] = (NN_DIGIT)1 << (ECC_COMB_SPACING % NN_DIGIT_BITS);
+  NN_ModSubFixed<NUMWORDS>(k, n, Z1, curve.param.r);
+
+  p_copy(P0, &(curve.param.G));
+  NN_AssignDigit(Z0, 1, NUMWORDS);
+
+  for(s = ECC_COMB_SPACING - 1; s >= 0; s--) {
+    ecc_dbl_proj(P0, Z0, P0, Z0);
+
+    for(b = 0; b < ECC_COMB_BLOCKS; b++) {
+      cindex = ecc_comb_index(k, s, b);
+      ecc_comb_select(&T, b, cindex);
+      c_add_mix(&R, Z1, P0, Z0, &T);
+
+      /* all ones iff cindex != 0 */
+      m = (NN_DIGIT)0 - (NN_DIGIT)((0 - (uint32_t)cindex) >> 31);
+      for(j = 0; j < NUMWORDS; j++) {
+        P0->x[j] = (R.x[j] & m) | (P0->x[j] & ~m);
+        P0->y[j] = (R.y[j] & m) | (P0->y[j] & ~m);
+        Z0[j] = (Z1[j] & m) | (Z0[j] & ~m);
+      }
+    }
+  }
+
+  p_to_affine(P0, Z0);
+}
+#endif /* ECC_COMB */
+/*---------------------------------------------------------------------------*/
+#ifdef ECC_COMB_X4
+/*
+ * Four points at once on the nn_x4 kernels, Jacobian coordinate in
+ * Montgomery form. NN_X4Mult, NN_X4Sqr and NN_X4Sub leave normalized
+ * values, the sums and small multiples below add up at most 8 of them.
+ */
+
+/**
+ * \brief             (X,Y,Z) = 2*(X,Y,Z), a = -3
+ */
+static void
+x4_dbl(nn_x4_t * X, nn_x4_t * Y, nn_x4_t * Z)
+{
+  nn_x4_t delta, gamma, beta, alpha, t;
+
+  NN_X4Sqr(&delta, Z);
+  NN_X4Sqr(&gamma, Y);
+  NN_X4Mult(&beta, X, &gamma);
+
+  /* alpha = 3 * (X - delta) * (X + delta) */
+  NN_X4Sub(&t, X, &delta);
+  NN_X4Add(&alpha, X, &delta);
+  NN_X4Mult(&alpha, &t, &alpha);
+  NN_X4MultSmall(&alpha, &alpha, 3);
+
+  /* Z3 = (Y + Z)^2 - gamma - delta */
+  NN_X4Add(&t, Y, Z);
+  NN_X4Sqr(&t, &t);
+  NN_X4Add(&delta, &gamma, &delta);
+  NN_X4Sub(Z, &t, &delta);
+
+  /* X3 = alpha^2 - 8 * beta */
+  NN_X4Sqr(X, &alpha);
+  NN_X4MultSmall(&t, &beta, 8);
+  NN_X4Sub(X, X, &t);
+
+  /* Y3 = alpha * (4 * beta - X3) - 8 * gamma^2 */
+  NN_X4MultSmall(&beta, &beta, 4);
+  NN_X4Sub(&beta, &beta, X);
+  NN_X4Mult(&beta, &alpha, &beta);
+  NN_X4Sqr(&gamma, &gamma);
+  NN_X4MultSmall(&gamma, &gamma, 8);
+  NN_X4Sub(Y, &beta, &gamma);
+}
+
+/**
+ * \brief             (X3,Y3,Z3) = (X1,Y1,Z1) + (x2,y2), (x2,y2) affine
+ *                    No special case: Z3 = 0 when (X1,Y1,Z1) is (x2,y2) or
+ *                    its negative, X1,Y1,Z1 are not defined at infinity.
+ */
+static void
+x4_add_mix(nn_x4_t * X3, nn_x4_t * Y3, nn_x4_t * Z3, nn_x4_t * X1, nn_x4_t * Y1, nn_x4_t * Z1,
+           nn_x4_t * x2, nn_x4_t * y2)
+{
+  nn_x4_t A, B, E, F, G, H;
+
+  /* E = x2 * Z1^2 - X1, F = y2 * Z1^3 - Y1 */
+  NN_X4Sqr(&A, Z1);
+  NN_X4Mult(&B, Z1, &A);
+  NN_X4Mult(&A, x2, &A);
+  NN_X4Mult(&B, y2, &B);
+  NN_X4Sub(&E, &A, X1);
+  NN_X4Sub(&F, &B, Y1);
+
+  /* G = X1 * E^2, H = E^3 */
+  NN_X4Sqr(&A, &E);
+  NN_X4Mult(&H, &A, &E);
+  NN_X4Mult(&G, X1, &A);
+  NN_X4Mult(Z3, Z1, &E);
+
+  /* X3 = F^2 - H - 2 * G */
+  NN_X4Add(&A, &G, &G);
+  NN_X4Add(&A, &A, &H);
+  NN_X4Sqr(X3, &F);
+  NN_X4Sub(X3, X3, &A);
+
+  /* Y3 = F * (G - X3) - Y1 * H */
+  NN_X4Sub(&G, &G, X3);
+  NN_X4Mult(&G, &F, &G);
+  NN_X4Mult(&H, Y1, &H);
+  NN_X4Sub(Y3, &G, &H);
+}
+
+/**
+ * \brief             Fills curve.comb_x4 from ecc_comb_table, run by
+ *                    ecc_build_ctx
+ */
+static void
+ecc_comb_x4_build(void)
+{
+  const uint16_t per_block = (1 << ECC_COMB_TEETH) - 1;
+  const uint16_t entries = ECC_COMB_BLOCKS * per_block;
+  NN_DIGIT t[NUMWORDS];
+  nn_x4_t xy[2];
+  uint16_t e, f;
+  uint8_t lane, c, i;
+
+  NN_AssignZero(t, NUMWORDS);
+  for(e = 0; e < entries; e += 4) {
+    /* four entries per conversion, the last group is padded with entry e */
+    for(lane = 0; lane < 4; lane++) {
+      f = e + lane < entries ? e + lane : e;
+      for(c = 0; c < 2; c++) {
+        NN_Assign(t, (NN_DIGIT *)ecc_comb_table[f / per_block][f % per_block][c], KEYDIGITS);
+        NN_X4Set(&xy[c], lane, t);
+      }
+    }
+    for(c = 0; c < 2; c++) {
+      NN_X4ToMont(&xy[c], &xy[c]);
+    }
+    for(lane = 0; lane < 4 && e + lane < entries; lane++) {
+      f = e + lane;
+      for(c = 0; c < 2; c++) {
+        for(i = 0; i < NN_X4_LIMBS; i++) {
+          curve.comb_x4[f / per_block][f % per_block][c][i] = xy[c].l[i][lane];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * \brief             P0[i] = n[i] * basepoint, ecc_comb_mul on four scalars
+ *                    Every lane runs every doubling. An addition runs
+ *                    when a lane has a comb entry and the lanes without one
+ *                    keep their point, a lane still at infinity takes the
+ *                    entry itself. The rare lane whose addition met its
+ *                    own point is redone with ecc_comb_mul.
+ */
+static void
+ecc_comb_mul_x4(point_t * P0, NN_DIGIT n[][NUMWORDS])
+{
+  nn_x4_t X, Y, Z, X3, Y3, Z3, x2, y2, one;
+  NN_DIGIT Z0[4][NUMWORDS];
+  int16_t s;
+  uint8_t b, i, lane, cindex;
+  uint8_t add, inf = 0x0f, redo = 0;
+
+  NN_X4One(&one);
+  X = one;
+  Y = one;
+  Z = one;
+
+  for(s = ECC_COMB_SPACING - 1; s >= 0; s--) {
+    x4_dbl(&X, &Y, &Z);
+
+    for(b = 0; b < ECC_COMB_BLOCKS; b++) {
+      add = 0;
+      for(lane = 0; lane < 4; lane++) {
+        cindex = ecc_comb_index(n[lane], s, b);
+        if(cindex) {
+          add |= 1 << lane;
+        } else {
+          cindex = 1;
+        }
+        for(i = 0; i < NN_X4_LIMBS; i++) {
+          x2.l[i][lane] = curve.comb_x4[b][cindex - 1][0][i];
+          y2.l[i][lane] = curve.comb_x4[b][cindex - 1][1][i];
+        }
+      }
+      if(!add) {
+        continue;
+      }
+
+      x4_add_mix(&X3, &Y3, &Z3, &X, &Y, &Z, &x2, &y2);
+      NN_X4Select(&X, &X3, &X, add & ~inf);
+      NN_X4Select(&Y, &Y3, &Y, add & ~inf);
+      NN_X4Select(&Z, &Z3, &Z, add & ~inf);
+      NN_X4Select(&X, &x2, &X, add & inf);
+      NN_X4Select(&Y, &y2, &Y, add & inf);
+      NN_X4Select(&Z, &one, &Z, add & inf);
+      inf &= ~add;
+    }
+  }
+
+  NN_X4FromMont(&X, &X);
+  NN_X4FromMont(&Y, &Y);
+  NN_X4FromMont(&Z, &Z);
+  for(lane = 0; lane < 4; lane++) {
+    NN_X4Get(P0[lane].x, &X, lane);
+    NN_X4Get(P0[lane].y, &Y, lane);
+    NN_X4Get(Z0[lane], &Z, lane);
+    if(inf & (1 << lane)) {
+      NN_AssignZero(Z0[lane], NUMWORDS);
+    } else if(NN_Zero(Z0[lane], NUMWORDS)) {
+      redo |= 1 << lane;
+    }
+  }
+
+  ecc_batch_normalize(P0, Z0, 4);
+
+  for(lane = 0; lane < 4; lane++) {
+    if(redo & (1 << lane)) {
+      ecc_comb_mul(&P0[lane], n[lane]);
+    }
+  }
+}
+
+/**
+ * \brief             (x2,y2) lane i = entry cindex[i] of comb block b, the
+ *                    first entry for cindex[i] 0, ecc_comb_select on
+ *                    curve.comb_x4
+ */
+static void
+x4_comb_select(nn_x4_t * x2, nn_x4_t * y2, uint8_t b, uint8_t * cindex)
+{
+  uint32_t want[4], m[4], w;
+  uint8_t e, i, lane;
+
+  for(lane = 0; lane < 4; lane++) {
+    want[lane] = cindex[lane] | (((uint32_t)cindex[lane] - 1) >> 31);
+  }
+
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    for(lane = 0; lane < 4; lane++) {
+      x2->l[i][lane] = 0;
+      y2->l[i][lane] = 0;
+    }
+  }
+  for(e = 0; e < (1 << ECC_COMB_TEETH) - 1; e++) {
+    for(lane = 0; lane < 4; lane++) {
+      m[lane] = (uint32_t)0 - (((((uint32_t)e + 1) ^ want[lane]) - 1) >> 31);
+    }
+    for(i = 0; i < NN_X4_LIMBS; i++) {
+      w = curve.comb_x4[b][e][0][i];
+      for(lane = 0; lane < 4; lane++) {
+        x2->l[i][lane] |= w & m[lane];
+      }
+      w = curve.comb_x4[b][e][1][i];
+      for(lane = 0; lane < 4; lane++) {
+        y2->l[i][lane] |= w & m[lane];
+      }
+    }
+  }
+}
+
+/**
+ * \brief             P0[i] = n[i] * basepoint, ecc_comb_mul_regular on
+ *                    four scalars, 0 < n[i] < r
+ *                    Every lane runs every doubling and every addition,
+ *                    the lanes with an empty column keep their point with
+ *                    a mask. The rare lane whose addition met its own
+ *                    point is redone with ecc_comb_mul_regular.
+ */
+static void
+ecc_comb_mul_x4_regular(point_t * P0, NN_DIGIT n[][NUMWORDS])
+{
+  nn_x4_t X, Y, Z, X3, Y3, Z3, x2, y2;
+  NN_DIGIT k[4][NUMWORDS];
+  NN_DIGIT Z0[4][NUMWORDS];
+  int16_t s;
+  uint8_t cindex[4];
+  uint8_t b, lane;
+  uint8_t add, redo = 0;
+
+  /* k = n - 2^ECC_COMB_SPACING mod r on chains that start at G */
+  NN_AssignZero(Z0[0], NUMWORDS);
+  Z0[0][ECC_COMB_SPACING / NN_DIGIT_BITS] = (NN_DIGIT)1 << (ECC_COMB_SPACING % NN_DIGIT_BITS);
+  for(lane = 0; lane < 4; lane++) {
+    NN_ModSubFixed<NUMWORDS>(k[lane], n[lane], Z0[0], curve.param.r);
+    NN_X4Set(&X, lane, curve.param.G.x);
+    NN_X4Set(&Y, lane, curve.param.G.y);
+  }
+  NN_X4ToMont(&X, &X);
+  NN_X4ToMont(&Y, &Y);
+  NN_X4One(&Z);
+
+  for(s = ECC_COMB_SPACING - 1; s >= 0; s--) {
+    x4_dbl(&X, &Y, &Z);
+
+    for(b = 0; b < ECC_COMB_BLOCKS; b++) {
+      add = 0;
+      for(lane = 0; lane < 4; lane++) {
+        cindex[lane] = ecc_comb_index(k[lane], s, b);
+        add |= ((0 - (uint32_t)cindex[lane]) >> 31) << lane;
+      }
+      x4_comb_select(&x2, &y2, b, cindex);
+
+      x4_add_mix(&X3, &Y3, &Z3, &X, &Y, &Z, &x2, &y2);
+      NN_X4Select(&X, &X3, &X, add);
+      NN_X4Select(&Y, &Y3, &Y, add);
+      NN_X4Select(&Z, &Z3, &Z, add);
+    }
+  }
+
+  NN_X4FromMont(&X, &X);
+  NN_X4FromMont(&Y, &Y);
+  NN_X4FromMont(&Z, &Z);
+  for(lane = 0; lane < 4; lane++) {
+    NN_X4Get(P0[lane].x, &X, lane);
+    NN_X4Get(P0[lane].y, &Y, lane);
+    NN_X4Get(Z0[lane], &Z, lane);
+    if(NN_Zero(Z0[lane], NUMWORDS)) {
+      redo |= 1 << lane;
+    }
+  }
+
+  ecc_batch_normalize(P0, Z0, 4);
+
+  for(lane = 0; lane < 4; lane++) {
+    if(redo & (1 << lane)) {
+      ecc_comb_mul_regular(&P0[lane], n[lane]);
+    }
+  }
+}
+#endif /* ECC_COMB_X4 */
+/*---------------------------------------------------------------------------*/
+void
+ecc_win_mul_base(point_t * P0, NN_DIGIT * n)
+{
+#if ECC_COMB
+  ecc_comb_mul(P0, n);
+#else
+  ecc_win_mul(P0, n, curve.pBaseArray);
+#endif
+}
+/*---------------------------------------------------------------------------*/
+void
+ecc_win_mul_base_x4(point_t * P0, NN_DIGIT n[][NUMWORDS])
+{
+  uint8_t i;
+
+#ifdef ECC_COMB_X4
+  if(NN_X4Available()) {
+    ecc_comb_mul_x4(P0, n);
+    return;
+  }
+#endif
+  for(i = 0; i < 4; i++) {
+    ecc_win_mul_base(&P0[i], n[i]);
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+ecc_twin_mul_base_proj(point_t * P0, NN_DIGIT * Z0, NN_DIGIT * u1, NN_DIGIT * u2, point_t * pointArray)
+{
+#if ECC_WNAF
+  int8_t naf2[KEY_BIT_LEN + 1];
+#if !ECC_COMB
+  int8_t naf1[KEY_BIT_LEN + 1];
+  int16_t top1;
+#endif
+  int16_t i, top;
+  uint8_t dbls;
+
+  p_set_infinity(P0, Z0);
+
+  /*
+   * u2 in wNAF on pointArray, u1 on the comb (its columns are the lowest
+   * ECC_COMB_SPACING chain positions) or in wNAF on pBaseArray
+   */
+  top = ecc_wnaf_recode(naf2, u2);
+#if ECC_COMB
+  if(top < ECC_COMB_SPACING) {
+    top = ECC_COMB_SPACING;
+  }
+#else
+  top1 = ecc_wnaf_recode(naf1, u1);
+  if(top < top1) {
+    top = top1;
+  }
+#endif
+
+  dbls = 0;
+  for(i = top - 1; i >= 0; i--) {
+#if ECC_COMB
+    if(naf2[i] || i < ECC_COMB_SPACING) {
+#else
+    if(naf2[i] || naf1[i]) {
+#endif
+      if(dbls) {
+        ecc_m_dbl_projective(P0, Z0, dbls);
+        dbls = 0;
+      }
+
+      if(naf2[i]) {
+        ecc_wnaf_add(P0, Z0, pointArray, naf2[i]);
+      }
+#if ECC_COMB
+      if(i < ECC_COMB_SPACING) {
+        ecc_comb_add(P0, Z0, u1, i);
+      }
+#else
+      if(naf1[i]) {
+        ecc_wnaf_add(P0, Z0, curve.pBaseArray, naf1[i]);
+      }
+#endif
+    }
+
+    if(i > 0) {
+      if(dbls == 255) {
+        ecc_m_dbl_projective(P0, Z0, dbls);
+        dbls = 0;
+      }
+      dbls++;
+    }
+  }
+
+  if(dbls) {
+    ecc_m_dbl_projective(P0, Z0, dbls);
+  }
+#else
+  point_t u1P, u2Q;
+  NN_DIGIT Z1[NUMWORDS];
+  NN_DIGIT Z2[NUMWORDS];
+
+  ecc_win_mul_base(&u1P, u1);
+  ecc_win_mul(&u2Q, u2, pointArray);
+
+  /* the affine (0, 0) either returns is the point at infinity, Z = 0 */
+  NN_AssignDigit(Z1, 1, NUMWORDS);
+  NN_AssignDigit(Z2, 1, NUMWORDS);
+  if(p_iszero(&u1P)) {
+    p_set_infinity(&u1P, Z1);
+  }
+  if(p_iszero(&u2Q)) {
+    p_set_infinity(&u2Q, Z2);
+  }
+  ecc_add_proj(P0, Z0, &u1P, Z1, &u2Q, Z2);
+#endif /* ECC_WNAF */
+}
+/*---------------------------------------------------------------------------*/
+void
+ecc_twin_mul_base(point_t * P0, NN_DIGIT * u1, NN_DIGIT * u2, point_t * pointArray)
+{
+  NN_DIGIT Z0[NUMWORDS];
+
+  ecc_twin_mul_base_proj(P0, Z0, u1, u2, pointArray);
+
+  /* convert back to affine coordinate */
+  p_to_affine(P0, Z0);
+}
+/*---------------------------------------------------------------------------*/
+#if ECC_BATCH_AFFINE
+/*
+ * The chains of ecc_twin_mul_base_proj side by side in affine coordinate.
+ * A chain visits the positions i of the recoded scalars from the top down,
+ * at each one a doubling, the addition of the wNAF digit of u2, then those
+ * of u1 (the comb blocks, or its wNAF digit). twin_lane_next stops at the
+ * next of them that needs an inversion, additions to the point at infinity
+ * being copies, and each round inverts the denominators of all chains at
+ * once. A chain meeting a zero denominator (an addition of +-P to P, which
+ * only forged signatures reach) leaves the round and is redone alone.
+ */
+#if ECC_COMB
+#define TWIN_STEPS (2 + ECC_COMB_BLOCKS)
+#else
+#define TWIN_STEPS 3
+#endif
+
+#define TWIN_DONE 0
+#define TWIN_DBL 1
+#define TWIN_ADD 2
+
+typedef struct twin_lane {
+  int8_t naf2[KEY_BIT_LEN + 1];
+#if !ECC_COMB
+  int8_t naf1[KEY_BIT_LEN + 1];
+#endif
+  NN_DIGIT * u1;
+  point_t * pointArray;
+  int16_t i;
+  uint8_t step;
+  uint8_t inf;
+  uint8_t fail;
+} twin_lane_t;
+
+/**
+ * \brief             Sets up the chain of u1 * basepoint + u2 * Point
+ */
+static void
+twin_lane_init(twin_lane_t * L, NN_DIGIT * u1, NN_DIGIT * u2, point_t * pointArray)
+{
+  int16_t top;
+#if !ECC_COMB
+  int16_t top1;
+#endif
+
+  top = ecc_wnaf_recode(L->naf2, u2);
+#if ECC_COMB
+  if(top < ECC_COMB_SPACING) {
+    top = ECC_COMB_SPACING;
+  }
+#else
+  top1 = ecc_wnaf_recode(L->naf1, u1);
+  if(top < top1) {
+    top = top1;
+  }
+#endif
+
+  L->u1 = u1;
+  L->pointArray = pointArray;
+  L->i = top - 1;
+  L->step = 0;
+  L->inf = 1;
+  L->fail = 0;
+}
+
+/**
+ * \brief             T = digit * Point, digit odd and nonzero,
+ *                    pointArray[i] = (2i+1)*Point
+ */
+static void
+twin_wnaf_point(point_t * T, point_t * pointArray, int8_t digit)
+{
+  if(digit > 0) {
+    p_copy(T, &(pointArray[digit >> 1]));
+  } else {
+    /* -(x, y) = (x, p - y) */
+    p_copy(T, &(pointArray[(-digit) >> 1]));
+    NN_SubFixed<KEYDIGITS>(T->y, curve.param.p, T->y);
+  }
+}
+
+/**
+ * \brief             Moves the chain of L, accumulated in P0, to its next
+ *                    doubling or addition of T.
+ * \return            TWIN_DBL, TWIN_ADD or TWIN_DONE at the end of the chain.
+ */
+static uint8_t
+twin_lane_next(twin_lane_t * L, point_t * P0, point_t * T)
+{
+#if ECC_COMB
+  uint8_t cindex;
+#endif
+
+  for(; L->i >= 0; L->i--, L->step = 0) {
+    for(; L->step < TWIN_STEPS; L->step++) {
+      if(L->step == 0) {
+        /* doubling the point at infinity leaves it */
+        if(!L->inf) {
+          L->step++;
+          return TWIN_DBL;
+        }
+        continue;
+      }
+
+      if(L->step == 1) {
+        if(L->naf2[L->i] == 0) {
+          continue;
+        }
+        twin_wnaf_point(T, L->pointArray, L->naf2[L->i]);
+      } else {
+#if ECC_COMB
+        if(L->i >= ECC_COMB_SPACING) {
+          continue;
+        }
+        cindex = ecc_comb_index(L->u1, L->i, L->step - 2);
+        if(cindex == 0) {
+          continue;
+        }
+        p_clear(T);
+        NN_Assign(T->x, (NN_DIGIT *)ecc_comb_table[L->step - 2][cindex-1][0], KEYDIGITS);
+        NN_Assign(T->y, (NN_DIGIT *)ecc_comb_table[L->step - 2][cindex-1][1], KEYDIGITS);
+#else
+        if(L->naf1[L->i] == 0) {
+          continue;
+        }
+        twin_wnaf_point(T, curve.pBaseArray, L->naf1[L->i]);
+#endif
+      }
+
+      if(L->inf) {
+        p_copy(P0, T);
+        L->inf = 0;
+        continue;
+      }
+      L->step++;
+      return TWIN_ADD;
+    }
+  }
+
+  return TWIN_DONE;
+}
+
+/**
+ * \brief             Runs the chains of L[0..n) to their end, n <= ECC_BATCH_LANES
+ */
+static void
+twin_lanes_run(twin_lane_t * L, point_t * P0, uint16_t n)
+{
+  point_t T[ECC_BATCH_LANES];
+  NN_DIGIT den[ECC_BATCH_LANES][NUMWORDS];
+  NN_DIGIT pre[ECC_BATCH_LANES][NUMWORDS];
+  uint8_t op[ECC_BATCH_LANES];
+  NN_DIGIT t[NUMWORDS];
+  NN_DIGIT zi[NUMWORDS];
+  NN_DIGIT l[NUMWORDS];
+  NN_DIGIT x3[NUMWORDS];
+  NN_DIGIT * tx;
+  int16_t i, last, prev;
+
+  while(1) {
+    /* den[i] = 2y for a doubling, x(T) - x for an addition */
+    last = -1;
+    for(i = 0; i < n; i++) {
+      op[i] = L[i].fail ? TWIN_DONE : twin_lane_next(&L[i], &P0[i], &T[i]);
+      if(op[i] == TWIN_DONE) {
+        continue;
+      }
+
+      if(op[i] == TWIN_DBL) {
+        fp_dbl(den[i], P0[i].y);
+      } else {
+        fp_sub(den[i], T[i].x, P0[i].x);
+      }
+      if(NN_Zero(den[i], NUMWORDS)) {
+        L[i].fail = 1;
+        op[i] = TWIN_DONE;
+        continue;
+      }
+
+      if(last < 0) {
+        NN_Assign(pre[i], den[i], NUMWORDS);
+      } else {
+        fp_mul(pre[i], pre[last], den[i]);
+      }
+      last = i;
+    }
+    if(last < 0) {
+      return;
+    }
+
+    ecc_field_inv(t, pre[last]);
+
+    /* walk back, t = 1/pre[i] */
+    for(i = last; i >= 0; i = prev) {
+      for(prev = i - 1; prev >= 0 && op[prev] == TWIN_DONE; prev--);
+
+      if(prev >= 0) {
+        fp_mul(zi, t, pre[prev]);
+        fp_mul(t, t, den[i]);
+      } else {
+        NN_Assign(zi, t, NUMWORDS);
+      }
+
+      /* slope l, x3 = l^2 - x - x(T), y3 = l*(x - x3) - y */
+      if(op[i] == TWIN_DBL) {
+        /* l = (3x^2 + a) / 2y, T = P */
+        fp_sqr(l, P0[i].x);
+        fp_mulk(l, l, 3);
+        fp_add(l, l, curve.param.E.a);
+        tx = P0[i].x;
+      } else {
+        /* l = (y(T) - y) / (x(T) - x) */
+        fp_sub(l, T[i].y, P0[i].y);
+        tx = T[i].x;
+      }
+      fp_mul(l, l, zi);
+
+      fp_sqr(x3, l);
+      fp_sub(x3, x3, P0[i].x);
+      fp_sub(x3, x3, tx);
+      fp_sub(zi, P0[i].x, x3);
+      fp_mul(zi, zi, l);
+      fp_sub(P0[i].y, zi, P0[i].y);
+      NN_Assign(P0[i].x, x3, NUMWORDS);
+    }
+  }
+}
+#endif /* ECC_BATCH_AFFINE */
+/*---------------------------------------------------------------------------*/
+void
+ecc_twin_mul_base_batch(point_t * P0, uint8_t * inf, NN_DIGIT u1[][NUMWORDS], NN_DIGIT u2[][NUMWORDS],
+                        point_t ** pointArray, uint16_t n)
+{
+  uint16_t base, m, i;
+#if ECC_BATCH_AFFINE
+  twin_lane_t L[ECC_BATCH_LANES];
+  NN_DIGIT Z[NUMWORDS];
+
+  for(base = 0; base < n; base += m) {
+    m = n - base;
+    if(m > ECC_BATCH_LANES) {
+      m = ECC_BATCH_LANES;
+    }
+
+    for(i = 0; i < m; i++) {
+      twin_lane_init(&L[i], u1[base + i], u2[base + i], pointArray[base + i]);
+    }
+    twin_lanes_run(L, P0 + base, m);
+
+    for(i = 0; i < m; i++) {
+      if(L[i].fail) {
+        /* alone in Jacobian coordinates */
+        ecc_twin_mul_base_proj(&P0[base + i], Z, u1[base + i], u2[base + i], pointArray[base + i]);
+        L[i].inf = NN_Zero(Z, NUMWORDS);
+        if(!L[i].inf) {
+          p_to_affine(&P0[base + i], Z);
+        }
+      }
+      inf[base + i] = L[i].inf;
+      if(inf[base + i]) {
+        p_clear(&P0[base + i]);
+      }
+    }
+  }
+#else
+  NN_DIGIT Zs[ECC_NORMALIZE_CHUNK][NUMWORDS];
+
+  for(base = 0; base < n; base += m) {
+    m = n - base;
+    if(m > ECC_NORMALIZE_CHUNK) {
+      m = ECC_NORMALIZE_CHUNK;
+    }
+
+    for(i = 0; i < m; i++) {
+      ecc_twin_mul_base_proj(&P0[base + i], Zs[i], u1[base + i], u2[base + i], pointArray[base + i]);
+      inf[base + i] = NN_Zero(Zs[i], NUMWORDS);
+    }
+    ecc_batch_normalize(P0 + base, Zs, m);
+  }
+#endif
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Montgomery ladder on co-Z Jacobian coordinates (Goundar, Joye, Miyaji,
+ * Rivain, Venelli, "Scalar multiplication on Weierstrass elliptic curves from
+ * Co-Z arithmetic"). R0 and R1 share their Z, which is never stored: the
+ * last step recovers it from the input point.
+ */
+
+/**
+ * \brief             Swaps P1 and P2 if swap is 1, without a branch
+ */
+static void
+p_cswap(point_t * P1, point_t * P2, NN_DIGIT swap)
+{
+  NN_DIGIT m, t;
+  NN_UINT i;
+
+  m = (NN_DIGIT)0 - swap;
+  for(i = 0; i < NUMWORDS; i++) {
+    t = (P1->x[i] ^ P2->x[i]) & m;
+    P1->x[i] ^= t;
+    P2->x[i] ^= t;
+    t = (P1->y[i] ^ P2->y[i]) & m;
+    P1->y[i] ^= t;
+    P2->y[i] ^= t;
+  }
+}
+
+/**
+ * \brief             Returns all ones if a == b, otherwise zero, without a
+ *                    branch
+ */
+static NN_DIGIT
+nn_equal_mask(NN_DIGIT * a, NN_DIGIT * b)
+{
+  NN_DIGIT d = 0;
+  NN_UINT i;
+
+  for(i = 0; i < NUMWORDS; i++) {
+    d |= a[i] ^ b[i];
+  }
+  /* top bit of d | -d is set iff d != 0 */
+  d |= (NN_DIGIT)((NN_DIGIT)0 - d);
+  return (NN_DIGIT)((d >> (NN_DIGIT_BITS - 1)) - 1);
+}
+
+/**
+ * \brief             (R1, R0) = (2P, P) with a common Z = 2y, P affine
+ */
+static void
+xycz_idbl(point_t * R1, point_t * R0, point_t * P)
+{
+  NN_DIGIT t[NUMWORDS];
+  NN_DIGIT m[NUMWORDS];
+
+  /* R0 = (4xy^2, 8y^4) = (x Z^2, y Z^3) */
+  fp_sqr(t, P->y);
+  fp_mul(R0->x, P->x, t);
+  fp_dbl(R0->x, R0->x);
+  fp_dbl(R0->x, R0->x);
+  fp_sqr(R0->y, t);
+  fp_dbl(R0->y, R0->y);
+  fp_dbl(R0->y, R0->y);
+  fp_dbl(R0->y, R0->y);
+
+  /* m = 3x^2 + a */
+  fp_sqr(t, P->x);
+  fp_dbl(m, t);
+  fp_add(m, m, t);
+  fp_add(m, m, curve.param.E.a);
+
+  /* R1 = (m^2 - 2*R0.x, m(R0.x - R1.x) - R0.y) */
+  fp_sqr(R1->x, m);
+  fp_dbl(t, R0->x);
+  fp_sub(R1->x, R1->x, t);
+  fp_sub(t, R0->x, R1->x);
+  fp_mul(t, m, t);
+  fp_sub(R1->y, t, R0->y);
+}
+
+/**
+ * \brief             XYcZ-ADD: (P, Q) = (P, P + Q), both on a new common Z
+ */
+static void
+xycz_add(point_t * P, point_t * Q)
+{
+  NN_DIGIT t[NUMWORDS];
+  NN_DIGIT x3[NUMWORDS];
+
+  /* A = (x2 - x1)^2, B = x1*A, C = x2*A */
+  fp_sub(t, Q->x, P->x);
+  fp_sqr(t, t);
+  fp_mul(P->x, P->x, t);
+  fp_mul(Q->x, Q->x, t);
+
+  /* x3 = (y2 - y1)^2 - B - C */
+  fp_sub(Q->y, Q->y, P->y);
+  fp_sqr(x3, Q->y);
+  fp_sub(x3, x3, P->x);
+  fp_sub(x3, x3, Q->x);
+
+  /* y1' = y1*(C - B), y3 = (y2 - y1)*(B - x3) - y1' */
+  fp_sub(t, Q->x, P->x);
+  fp_mul(P->y, P->y, t);
+  fp_sub(t, P->x, x3);
+  fp_mul(Q->y, Q->y, t);
+  fp_sub(Q->y, Q->y, P->y);
+
+  NN_Assign(Q->x, x3, NUMWORDS);
+}
+
+/**
+ * \brief             XYcZ-ADDC: (P, Q) = (P - Q, P + Q), both on a new
+ *                    common Z
+ */
+static void
+xycz_addc(point_t * P, point_t * Q)
+{
+  NN_DIGIT s[NUMWORDS];
+  NN_DIGIT t[NUMWORDS];
+  NN_DIGIT u[NUMWORDS];
+
+  /* A = (x2 - x1)^2, B = x1*A, C = x2*A */
+  fp_sub(t, Q->x, P->x);
+  fp_sqr(t, t);
+  fp_mul(P->x, P->x, t);
+  fp_mul(Q->x, Q->x, t);
+
+  /* s = y2 + y1, y2 - y1, E = y1*(C - B), t = B + C */
+  fp_add(s, Q->y, P->y);
+  fp_sub(Q->y, Q->y, P->y);
+  fp_sub(t, Q->x, P->x);
+  fp_mul(P->y, P->y, t);
+  fp_add(t, P->x, Q->x);
+
+  /* x3 = (y2 - y1)^2 - (B + C), y3 = (y2 - y1)*(B - x3) - E */
+  fp_sqr(Q->x, Q->y);
+  fp_sub(Q->x, Q->x, t);
+  fp_sub(u, P->x, Q->x);
+  fp_mul(Q->y, Q->y, u);
+  fp_sub(Q->y, Q->y, P->y);
+
+  /* x3' = (y2 + y1)^2 - (B + C), y3' = (y2 + y1)*(x3' - B) - E */
+  fp_sqr(u, s);
+  fp_sub(u, u, t);
+  fp_sub(t, u, P->x);
+  fp_mul(t, t, s);
+  fp_sub(P->y, t, P->y);
+  NN_Assign(P->x, u, NUMWORDS);
+}
+/*---------------------------------------------------------------------------*/
+void
+ecc_mul_regular(point_t * P0, point_t * P1, NN_DIGIT * n)
+{
+  NN_DIGIT k[2][NUMWORDS];
+  NN_DIGIT z[NUMWORDS];
+  NN_DIGIT t[NUMWORDS];
+  NN_DIGIT m, neg, one, bit, swap;
+  point_t R[2];
+  int16_t i;
+  NN_UINT j;
+
+  /*
+   * n = r - 1 and n = r - 2 would bring r * P1 into the ladder, run them
+   * as 1 and 2 and negate the result
+   */
+  NN_SubFixed<NUMWORDS>(k[1], curve.param.r, n);
+  NN_AssignDigit(t, 1, NUMWORDS);
+  neg = nn_equal_mask(k[1], t);
+  NN_AssignDigit(t, 2, NUMWORDS);
+  neg |= nn_equal_mask(k[1], t);
+  for(j = 0; j < NUMWORDS; j++) {
+    k[0][j] = (n[j] & ~neg) | (k[1][j] & neg);
+  }
+  NN_AssignDigit(t, 1, NUMWORDS);
+  one = nn_equal_mask(k[0], t);
+
+  /*
+   * k + r or k + 2r, whichever has bit KEY_BIT_LEN set, so that every
+   * scalar takes KEY_BIT_LEN ladder steps (r > 2^(KEY_BIT_LEN-1))
+   */
+  NN_AddFixed<NUMWORDS>(k[0], k[0], curve.param.r);
+  NN_AddFixed<NUMWORDS>(k[1], k[0], curve.param.r);
+  m = (NN_DIGIT)0 - ((k[0][KEY_BIT_LEN / NN_DIGIT_BITS] >> (KEY_BIT_LEN % NN_DIGIT_BITS)) & 1);
+  for(j = 0; j < NUMWORDS; j++) {
+    k[0][j] = (k[0][j] & m) | (k[1][j] & ~m);
+  }
+
+  xycz_idbl(&R[1], &R[0], P1);
+
+  /* R1 - R0 = P1 throughout, R[bit] takes the double */
+  swap = 0;
+  for(i = KEY_BIT_LEN - 1; i > 0; i--) {
+    bit = (k[0][i / NN_DIGIT_BITS] >> (i % NN_DIGIT_BITS)) & 1;
+    p_cswap(&R[0], &R[1], swap ^ bit);
+    swap = bit;
+    xycz_addc(&R[0], &R[1]);
+    xycz_add(&R[1], &R[0]);
+  }
+
+  bit = k[0][0] & 1;
+  p_cswap(&R[0], &R[1], swap ^ bit);
+  xycz_addc(&R[0], &R[1]);
+
+  /*
+   * 1/Z of the result = X_b * y / (x * Y_b * (X1 - X0)), R[0] holding
+   * R_b; X1 - X0 is R[1].x - R[0].x with its sign flipped when b = 1
+   */
+  fp_sub(z, R[1].x, R[0].x);
+  fp_sub(t, R[0].x, R[1].x);
+  m = (NN_DIGIT)0 - bit;
+  for(j = 0; j < NUMWORDS; j++) {
+    z[j] = (z[j] & ~m) | (t[j] & m);
+  }
+  fp_mul(z, z, R[0].y);
+  fp_mul(z, z, P1->x);
+  ecc_field_inv(z, z);
+  fp_mul(z, z, P1->y);
+  fp_mul(z, z, R[0].x);
+
+  xycz_add(&R[1], &R[0]);
+  p_cswap(&R[0], &R[1], bit);
+
+  /* x = X/Z^2, y = Y/Z^3 */
+  fp_sqr(t, z);
+  fp_mul(P0->x, R[0].x, t);
+  fp_mul(t, t, z);
+  fp_mul(P0->y, R[0].y, t);
+
+  /* 1 + 2r puts r * P1 in the ladder as well, the result is P1 */
+  for(j = 0; j < NUMWORDS; j++) {
+    P0->x[j] = (P0->x[j] & ~one) | (P1->x[j] & one);
+    P0->y[j] = (P0->y[j] & ~one) | (P1->y[j] & one);
+  }
+  NN_SubFixed<KEYDIGITS>(t, curve.param.p, P0->y);
+  for(j = 0; j < NUMWORDS; j++) {
+    P0->y[j] = (P0->y[j] & ~neg) | (t[j] & neg);
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+ecc_mul_base_regular(point_t * P0, NN_DIGIT * n)
+{
+#if ECC_COMB
+  ecc_comb_mul_regular(P0, n);
+#else
+  ecc_mul_regular(P0, &(curve.param.G), n);
+#endif
+}
+/*---------------------------------------------------------------------------*/
+void
+ecc_secret_mul_base(point_t * P0, NN_DIGIT * n)
+{
+#if ECC_REGULAR
+  ecc_mul_base_regular(P0, n);
+#else
+  ecc_win_mul_base(P0, n);
+#endif
+}
+/*---------------------------------------------------------------------------*/
+void
+ecc_secret_mul_base_x4(point_t * P0, NN_DIGIT n[][NUMWORDS])
+{
+#if ECC_REGULAR
+  uint8_t i;
+
+#ifdef ECC_COMB_X4
+  if(NN_X4Available()) {
+    ecc_comb_mul_x4_regular(P0, n);
+    return;
+  }
+#endif
+  for(i = 0; i < 4; i++) {
+    ecc_mul_base_regular(&P0[i], n[i]);
+  }
+#else
+  ecc_win_mul_base_x4(P0, n);
+#endif
 }
 /*---------------------------------------------------------------------------*/
-point_t *
+const point_t *
 ecc_get_base_p()
 {
-  return &(param.G);
+  return &(curve.param.G);
 }
 /*---------------------------------------------------------------------------*/
 void ecc_gen_pub_key(NN_DIGIT *priv_key, point_t * pub)
 {
-	ecc_win_mul(pub, priv_key, pBaseArray);
+	ecc_secret_mul_base(pub, priv_key);
 }
 /*---------------------------------------------------------------------------*/
 void ecc_gen_private_key(NN_DIGIT *PrivateKey)
@@ -678,8 +2402,8 @@ void ecc_gen_private_key(NN_DIGIT *PrivateKey)
   uint8_t ri;
   NN_DIGIT digit_mask;
 
-  order_bit_len = NN_Bits(param.r, NUMWORDS);
-  order_digit_len = NN_Digits(param.r, NUMWORDS);
+  order_bit_len = NN_Bits(curve.param.r, NUMWORDS);
+  order_digit_len = NN_Digits(curve.param.r, NUMWORDS);
 
   while (!done) {
 	  prng((uint8_t *)PrivateKey, order_digit_len * sizeof(NN_DIGIT));
@@ -692,7 +2416,7 @@ void ecc_gen_private_key(NN_DIGIT *PrivateKey)
           digit_mask = MAX_NN_DIGIT >> (NN_DIGIT_BITS - order_bit_len % NN_DIGIT_BITS);
           PrivateKey[order_digit_len - 1] = PrivateKey[order_digit_len - 1] & digit_mask;
         }
-      NN_ModSmall(PrivateKey, param.r, NUMWORDS);
+      NN_ModSmall(PrivateKey, curve.param.r, NUMWORDS);
 
       if (NN_Zero(PrivateKey, NUMWORDS) != 1) {
         done = TRUE;
@@ -18,6 +18,7 @@
 #define __ECC_H__
 
 #include "nn.h"
+#include "nn_x4.h"
 
 /**
  * The size of sliding window, must be power of 2 (change this if you
@@ -45,9 +46,172 @@
 #define NUM_MASKS (NN_DIGIT_BITS/W_BITS)
 
 /**
- * Number of points for precomputed points, NN_POINTS = 2^W_BITS - 1
+ * Signed-digit recoding for ecc_win_mul. The scalar is recoded to a width
+ * WNAF_BITS non-adjacent form: odd digits below 2^(WNAF_BITS-1) in absolute
+ * value, separated by at least WNAF_BITS-1 zeros. The precomputed array then
+ * holds the odd multiples P, 3P, 5P ... and a negative digit adds the
+ * negated point (x, p-y). Width 5 takes 8 points and one addition per 6 bits
+ * on average, the unsigned 4-bit window 15 points and one per 4.3 bits.
+ * Define ECC_WNAF to 0 for the unsigned W_BITS window.
  */
+#ifndef ECC_WNAF
+#define ECC_WNAF 1
+#endif
+
+#ifdef CONF_WNAF_BITS
+#define WNAF_BITS CONF_WNAF_BITS
+#else
+#define WNAF_BITS 5
+#endif
+
+#if ECC_WNAF && (WNAF_BITS < 2 || WNAF_BITS > 8)
+#error "WNAF_BITS must be in [2, 8]"
+#endif
+
+/**
+ * Number of points for precomputed points, NN_POINTS = 2^W_BITS - 1,
+ * or 2^(WNAF_BITS-2) odd multiples with ECC_WNAF
+ */
+#if ECC_WNAF
+#define NUM_POINTS (1 << (WNAF_BITS - 2))
+#else
 #define NUM_POINTS ((1 << W_BITS) - 1)
+#endif
+
+/**
+ * Fixed-base comb for the base point (Lim-Lee): ECC_COMB_BLOCKS tables of
+ * 2^ECC_COMB_TEETH - 1 affine multiples of G, kept as const data in
+ * secp256r1_comb.h. A base point multiplication then takes
+ * ECC_COMB_SPACING - 1 doublings and up to ECC_COMB_SPACING * ECC_COMB_BLOCKS
+ * mixed additions. The table takes ECC_COMB_BLOCKS * (2^ECC_COMB_TEETH - 1)
+ * * 64 bytes, e.g. 5/4 = 8 KB, 6/4 = 16 KB, 6/8 = 32 KB; regenerate it with
+ * tools/gen_comb_table.py after changing the teeth or blocks.
+ * Define ECC_COMB to 0 to use the window method on a RAM table instead.
+ */
+#ifndef ECC_COMB
+#if defined(SECP256R1) && !defined(__AVR__)
+#define ECC_COMB 1
+#else
+#define ECC_COMB 0
+#endif
+#endif
+
+#ifndef ECC_COMB_TEETH
+#define ECC_COMB_TEETH 6
+#endif
+
+#ifndef ECC_COMB_BLOCKS
+#define ECC_COMB_BLOCKS 4
+#endif
+
+#define ECC_COMB_SPACING \
+  ((KEY_BIT_LEN + ECC_COMB_TEETH * ECC_COMB_BLOCKS - 1) / (ECC_COMB_TEETH * ECC_COMB_BLOCKS))
+
+/**
+ * Point formulas. The default Jacobian formulas are the fastest but branch
+ * on the point at infinity, on equal inputs and on Z = 1, so their time
+ * depends on the points. Define ECC_COMPLETE to 1 for the complete formulas
+ * of Renes, Costello and Batina (Algorithms 4, 5 and 6 of "Complete addition
+ * formulas for prime order elliptic curves", a = -3) in homogeneous
+ * projective coordinate, x = X/Z, y = Y/Z: every addition and every doubling
+ * runs the same field operations whatever its inputs, at roughly half the
+ * speed of the Jacobian formulas. The point at infinity is (0:1:0).
+ * The scalar recodings still skip zero digits, so a whole multiplication
+ * keeps depending on the scalar, see ECC_REGULAR for that.
+ */
+#ifndef ECC_COMPLETE
+#define ECC_COMPLETE 0
+#endif
+
+#if ECC_COMPLETE && !defined(SECP256R1)
+#error "ECC_COMPLETE implements the a = -3 formulas of SECP256R1 only"
+#endif
+
+/**
+ * Multiplications by a secret scalar (ecc_gen_pub_key, the ECDSA nonce).
+ * By default they run on ecc_mul_base_regular, which takes the same steps
+ * and reads the same memory for every scalar: an always-add comb with
+ * ECC_COMB, otherwise the ladder of ecc_mul_regular. Define ECC_REGULAR to
+ * 0 for the variable-time ecc_win_mul_base, whose time depends on the
+ * scalar. Public scalars (ECDSA verification) always take the variable-time
+ * paths.
+ */
+#ifndef ECC_REGULAR
+#define ECC_REGULAR 1
+#endif
+
+/**
+ * ecc_win_mul_base_x4 runs a 4-way comb on the nn_x4 kernels where they are
+ * built (64-bit hosts), with the Jacobian formulas.
+ */
+#if defined(NN_X4_KERNELS) && ECC_COMB && !ECC_COMPLETE
+#define ECC_COMB_X4
+#endif
+
+/**
+ * Inversion algorithms, selected separately for the field prime p
+ * (ECC_FIELD_INV) and for the group order r (ECC_ORDER_INV):
+ * ECC_INV_EUCLID  - NN_ModInv, extended Euclid, any modulus
+ * ECC_INV_FERMAT  - NN_ModInvOpt, addition chain, the field prime only
+ * ECC_INV_SAFEGCD - NN_ModInvSafegcd, needs NN_HAVE_SAFEGCD (64-bit digits)
+ * The defaults are safegcd where available, otherwise Fermat for p and
+ * Euclid for r. With 16-bit digits the field products go through the omega
+ * loop, the 267 of the chain cost about ten Euclid inversions, p keeps
+ * Euclid as well.
+ */
+#define ECC_INV_EUCLID 0
+#define ECC_INV_FERMAT 1
+#define ECC_INV_SAFEGCD 2
+
+#ifndef ECC_FIELD_INV
+#ifdef NN_HAVE_SAFEGCD
+#define ECC_FIELD_INV ECC_INV_SAFEGCD
+#elif defined(SIXTEEN_BIT_PROCESSOR)
+#define ECC_FIELD_INV ECC_INV_EUCLID
+#else
+#define ECC_FIELD_INV ECC_INV_FERMAT
+#endif
+#endif
+
+#ifndef ECC_ORDER_INV
+#ifdef NN_HAVE_SAFEGCD
+#define ECC_ORDER_INV ECC_INV_SAFEGCD
+#else
+#define ECC_ORDER_INV ECC_INV_EUCLID
+#endif
+#endif
+
+/**
+ * Points ecc_batch_normalize converts with one inversion.
+ */
+#ifndef ECC_NORMALIZE_CHUNK
+#define ECC_NORMALIZE_CHUNK 16
+#endif
+
+/**
+ * ecc_twin_mul_base_batch runs its chains side by side in affine coordinate
+ * when ECC_BATCH_AFFINE is 1, ECC_BATCH_LANES of them at a time, every step
+ * sharing one field inversion among the chains (Montgomery's trick). An
+ * affine step then costs about seven multiplications and the share of the
+ * inversion, a Jacobian doubling eight and a mixed addition eleven: it pays
+ * off with safegcd, not with the Fermat chain. A chain takes about 450 bytes
+ * of stack with 64-bit digits.
+ */
+#ifndef ECC_BATCH_AFFINE
+#if ECC_WNAF && ECC_FIELD_INV == ECC_INV_SAFEGCD
+#define ECC_BATCH_AFFINE 1
+#else
+#define ECC_BATCH_AFFINE 0
+#endif
+#endif
+
+#ifndef ECC_BATCH_LANES
+#define ECC_BATCH_LANES 32
+#endif
+
+#if ECC_BATCH_AFFINE && !ECC_WNAF
+#error "ECC_BATCH_AFFINE needs ECC_WNAF"
+#endif
 
 /**
  * The data structure define the elliptic curve.
@@ -98,18 +262,70 @@ typedef struct curve_params {
 //    NN_DIGIT k[NUMWORDS];
 } curve_params_t;
 
+/**
+ * The curve context: the parameters and the tables built from them.
+ * ecc_init() fills the one shared context and nothing writes it afterwards.
+ * Every other value the ecc_* functions use is on the caller's stack or in
+ * an array the caller passes (pointArray), so once ecc_init() returned they
+ * can run in several threads or tasks at the same time.
+ */
+typedef struct ecc_ctx {
+    /** curve parameters */
+    curve_params_t param;
+
+#if !ECC_COMB
+    /** precomputed array for base point */
+    point_t pBaseArray[NUM_POINTS];
+#endif
+
+#ifdef ECC_COMB_X4
+    /** the comb table in the Montgomery form of nn_x4, if NN_X4Available() */
+    uint32_t comb_x4[ECC_COMB_BLOCKS][(1 << ECC_COMB_TEETH) - 1][2][NN_X4_LIMBS];
+#endif
+
+#if !ECC_WNAF
+    /** masks for sliding window method */
+    NN_DIGIT mask[NUM_MASKS];
+#endif
+} ecc_ctx_t;
+
 /**
  * \brief             Initialize parameters and basepoint array for
  *                    sliding window method. This function should be called first
  *                    before using other functions.
+ *                    The context is built on the first call only, later calls
+ *                    return immediately. Threads may call it together on
+ *                    targets with POSIX threads (host builds, ESP32).
  */
 void ecc_init();
 
+/**
+ * \brief             Returns nonzero once ecc_init() has built the curve context.
+ */
+int ecc_is_initialized();
+
+/**
+ * \brief             Returns the curve context, built on first use.
+ */
+const ecc_ctx_t * ecc_get_ctx(void);
+
 /**
  * \brief             Provide order of curve for the modules which need to know
  */
 void ecc_get_order(NN_DIGIT * order);
 
+/**
+ * \brief             Computes a = 1/b mod p using ECC_FIELD_INV
+ *                    a and b can be same
+ */
+void ecc_field_inv(NN_DIGIT *a, NN_DIGIT *b);
+
+/**
+ * \brief             Computes a = 1/b mod r using ECC_ORDER_INV
+ *                    a and b can be same
+ */
+void ecc_order_inv(NN_DIGIT *a, NN_DIGIT *b);
+
 /**
  * \brief             Point addition, P0 = P1 + P2
  */
@@ -136,12 +352,31 @@ void ecc_dbl_proj(point_t * P0, NN_DIGIT *Z0, point_t * P1, NN_DIGIT * Z1);
 void ecc_mul(point_t * P0, point_t * P1, NN_DIGIT * n);
 
 /**
- * \brief             Precompute the points for sliding window method
+ * \brief             Converts the points (P[i],Z[i]) from Jacobian (homogeneous
+ *                    with ECC_COMPLETE) to affine coordinate, sharing one inversion among up to
+ *                    ECC_NORMALIZE_CHUNK points (Montgomery's trick).
+ *                    Z[i] is set to one, a point at infinity (Z[i] = 0)
+ *                    becomes (0, 0).
+ */
+void ecc_batch_normalize(point_t * P, NN_DIGIT Z[][NUMWORDS], uint16_t n);
+
+/**
+ * \brief             Precompute the points for sliding window method,
+ *                    pointArray[i] = (i+1)*baseP, or (2i+1)*baseP with ECC_WNAF
  */
 void ecc_win_precompute(point_t * baseP, point_t * pointArray);
 
+/**
+ * \brief             ecc_win_precompute without the final conversion: the
+ *                    points stay in Jacobian coordinates, Z[i] being the Z of
+ *                    pointArray[i], so that several tables can share one
+ *                    ecc_batch_normalize.
+ */
+void ecc_win_precompute_proj(point_t * baseP, point_t * pointArray, NN_DIGIT Z[][NUMWORDS]);
+
 /**
  * \brief             Scalr point multiplication using slide window method
+ *                    (wNAF with ECC_WNAF)
  *                    P0 = n * Point, this Point may not be the base point of curve
  *                    pointArray is constructed by call win_precompute(Point, pointArray)
  */
@@ -154,16 +389,104 @@ void ecc_m_dbl_projective(point_t * P0, NN_DIGIT *Z0, uint8_t m);
 
 /**
  * \brief             Scalar point multiplication on basepoint, P0 = n * basepoint
- *                    using window method.
- *                    pointArray is array of basepoint,
+ *                    using the fixed-base comb when ECC_COMB is set, otherwise
+ *                    the window method on the precomputed array of basepoint,
  *                    pointArray[0] = basepoint, pointArray[1] = 2*basepoint ...
  */
 void ecc_win_mul_base(point_t * P0, NN_DIGIT * n);
 
 /**
- * \brief             Get base point
+ * \brief             Four scalar multiplications on basepoint,
+ *                    P0[i] = n[i] * basepoint, i < 4
+ *                    With ECC_COMB_X4 and a CPU that has the nn_x4 kernels
+ *                    the four share one comb pass, four field elements per
+ *                    vector operation, and one inversion. Otherwise
+ *                    ecc_win_mul_base four times.
+ */
+void ecc_win_mul_base_x4(point_t * P0, NN_DIGIT n[][NUMWORDS]);
+
+/**
+ * \brief             Double scalar multiplication on basepoint,
+ *                    P0 = u1 * basepoint + u2 * Point
+ *                    With ECC_WNAF both scalars share one doubling chain, u1
+ *                    on the fixed-base comb (or in wNAF on the basepoint
+ *                    array) and u2 in wNAF, and a single conversion to affine
+ *                    coordinate ends it.
+ *                    pointArray is constructed by call win_precompute(Point, pointArray)
+ */
+void ecc_twin_mul_base(point_t * P0, NN_DIGIT * u1, NN_DIGIT * u2, point_t * pointArray);
+
+/**
+ * \brief             ecc_twin_mul_base without the conversion to affine
+ *                    coordinate, (P0,Z0) = u1 * basepoint + u2 * Point in
+ *                    Jacobian coordinates (homogeneous with ECC_COMPLETE),
+ *                    Z0 = 0 for the point at infinity.
+ *                    For callers that normalize several points at once.
+ */
+void ecc_twin_mul_base_proj(point_t * P0, NN_DIGIT * Z0, NN_DIGIT * u1, NN_DIGIT * u2, point_t * pointArray);
+
+/**
+ * \brief             ecc_twin_mul_base for n pairs of scalars,
+ *                    P0[i] = u1[i] * basepoint + u2[i] * Point_i, where
+ *                    pointArray[i] is the table of Point_i. P0[i] is affine,
+ *                    inf[i] is set to 1 where it is the point at infinity, 0
+ *                    otherwise.
+ *                    With ECC_BATCH_AFFINE the chains run side by side,
+ *                    otherwise one after the other and the results share
+ *                    their conversion to affine coordinate.
+ */
+void ecc_twin_mul_base_batch(point_t * P0, uint8_t * inf, NN_DIGIT u1[][NUMWORDS], NN_DIGIT u2[][NUMWORDS],
+                             point_t ** pointArray, uint16_t n);
+
+/**
+ * \brief             Scalar point multiplication with a regular schedule,
+ *                    P0 = n * P1, 0 < n < r, P1 affine and not the point at
+ *                    infinity.
+ *                    Montgomery ladder on co-Z Jacobian coordinate: n is
+ *                    recoded to n + r or n + 2r, which has KEY_BIT_LEN + 1
+ *                    bits, and every bit costs one XYcZ-ADDC and one
+ *                    XYcZ-ADD, the points being swapped with masks. No
+ *                    branch and no memory access depends on n.
+ *                    About 1.5 times the cost of ecc_win_mul and 7 times
+ *                    that of the comb in ecc_win_mul_base.
+ */
+void ecc_mul_regular(point_t * P0, point_t * P1, NN_DIGIT * n);
+
+/**
+ * \brief             P0 = n * basepoint, 0 < n < r.
+ *                    With ECC_COMB the comb of ecc_win_mul_base made
+ *                    regular: every column runs one mixed addition, its
+ *                    result dropped with a mask when the column is empty,
+ *                    and every table entry of the block is read. About
+ *                    1.2 times the cost of the variable-time comb. The
+ *                    Jacobian formulas keep their branch on an addition
+ *                    that meets its own point, which a random scalar hits
+ *                    with negligible probability; ECC_COMPLETE removes it.
+ *                    Without ECC_COMB, ecc_mul_regular on the basepoint.
+ */
+void ecc_mul_base_regular(point_t * P0, NN_DIGIT * n);
+
+/**
+ * \brief             P0 = n * basepoint for a secret n,
+ *                    ecc_mul_base_regular with ECC_REGULAR, otherwise
+ *                    ecc_win_mul_base.
+ */
+void ecc_secret_mul_base(point_t * P0, NN_DIGIT * n);
+
+/**
+ * \brief             P0[i] = n[i] * basepoint for four secret n, i < 4,
+ *                    with ECC_REGULAR the regular comb four lanes at a time
+ *                    where ecc_win_mul_base_x4 runs the 4-way comb,
+ *                    otherwise ecc_mul_base_regular four times; without
+ *                    ECC_REGULAR, ecc_win_mul_base_x4.
+ */
+void ecc_secret_mul_base_x4(point_t * P0, NN_DIGIT n[][NUMWORDS]);
+
+/**
+ * \brief             Get base point, read only: it is part of the shared
+ *                    curve context.
  */
-point_t * ecc_get_base_p();
+const point_t * ecc_get_base_p(void);
 
 /**
  * \brief             Get the parameters of specific curve.
@@ -171,9 +494,11 @@ point_t * ecc_get_base_p();
 void get_curve_param(curve_params_t *para);
 
 /**
- * \brief             Get the current curve parameters.
+ * \brief             Get the current curve parameters, read only: they are
+ *                    part of the shared curve context. Callers that pass
+ *                    them to the NN_* functions work on a copy.
  */
-curve_params_t * ecc_get_param(void);
+const curve_params_t * ecc_get_param(void);
 
 /**
  * \brief             Compute a public key from a secret
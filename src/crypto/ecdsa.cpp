@@ -15,322 +15,928 @@
 #include "ecdsa.h"
 #include "prng.h"
 #include <stdlib.h>
+#if ECDSA_BATCH_THREADS > 1
+#include <pthread.h>
+#endif
+#if ECDSA_NONCE_POOL > 0
+#if defined(ESP32)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#define ECDSA_NONCE_FREERTOS
+#elif !defined(ARDUINO)
+#include <pthread.h>
+#define ECDSA_NONCE_PTHREAD
+#endif
+#endif
 
 #define TRUE 1
 #define FALSE 0
 
-//enable shamir trick
-//#define SHAMIR_TRICK
-
-#ifdef SHAMIR_TRICK
-/* The size of sliding window, S_W_BITS <= 8 */
-#define S_W_BITS 2
-
-/*
- * basic mask used to generate mask array
- * For example: if S_W_BITS is 2, BASIC_MASK must be 0x03;
- *              if S_W_BITS is 4, BASIC_MASK must be 0x0f;
- *              if S_W_BITS is 8, BASIC_MASK must be 0xff;
- */
-#define S_BASIC_MASK ((1 << S_W_BITS) - 1)
-
-/* number of windows in one digit, NUM_MASKS = NN_DIGIT_BITS/W_BITS */
-#define S_NUM_MASKS (NN_DIGIT_BITS/S_W_BITS)
-
-/* number of points for precomputed points, NN_POINTS = 2^W_BITS - 1 */
-#define S_NUM_POINTS ((1 << (2*S_W_BITS)) - 1)
-
-#define S_MAX ((1 << S_W_BITS) - 1)
-
-#endif /* SHAMIR_TRICK */
-
+/* the context of ecdsa_init and ecdsa_verify */
+static ecdsa_verify_ctx_t verify_ctx;
 
+#if ECDSA_NONCE_POOL > 0
+static uint8_t nonce_take(NN_DIGIT *k_inv, NN_DIGIT *r);
+#endif
 
-#ifdef SHAMIR_TRICK
-static point_t pqBaseArray[S_NUM_POINTS];
-static NN_DIGIT s_mask[S_NUM_MASKS];
-static curve_params_t* param;
-#else /* defined(SLIDING_WIN) */
-/* precomputed array of public key(used in verification) for
- * sliding window method.
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Clears len bytes at p, through a volatile pointer so
+ *                    the stores are not dropped as dead.
  */
-static point_t qBaseArray[NUM_POINTS];
-#endif /* SHAMIR_TRICK */
-
-static NN_DIGIT order[NUMWORDS];
+static void
+ecdsa_wipe(void *p, size_t len)
+{
+  volatile uint8_t *v = (volatile uint8_t *)p;
 
+  while(len--) {
+    *v++ = 0;
+  }
+}
 
 /*---------------------------------------------------------------------------*/
-#ifdef SHAMIR_TRICK
-static point_t * baseP;
 /**
- * \brief             Shamir trick init.
+ * \brief             Checks r and s, returns 0 if both are in [1, ord-1],
+ *                    otherwise the ecdsa_verify error code.
  */
-static void
-shamir_init(point_t * pKey, point_t * pointArray)
+static uint8_t
+ecdsa_check_rs(NN_DIGIT *r, NN_DIGIT *s, NN_DIGIT *ord)
 {
-  uint16_t i;
-  uint16_t j;
-
-  baseP = ecc_get_base_p();
-
-  /* max = 2^w-1
-   * [0] = Q
-   * [1] = 2Q
-   * ...
-   * [max-1] = max*Q
-   */
-  NN_Assign(pointArray[0].x, pKey->x, NUMWORDS);
-  NN_Assign(pointArray[0].y, pKey->y, NUMWORDS);
-
-  for(i=1; i<S_MAX; i++) {
-    ecc_add(&(pointArray[i]), &(pointArray[i-1]), pKey);
-  }
-
-  /*
-   * [max] = P
-   * [max+1] = P+Q
-   * ...
-   * [max+max] = P+max*Q
-   * [max+max+1] = 2P
-   * [max+max+2] = 2P+Q
-   * ...
-   * [max+2*max+1] = 2P+max*Q
-   * ...
-   */
-  for(i = 0; i < S_MAX; i++) {
-    for(j = 0; j<S_MAX+1; j++) {
-      if(i == 0 && j==0) {
-        NN_Assign(pointArray[S_MAX].x, baseP->x, NUMWORDS);
-	      NN_Assign(pointArray[S_MAX].y, baseP->y, NUMWORDS);
-      } else if(j==0) {
-        ecc_add(&(pointArray[S_MAX+(S_MAX+1)*i]),
-                &(pointArray[S_MAX+(S_MAX+1)*(i-1)]),
-                baseP);
-      }else{
-        ecc_add(&(pointArray[S_MAX+(S_MAX+1)*i+j]),
-                &(pointArray[S_MAX+(S_MAX+1)*i]),
-                &(pointArray[j-1]));
-      }
-    }
+  /* r and s should be in [1, p-1] */
+  if((NN_Cmp(r, ord, NUMWORDS)) >= 0) {
+    return 3;
   }
-
-  for(i = 0; i < S_NUM_MASKS; i++) {
-    s_mask[i] = S_BASIC_MASK << (S_W_BITS*i);
+  if((NN_Zero(r, NUMWORDS)) == 1) {
+    return 4;
+  }
+  if((NN_Cmp(s, ord, NUMWORDS)) >= 0) {
+    return 5;
+  }
+  if((NN_Zero(s, NUMWORDS)) == 1) {
+    return 6;
   }
+  return 0;
 }
 /*---------------------------------------------------------------------------*/
 /**
- * \brief             Shamir trick
- *
+ * \brief             digest = the hash as an integer mod ord
  */
 static void
-shamir(point_t * P0, NN_DIGIT * u1, NN_DIGIT * u2)
+ecdsa_digest(NN_DIGIT *digest, uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *ord, nn_barrett_t *red)
 {
-  int16_t i, tmp, tmp2;
-  int8_t j, k;
-  NN_DIGIT windex;
-  NN_DIGIT Z0[NUMWORDS];
-  NN_DIGIT Z1[NUMWORDS];
-
-  /* clear point */
-  NN_AssignZero(P0->x, NUMWORDS);
-  NN_AssignZero(P0->y, NUMWORDS);
-
-  /* convert to Jprojective coordinate */
-  NN_AssignZero(Z0, NUMWORDS);
-  NN_AssignZero(Z1, NUMWORDS);
-  Z1[0] = 0x01;
-
-  tmp = NN_Digits(u1, NUMWORDS);
-  tmp2 = NN_Digits(u2, NUMWORDS);
-  if(tmp2 > tmp) {
-    tmp = tmp2;
-  }
-
-  for(i = tmp - 1; i >= 0; i--) {
-    for(j = NN_DIGIT_BITS/S_W_BITS - 1; j >= 0; j--) {
-      for(k = 0; k < S_W_BITS; k++) {
-        ecc_dbl_proj(P0, Z0, P0, Z0);
-      }
+  NN_DIGIT sha256tmp[SHA256_DIGEST_LENGTH/NN_DIGIT_LEN];
+  NN_UINT result_bit_len;
+  NN_UINT order_bit_len;
 
-      if(j != 0) {
-        windex = ((s_mask[j] & u1[i]) >> ((j-1)*S_W_BITS)) |
-                 ((s_mask[j] & u2[i]) >> (j*S_W_BITS));
-      } else {
-        windex = ((s_mask[j] & u1[i]) << S_W_BITS) |
-                 (s_mask[j] & u2[i]);
-      }
-      if(windex) {
-        ecc_add_proj(P0, Z0, P0, Z0, &(pqBaseArray[windex-1]), Z1);
-      }
-    }
+  memset(digest, 0, NUMBYTES);
+  NN_Decode(sha256tmp, SHA256_DIGEST_LENGTH/NN_DIGIT_LEN, sha256sum, SHA256_DIGEST_LENGTH);
 
+  result_bit_len = NN_Bits(sha256tmp, SHA256_DIGEST_LENGTH / NN_DIGIT_LEN);
+  order_bit_len = NN_Bits(ord, NUMWORDS);
+  if (result_bit_len > order_bit_len) {
+      NN_BarrettMod(digest, sha256tmp, SHA256_DIGEST_LENGTH/NN_DIGIT_LEN, red, NUMWORDS);
+  } else {
+      NN_Assign(digest, sha256tmp, SHA256_DIGEST_LENGTH / NN_DIGIT_LEN);
+      if (result_bit_len == order_bit_len) {
+          NN_ModSmall(digest, ord, NUMWORDS);
+      }
   }
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Returns 1 if x mod ord equals r, otherwise 2
+ */
+static uint8_t
+ecdsa_check_x(NN_DIGIT *x, NN_DIGIT *r, NN_DIGIT *ord, nn_barrett_t *red)
+{
+  NN_DIGIT v[NUMWORDS];
+  NN_UINT result_bit_len;
+  NN_UINT order_bit_len;
 
+  result_bit_len = NN_Bits(x, NUMWORDS);
+  order_bit_len = NN_Bits(ord, NUMWORDS);
 
-  /* convert back to affine coordinate */
-  if(NN_One(Z0, NUMWORDS) == FALSE) {
-    NN_ModInv(Z1, Z0, param->p, NUMWORDS);
-    NN_ModMultOpt(Z0, Z1, Z1, param->p, param->omega, NUMWORDS);
-    NN_ModMultOpt(P0->x, P0->x, Z0, param->p, param->omega, NUMWORDS);
-    NN_ModMultOpt(Z0, Z0, Z1, param->p, param->omega, NUMWORDS);
-    NN_ModMultOpt(P0->y, P0->y, Z0, param->p, param->omega, NUMWORDS);
+  if (result_bit_len > order_bit_len) {
+      NN_BarrettMod(v, x, NUMWORDS, red, NUMWORDS);
+  } else {
+      NN_Assign(v, x, NUMWORDS);
+      if (result_bit_len == order_bit_len) {
+          NN_ModSmall(v, ord, NUMWORDS);
+      }
   }
 
+  if((NN_Cmp(v, r, NUMWORDS)) == 0) {
+    return 1;
+  } else {
+    return 2;
+  }
 }
-#endif /* SHAMIR_TRICK */
 /*---------------------------------------------------------------------------*/
 void
 ecdsa_init(point_t * pb_key)
 {
-#ifdef SHAMIR_TRICK
-  param = ecc_get_param();
-  shamir_init(pb_key, pqBaseArray);
-#else /* defined(SLIDING_WIN) */
+  ecdsa_verify_ctx_init(&verify_ctx, pb_key);
+}
+/*---------------------------------------------------------------------------*/
+void
+ecdsa_verify_ctx_init(ecdsa_verify_ctx_t * ctx, point_t * pb_key)
+{
+  ecc_init();
+
   /* precompute the array of public key for sliding window method */
-  ecc_win_precompute(pb_key, qBaseArray);
-#endif /* SHAMIR_TRICK */
+  ecc_win_precompute(pb_key, ctx->qBaseArray);
   /* we need to know param->r */
-  ecc_get_order(order);
+  ecc_get_order(ctx->order);
+  NN_BarrettInit(&ctx->order_red, ctx->order, NUMWORDS);
 }
 
+/*---------------------------------------------------------------------------*/
+void
+ecdsa_sign_ctx_init(ecdsa_sign_ctx_t * ctx, NN_DIGIT * pr_key)
+{
+  /* signing needs the base point table only */
+  ecc_init();
+
+  NN_Assign(ctx->d, pr_key, NUMWORDS);
+  ecc_get_order(ctx->order);
+  NN_BarrettInit(&ctx->order_red, ctx->order, NUMWORDS);
+}
 /*---------------------------------------------------------------------------*/
 void
 ecdsa_sign(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, NN_DIGIT *d)
 {
+  ecdsa_sign_ctx_t ctx;
 
-  char done = FALSE;
+  ecdsa_sign_ctx_init(&ctx, d);
+  ecdsa_sign_with_ctx(sha256sum, r, s, &ctx);
+
+  /* the context holds a copy of the private key */
+  ecdsa_wipe(&ctx, sizeof(ctx));
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Picks the nonce of a signature: k_inv = k^-1 mod ord and
+ *                    r = (k*G).x mod ord, from the pool when it has a pair.
+ *                    Returns 0 if k has to be drawn again.
+ */
+static uint8_t
+ecdsa_nonce(NN_DIGIT *k_inv, NN_DIGIT *r, NN_DIGIT *ord)
+{
   NN_DIGIT k[NUMWORDS];
-  NN_DIGIT k_inv[NUMWORDS];
-  NN_DIGIT tmp[NUMWORDS];
-  NN_DIGIT digest[NUMWORDS];
   point_t P;
-  NN_DIGIT sha256tmp[SHA256_DIGEST_LENGTH/NN_DIGIT_LEN];
-  NN_UINT result_bit_len;
-  NN_UINT order_bit_len;
+  uint8_t ok = 0;
 
-  while(!done) {
-    ecc_gen_private_key(k);
+#if ECDSA_NONCE_POOL > 0
+  if(nonce_take(k_inv, r)) {
+    return 1;
+  }
+#endif
 
-    if((NN_Zero(k, NUMWORDS)) == 1) {
-      continue;
-    }
+  ecc_gen_private_key(k);
 
-    ecc_win_mul_base(&P, k);
+  if((NN_Zero(k, NUMWORDS)) != 1) {
+    ecc_secret_mul_base(&P, k);
 
-    NN_Mod(r, P.x, NUMWORDS, order, NUMWORDS);
+    /* x < p < 2r, at most one subtraction */
+    NN_Assign(r, P.x, NUMWORDS);
+    NN_ModSmall(r, ord, NUMWORDS);
 
-    if((NN_Zero(r, NUMWORDS)) == 1) {
-	    continue;
+    if((NN_Zero(r, NUMWORDS)) != 1) {
+      ecc_order_inv(k_inv, k);
+      ok = 1;
     }
-    NN_ModInv(k_inv, k, order, NUMWORDS);
+  }
 
-    NN_Decode(sha256tmp, SHA256_DIGEST_LENGTH/NN_DIGIT_LEN, sha256sum, SHA256_DIGEST_LENGTH);
+  ecdsa_wipe(k, sizeof(k));
+  ecdsa_wipe(&P, sizeof(P));
+  return ok;
+}
+/*---------------------------------------------------------------------------*/
+void
+ecdsa_sign_with_ctx(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, ecdsa_sign_ctx_t * ctx)
+{
 
-    result_bit_len = NN_Bits(sha256tmp, SHA256_DIGEST_LENGTH / NN_DIGIT_LEN);
-    order_bit_len = NN_Bits(order, NUMWORDS);
+  char done = FALSE;
+  NN_DIGIT k_inv[NUMWORDS];
+  NN_DIGIT tmp[NUMWORDS];
+  NN_DIGIT digest[NUMWORDS];
 
-    if (result_bit_len > order_bit_len) {
-        NN_Mod(digest, sha256tmp, SHA256_DIGEST_LENGTH/NN_DIGIT_LEN, order, NUMWORDS);
+  ecdsa_digest(digest, sha256sum, ctx->order, &ctx->order_red);
 
-    } else
-    {
-        memset(digest, 0, NUMBYTES);
-        NN_Assign(digest, sha256tmp, SHA256_DIGEST_LENGTH / NN_DIGIT_LEN);
-        if (result_bit_len == order_bit_len) {
-            NN_ModSmall(digest, order, NUMWORDS);
-        }
+  while(!done) {
+    if(!ecdsa_nonce(k_inv, r, ctx->order)) {
+      continue;
     }
 
-    NN_ModMult(k, d, r, order, NUMWORDS);
-    NN_ModAdd(tmp, digest, k, order, NUMWORDS);
-    NN_ModMult(s, k_inv, tmp, order, NUMWORDS);
+    NN_BarrettModMult(tmp, ctx->d, r, &ctx->order_red, NUMWORDS);
+    NN_ModAdd(tmp, digest, tmp, ctx->order, NUMWORDS);
+    NN_BarrettModMult(s, k_inv, tmp, &ctx->order_red, NUMWORDS);
     if((NN_Zero(s, NUMWORDS)) != 1) {
 	    done = TRUE;
     }
   }
 
+  /* a nonce is used once, no copy of it stays behind */
+  ecdsa_wipe(k_inv, sizeof(k_inv));
+  ecdsa_wipe(tmp, sizeof(tmp));
 }
 /*---------------------------------------------------------------------------*/
 uint8_t
 ecdsa_verify(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, point_t *Q)
 {
-  NN_DIGIT sha256tmp[SHA256_DIGEST_LENGTH/NN_DIGIT_LEN];
+  return ecdsa_verify_with_ctx(sha256sum, r, s, &verify_ctx);
+}
+/*---------------------------------------------------------------------------*/
+uint8_t
+ecdsa_verify_with_ctx(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, ecdsa_verify_ctx_t * ctx)
+{
   NN_DIGIT w[NUMWORDS];
   NN_DIGIT u1[NUMWORDS];
   NN_DIGIT u2[NUMWORDS];
   NN_DIGIT digest[NUMWORDS];
-#ifndef SHAMIR_TRICK
-  point_t u1P, u2Q;
-#endif
   point_t final;
-  NN_UINT result_bit_len;
-  NN_UINT order_bit_len;
+  uint8_t result;
 
-  /* r and s should be in [1, p-1] */
-  if((NN_Cmp(r, order, NUMWORDS)) >= 0) {
-    return 3;
+  result = ecdsa_check_rs(r, s, ctx->order);
+  if(result) {
+    return result;
   }
-  if((NN_Zero(r, NUMWORDS)) == 1) {
-    return 4;
+
+  /* w = s^-1 mod p */
+  ecc_order_inv(w, s);
+
+  ecdsa_digest(digest, sha256sum, ctx->order, &ctx->order_red);
+
+  /* u1 = ew mod p */
+  NN_BarrettModMult(u1, digest, w, &ctx->order_red, NUMWORDS);
+  /* u2 = rw mod p */
+  NN_BarrettModMult(u2, r, w, &ctx->order_red, NUMWORDS);
+
+  /* u1P+u2Q */
+  ecc_twin_mul_base(&final, u1, u2, ctx->qBaseArray);
+
+  return ecdsa_check_x(final.x, r, ctx->order, &ctx->order_red);
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Batch verification. Signatures are verified in groups of
+ * ECDSA_BATCH_SIZE: the s of a group are inverted together and
+ * ecc_twin_mul_base_batch computes the points u1*G + u2*Q of the group
+ * together, Montgomery's trick turning k inversions into one inversion and
+ * 3(k-1) multiplications.
+ */
+typedef struct batch_job {
+  uint16_t n;
+  uint8_t (*digests)[SHA256_DIGEST_LENGTH];
+  NN_DIGIT (*r)[NUMWORDS];
+  NN_DIGIT (*s)[NUMWORDS];
+  point_t * keys;
+  uint8_t * results;
+  NN_DIGIT * ord;
+  nn_barrett_t * red;
+} batch_job_t;
+
+/**
+ * \brief             a[i] = 1/a[i] mod the order for the items with
+ *                    results[i] == 0. pre is scratch of the same size as a.
+ */
+static void
+batch_inv(NN_DIGIT a[][NUMWORDS], NN_DIGIT pre[][NUMWORDS], uint8_t * results, uint16_t n,
+          nn_barrett_t * red)
+{
+  NN_DIGIT t[NUMWORDS];
+  NN_DIGIT ai[NUMWORDS];
+  int16_t i, last, prev;
+
+  /* pre[i] = product of a[j], j <= i */
+  last = -1;
+  for(i = 0; i < n; i++) {
+    if(results[i]) {
+      continue;
+    }
+    if(last < 0) {
+      NN_Assign(pre[i], a[i], NUMWORDS);
+    } else {
+      NN_BarrettModMult(pre[i], pre[last], a[i], red, NUMWORDS);
+    }
+    last = i;
   }
-  if((NN_Cmp(s, order, NUMWORDS)) >= 0) {
-    return 5;
+  if(last < 0) {
+    return;
   }
-  if((NN_Zero(s, NUMWORDS)) == 1) {
-    return 6;
+
+  ecc_order_inv(t, pre[last]);
+
+  /* walk back, t = 1/pre[i] */
+  for(i = last; i >= 0; i = prev) {
+    for(prev = i - 1; prev >= 0 && results[prev]; prev--);
+
+    if(prev < 0) {
+      NN_Assign(a[i], t, NUMWORDS);
+    } else {
+      NN_BarrettModMult(ai, t, pre[prev], red, NUMWORDS);
+      NN_BarrettModMult(t, t, a[i], red, NUMWORDS);
+      NN_Assign(a[i], ai, NUMWORDS);
+    }
   }
+}
 
-  /* w = s^-1 mod p */
-  NN_ModInv(w, s, order, NUMWORDS);
+/*
+ * Tables of the public keys a worker has met, replaced in turn. The tables
+ * a group adds take the slots from next on and are converted to affine
+ * coordinates together.
+ */
+typedef struct batch_keys {
+  point_t table[ECDSA_BATCH_KEYS][NUM_POINTS];
+  point_t * key[ECDSA_BATCH_KEYS];
+  uint8_t next;
+} batch_keys_t;
 
-  memset(digest, 0, NUMBYTES);
-  NN_Decode(sha256tmp, SHA256_DIGEST_LENGTH/NN_DIGIT_LEN, sha256sum, SHA256_DIGEST_LENGTH);
+/**
+ * \brief             Slot of the table of Q in keys, -1 if it has none.
+ */
+static int8_t
+batch_key_find(batch_keys_t * keys, point_t * Q)
+{
+  uint8_t j;
 
-  result_bit_len = NN_Bits(sha256tmp, SHA256_DIGEST_LENGTH / NN_DIGIT_LEN);
-  order_bit_len = NN_Bits(order, NUMWORDS);
-  if (result_bit_len > order_bit_len) {
-      NN_Mod(digest, sha256tmp, SHA256_DIGEST_LENGTH/NN_DIGIT_LEN, order, NUMWORDS);
-  } else {
-      NN_Assign(digest, sha256tmp, SHA256_DIGEST_LENGTH / NN_DIGIT_LEN);
-      if (result_bit_len == order_bit_len) {
-          NN_ModSmall(digest, order, NUMWORDS);
+  for(j = 0; j < ECDSA_BATCH_KEYS; j++) {
+    if(keys->key[j] != NULL &&
+       NN_Cmp(keys->key[j]->x, Q->x, NUMWORDS) == 0 &&
+       NN_Cmp(keys->key[j]->y, Q->y, NUMWORDS) == 0) {
+      return j;
+    }
+  }
+  return -1;
+}
+
+/**
+ * \brief             Builds the tables of the fresh slots from keys->next on,
+ *                    sharing the inversions among them.
+ */
+static void
+batch_key_build(batch_keys_t * keys, uint8_t fresh)
+{
+  NN_DIGIT Z[ECDSA_BATCH_KEYS][NUM_POINTS][NUMWORDS];
+  uint8_t j, run;
+
+  if(fresh == 0) {
+    return;
+  }
+
+  for(j = 0; j < fresh; j++) {
+    run = (keys->next + j) % ECDSA_BATCH_KEYS;
+    ecc_win_precompute_proj(keys->key[run], keys->table[run], Z[run]);
+  }
+
+  /* the slots are consecutive but for one wrap around */
+  run = ECDSA_BATCH_KEYS - keys->next;
+  if(run > fresh) {
+    run = fresh;
+  }
+  ecc_batch_normalize(keys->table[keys->next], Z[keys->next], run * NUM_POINTS);
+  if(fresh > run) {
+    ecc_batch_normalize(keys->table[0], Z[0], (fresh - run) * NUM_POINTS);
+  }
+
+  keys->next = (keys->next + fresh) % ECDSA_BATCH_KEYS;
+}
+
+/**
+ * \brief             Verifies the signatures [first, first+n) of job,
+ *                    n <= ECDSA_BATCH_SIZE, or the first of them when their
+ *                    keys need more tables than keys can hold at once.
+ * \return            Number of signatures verified, at least one.
+ */
+static uint16_t
+batch_group(batch_job_t * job, uint16_t first, uint16_t n, batch_keys_t * keys)
+{
+  NN_DIGIT w[ECDSA_BATCH_SIZE][NUMWORDS];
+  NN_DIGIT pre[ECDSA_BATCH_SIZE][NUMWORDS];
+  NN_DIGIT u1[ECDSA_BATCH_SIZE][NUMWORDS];
+  NN_DIGIT u2[ECDSA_BATCH_SIZE][NUMWORDS];
+  point_t R[ECDSA_BATCH_SIZE];
+  point_t * table[ECDSA_BATCH_SIZE];
+  uint8_t slot[ECDSA_BATCH_SIZE];
+  uint16_t live[ECDSA_BATCH_SIZE];
+  uint8_t inf[ECDSA_BATCH_SIZE];
+  uint8_t busy[ECDSA_BATCH_KEYS];
+  NN_DIGIT digest[NUMWORDS];
+  uint8_t * results = job->results + first;
+  uint8_t fresh = 0;
+  uint16_t i, k, m;
+  int8_t j;
+
+  memset(busy, 0, sizeof(busy));
+  for(i = 0; i < n; i++) {
+    k = first + i;
+    results[i] = ecdsa_check_rs(job->r[k], job->s[k], job->ord);
+    if(results[i]) {
+      continue;
+    }
+
+    j = batch_key_find(keys, &(job->keys[k]));
+    if(j < 0) {
+      /* the next slot in turn, unless this group still needs its table */
+      j = (keys->next + fresh) % ECDSA_BATCH_KEYS;
+      if(busy[j]) {
+        break;
       }
+      keys->key[j] = &(job->keys[k]);
+      fresh++;
+    }
+    busy[j] = 1;
+    slot[i] = j;
+    NN_Assign(w[i], job->s[k], NUMWORDS);
   }
+  n = i;
 
-  /* u1 = ew mod p */
-  NN_ModMult(u1, digest, w, order, NUMWORDS);
-  /* u2 = rw mod p */
-  NN_ModMult(u2, r, w, order, NUMWORDS);
+  batch_key_build(keys, fresh);
 
-  /* u1P+u2Q */
-#ifdef SHAMIR_TRICK
-  shamir(&final, u1, u2);
+  /* w = s^-1 mod r */
+  batch_inv(w, pre, results, n, job->red);
+
+  /* u1 = e*w and u2 = r*w of the m signatures still in */
+  m = 0;
+  for(i = 0; i < n; i++) {
+    if(results[i]) {
+      continue;
+    }
+    k = first + i;
+
+    ecdsa_digest(digest, job->digests[k], job->ord, job->red);
+    NN_BarrettModMult(u1[m], digest, w[i], job->red, NUMWORDS);
+    NN_BarrettModMult(u2[m], job->r[k], w[i], job->red, NUMWORDS);
+    table[m] = keys->table[slot[i]];
+    live[m] = i;
+    m++;
+  }
+
+  ecc_twin_mul_base_batch(R, inf, u1, u2, table, m);
+
+  for(k = 0; k < m; k++) {
+    i = live[k];
+    if(inf[k]) {
+      /* u1*G + u2*Q is the point at infinity */
+      results[i] = 2;
+    } else {
+      results[i] = ecdsa_check_x(R[k].x, job->r[first + i], job->ord, job->red);
+    }
+  }
+
+  return n;
+}
+
+/**
+ * \brief             Verifies every group of job.
+ */
+static void *
+batch_worker(void * arg)
+{
+  batch_job_t * job = (batch_job_t *)arg;
+  batch_keys_t keys;
+  uint16_t first, n;
+  uint8_t j;
+
+  for(j = 0; j < ECDSA_BATCH_KEYS; j++) {
+    keys.key[j] = NULL;
+  }
+  keys.next = 0;
+
+  for(first = 0; first < job->n; first += n) {
+    n = job->n - first;
+    if(n > ECDSA_BATCH_SIZE) {
+      n = ECDSA_BATCH_SIZE;
+    }
+    n = batch_group(job, first, n, &keys);
+  }
+
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+uint16_t
+ecdsa_verify_batch(uint16_t n, uint8_t digests[][SHA256_DIGEST_LENGTH], NN_DIGIT r[][NUMWORDS], NN_DIGIT s[][NUMWORDS], point_t * keys, uint8_t * results)
+{
+  NN_DIGIT ord[NUMWORDS];
+  nn_barrett_t red;
+  batch_job_t jobs[ECDSA_BATCH_THREADS];
+#if ECDSA_BATCH_THREADS > 1
+  pthread_t threads[ECDSA_BATCH_THREADS];
+  char started[ECDSA_BATCH_THREADS];
+  uint16_t per;
+#endif
+  uint16_t i, verified;
+
+  /* single threaded, builds the shared curve context */
+  ecc_init();
+  ecc_get_order(ord);
+  NN_BarrettInit(&red, ord, NUMWORDS);
+
+  for(i = 0; i < ECDSA_BATCH_THREADS; i++) {
+    jobs[i].n = 0;
+    jobs[i].digests = digests;
+    jobs[i].r = r;
+    jobs[i].s = s;
+    jobs[i].keys = keys;
+    jobs[i].results = results;
+    jobs[i].ord = ord;
+    jobs[i].red = &red;
+  }
+
+#if ECDSA_BATCH_THREADS > 1
+  /* whole groups per thread, the calling thread takes the first share */
+  per = (n + ECDSA_BATCH_THREADS - 1) / ECDSA_BATCH_THREADS;
+  per = (per + ECDSA_BATCH_SIZE - 1) / ECDSA_BATCH_SIZE * ECDSA_BATCH_SIZE;
+  for(i = 0; i < ECDSA_BATCH_THREADS; i++) {
+    uint16_t first = (uint32_t)i * per < n ? i * per : n;
+
+    jobs[i].n = n - first < per ? n - first : per;
+    jobs[i].digests = digests + first;
+    jobs[i].r = r + first;
+    jobs[i].s = s + first;
+    jobs[i].keys = keys + first;
+    jobs[i].results = results + first;
+  }
+
+  for(i = 1; i < ECDSA_BATCH_THREADS; i++) {
+    started[i] = jobs[i].n > 0 &&
+                 pthread_create(&threads[i], NULL, batch_worker, &jobs[i]) == 0;
+  }
+  batch_worker(&jobs[0]);
+  for(i = 1; i < ECDSA_BATCH_THREADS; i++) {
+    if(started[i]) {
+      pthread_join(threads[i], NULL);
+    } else if(jobs[i].n > 0) {
+      /* no thread for this share, verify it here */
+      batch_worker(&jobs[i]);
+    }
+  }
 #else
-  ecc_win_mul_base(&u1P, u1);
-  ecc_win_mul(&u2Q, u2, qBaseArray);
-  ecc_add(&final, &u1P, &u2Q);
+  jobs[0].n = n;
+  batch_worker(&jobs[0]);
 #endif
 
-  result_bit_len = NN_Bits(final.x, NUMWORDS);
-  order_bit_len = NN_Bits(order, NUMWORDS);
+  verified = 0;
+  for(i = 0; i < n; i++) {
+    if(results[i] == 1) {
+      verified++;
+    }
+  }
+  return verified;
+}
 
-  if (result_bit_len > order_bit_len) {
-      NN_Mod(w, final.x, NUMWORDS, order, NUMWORDS);
-  } else {
-      NN_Assign(w, final.x, NUMWORDS);
-      if (result_bit_len == order_bit_len) {
-          NN_ModSmall(w, order, NUMWORDS);
+/*---------------------------------------------------------------------------*/
+void
+ecdsa_sign_x4(uint8_t sha256sum[][SHA256_DIGEST_LENGTH], NN_DIGIT r[][NUMWORDS], NN_DIGIT s[][NUMWORDS], ecdsa_sign_ctx_t * ctx)
+{
+  NN_DIGIT k[4][NUMWORDS];
+  NN_DIGIT pre[4][NUMWORDS];
+  NN_DIGIT tmp[NUMWORDS];
+  NN_DIGIT digest[NUMWORDS];
+  uint8_t skip[4];
+  point_t P[4];
+  uint8_t i;
+
+  for(i = 0; i < 4; i++) {
+    ecc_gen_private_key(k[i]);
+  }
+  ecc_secret_mul_base_x4(P, k);
+
+  for(i = 0; i < 4; i++) {
+    /* x < p < 2r, at most one subtraction */
+    NN_Assign(r[i], P[i].x, NUMWORDS);
+    NN_ModSmall(r[i], ctx->order, NUMWORDS);
+    skip[i] = NN_Zero(r[i], NUMWORDS);
+  }
+
+  /* k = k^-1 mod r */
+  batch_inv(k, pre, skip, 4, &ctx->order_red);
+
+  for(i = 0; i < 4; i++) {
+    if(!skip[i]) {
+      ecdsa_digest(digest, sha256sum[i], ctx->order, &ctx->order_red);
+      NN_BarrettModMult(tmp, ctx->d, r[i], &ctx->order_red, NUMWORDS);
+      NN_ModAdd(tmp, digest, tmp, ctx->order, NUMWORDS);
+      NN_BarrettModMult(s[i], k[i], tmp, &ctx->order_red, NUMWORDS);
+      skip[i] = NN_Zero(s[i], NUMWORDS);
+    }
+    if(skip[i]) {
+      /* r or s came out zero, this one takes another nonce */
+      ecdsa_sign_with_ctx(sha256sum[i], r[i], s[i], ctx);
+    }
+  }
+
+  /* a nonce is used once, no copy of it stays behind */
+  ecdsa_wipe(k, sizeof(k));
+  ecdsa_wipe(pre, sizeof(pre));
+  ecdsa_wipe(tmp, sizeof(tmp));
+  ecdsa_wipe(P, sizeof(P));
+}
+
+#if ECDSA_NONCE_POOL > 0
+/*---------------------------------------------------------------------------*/
+/* Nonce pool: a ring of prepared (k^-1, r) pairs. Pairs leave the ring once
+ * and their slot is wiped on the way out.
+ */
+typedef struct nonce_pair {
+  NN_DIGIT k_inv[NUMWORDS];
+  NN_DIGIT r[NUMWORDS];
+} nonce_pair_t;
+
+static nonce_pair_t nonce_ring[ECDSA_NONCE_POOL];
+static uint8_t nonce_head;
+static uint8_t nonce_count;
+static uint8_t nonce_running;
+
+static NN_DIGIT nonce_order[NUMWORDS];
+static nn_barrett_t nonce_red;
+static uint8_t nonce_ready;
+
+#if defined(ECDSA_NONCE_FREERTOS)
+static portMUX_TYPE nonce_mux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t nonce_task = NULL;
+static volatile uint8_t nonce_task_done;
+#define NONCE_LOCK()    portENTER_CRITICAL(&nonce_mux)
+#define NONCE_UNLOCK()  portEXIT_CRITICAL(&nonce_mux)
+#elif defined(ECDSA_NONCE_PTHREAD)
+static pthread_mutex_t nonce_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t nonce_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t nonce_thread;
+#define NONCE_LOCK()    pthread_mutex_lock(&nonce_mutex)
+#define NONCE_UNLOCK()  pthread_mutex_unlock(&nonce_mutex)
+#else
+#define NONCE_LOCK()
+#define NONCE_UNLOCK()
+#endif
+
+/**
+ * \brief             Moves the oldest pair of the pool to k_inv, r.
+ *                    Returns 0 if the pool is empty.
+ */
+static uint8_t
+nonce_take(NN_DIGIT *k_inv, NN_DIGIT *r)
+{
+  nonce_pair_t *slot;
+  uint8_t taken = 0;
+
+  NONCE_LOCK();
+  if(nonce_count > 0) {
+    slot = &nonce_ring[nonce_head];
+    NN_Assign(k_inv, slot->k_inv, NUMWORDS);
+    NN_Assign(r, slot->r, NUMWORDS);
+    ecdsa_wipe(slot, sizeof(nonce_pair_t));
+    nonce_head = (nonce_head + 1) % ECDSA_NONCE_POOL;
+    nonce_count--;
+    taken = 1;
+  }
+  NONCE_UNLOCK();
+
+  /* wake the filler for the free slot */
+#if defined(ECDSA_NONCE_FREERTOS)
+  if(taken && nonce_task != NULL) {
+    xTaskNotifyGive(nonce_task);
+  }
+#elif defined(ECDSA_NONCE_PTHREAD)
+  if(taken) {
+    pthread_cond_signal(&nonce_cond);
+  }
+#endif
+  return taken;
+}
+
+/**
+ * \brief             Prepares up to ECDSA_NONCE_BATCH pairs for the free
+ *                    slots of the pool, the k are inverted together.
+ *                    Returns the number of pairs added.
+ */
+static uint8_t
+nonce_step(void)
+{
+  NN_DIGIT k[ECDSA_NONCE_BATCH][NUMWORDS];
+  NN_DIGIT r[ECDSA_NONCE_BATCH][NUMWORDS];
+  NN_DIGIT pre[ECDSA_NONCE_BATCH][NUMWORDS];
+  uint8_t skip[ECDSA_NONCE_BATCH];
+  point_t P;
+  uint8_t i, n, added;
+
+  NONCE_LOCK();
+  n = ECDSA_NONCE_POOL - nonce_count;
+  NONCE_UNLOCK();
+  if(n == 0) {
+    return 0;
+  }
+  if(n > ECDSA_NONCE_BATCH) {
+    n = ECDSA_NONCE_BATCH;
+  }
+
+  for(i = 0; i < n; i++) {
+    ecc_gen_private_key(k[i]);
+    ecc_secret_mul_base(&P, k[i]);
+
+    /* x < p < 2r, at most one subtraction */
+    NN_Assign(r[i], P.x, NUMWORDS);
+    NN_ModSmall(r[i], nonce_order, NUMWORDS);
+    skip[i] = NN_Zero(r[i], NUMWORDS);
+  }
+
+  /* k = k^-1 mod r */
+  batch_inv(k, pre, skip, n, &nonce_red);
+
+  added = 0;
+  NONCE_LOCK();
+  for(i = 0; i < n && nonce_count < ECDSA_NONCE_POOL; i++) {
+    nonce_pair_t *slot;
+
+    if(skip[i]) {
+      continue;
+    }
+    slot = &nonce_ring[(nonce_head + nonce_count) % ECDSA_NONCE_POOL];
+    NN_Assign(slot->k_inv, k[i], NUMWORDS);
+    NN_Assign(slot->r, r[i], NUMWORDS);
+    nonce_count++;
+    added++;
+  }
+  NONCE_UNLOCK();
+
+  ecdsa_wipe(k, sizeof(k));
+  ecdsa_wipe(r, sizeof(r));
+  ecdsa_wipe(pre, sizeof(pre));
+  ecdsa_wipe(&P, sizeof(P));
+  return added;
+}
+
+/**
+ * \brief             Returns nonzero while the background task should run.
+ */
+static uint8_t
+nonce_is_running(void)
+{
+  uint8_t running;
+
+  NONCE_LOCK();
+  running = nonce_running;
+  NONCE_UNLOCK();
+  return running;
+}
+
+/**
+ * \brief             Starts or stops the background task's loop.
+ */
+static void
+nonce_set_running(uint8_t running)
+{
+  NONCE_LOCK();
+  nonce_running = running;
+  NONCE_UNLOCK();
+}
+
+/**
+ * \brief             Returns the number of pairs in the pool.
+ */
+static uint8_t
+nonce_pool_count(void)
+{
+  uint8_t count;
+
+  NONCE_LOCK();
+  count = nonce_count;
+  NONCE_UNLOCK();
+  return count;
+}
+
+/**
+ * \brief             Sets up the curve and the order once, both threads
+ *                    only read them afterwards. Called before any thread is
+ *                    started, or by the one thread that fills the pool.
+ */
+static void
+nonce_init(void)
+{
+  if(nonce_ready) {
+    return;
+  }
+  ecc_init();
+  ecc_get_order(nonce_order);
+  NN_BarrettInit(&nonce_red, nonce_order, NUMWORDS);
+  nonce_ready = 1;
+}
+
+#if defined(ECDSA_NONCE_FREERTOS)
+/**
+ * \brief             Background task, refills the pool and sleeps until a
+ *                    pair is taken.
+ */
+static void
+nonce_task_loop(void *arg)
+{
+  (void)arg;
+  while(nonce_is_running()) {
+    if(nonce_step() == 0) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+  }
+  /* ecdsa_nonce_pool_stop deletes the task */
+  nonce_task_done = 1;
+  vTaskSuspend(NULL);
+}
+#elif defined(ECDSA_NONCE_PTHREAD)
+/**
+ * \brief             Background thread, refills the pool and sleeps until a
+ *                    pair is taken.
+ */
+static void *
+nonce_thread_loop(void *arg)
+{
+  (void)arg;
+  while(nonce_is_running()) {
+    if(nonce_step() == 0) {
+      pthread_mutex_lock(&nonce_mutex);
+      while(nonce_running && nonce_count == ECDSA_NONCE_POOL) {
+        pthread_cond_wait(&nonce_cond, &nonce_mutex);
       }
+      pthread_mutex_unlock(&nonce_mutex);
+    }
+  }
+  return NULL;
+}
+#endif
+/*---------------------------------------------------------------------------*/
+uint8_t
+ecdsa_nonce_pool_step(void)
+{
+  /* a running background task had the setup done before it started */
+  if(!nonce_is_running()) {
+    nonce_init();
+  }
+  nonce_step();
+
+  return nonce_pool_count();
+}
+/*---------------------------------------------------------------------------*/
+uint8_t
+ecdsa_nonce_pool_fill(void)
+{
+  if(!nonce_is_running()) {
+    nonce_init();
   }
+  while(nonce_step() > 0);
 
-  if((NN_Cmp(w, r, NUMWORDS)) == 0) {
+  return nonce_pool_count();
+}
+/*---------------------------------------------------------------------------*/
+uint8_t
+ecdsa_nonce_pool_start(void)
+{
+  if(nonce_is_running()) {
     return 1;
-  } else {
-    return 2;
   }
+  nonce_init();
+
+#if defined(ECDSA_NONCE_FREERTOS)
+  nonce_set_running(1);
+  nonce_task_done = 0;
+  if(xTaskCreate(nonce_task_loop, "ECDSA_NONCE", ECDSA_NONCE_TASK_STACK, NULL,
+                 tskIDLE_PRIORITY, &nonce_task) != pdPASS) {
+    nonce_task = NULL;
+    nonce_set_running(0);
+  }
+#elif defined(ECDSA_NONCE_PTHREAD)
+  nonce_set_running(1);
+  if(pthread_create(&nonce_thread, NULL, nonce_thread_loop, NULL) != 0) {
+    nonce_set_running(0);
+  }
+#endif
+  return nonce_is_running();
+}
+/*---------------------------------------------------------------------------*/
+void
+ecdsa_nonce_pool_stop(void)
+{
+  if(nonce_is_running()) {
+    nonce_set_running(0);
+#if defined(ECDSA_NONCE_FREERTOS)
+    /* the notification is kept if the task is busy with a step */
+    xTaskNotifyGive(nonce_task);
+    while(!nonce_task_done) {
+      vTaskDelay(1);
+    }
+    vTaskDelete(nonce_task);
+    nonce_task = NULL;
+#elif defined(ECDSA_NONCE_PTHREAD)
+    pthread_mutex_lock(&nonce_mutex);
+    pthread_cond_signal(&nonce_cond);
+    pthread_mutex_unlock(&nonce_mutex);
+    pthread_join(nonce_thread, NULL);
+#endif
+  }
+
+  NONCE_LOCK();
+  ecdsa_wipe(nonce_ring, sizeof(nonce_ring));
+  nonce_head = 0;
+  nonce_count = 0;
+  NONCE_UNLOCK();
 }
+#endif /* ECDSA_NONCE_POOL */
 
 /**
  * @}
@@ -20,9 +20,43 @@
 #include "nn.h"
 #include "ecc.h"
 
+/**
+ * Everything ecdsa_sign needs about one private key. Build it once per key
+ * with ecdsa_sign_ctx_init() and reuse it for every signature.
+ */
+typedef struct ecdsa_sign_ctx {
+    /** private key, the secret scalar d */
+    NN_DIGIT d[NUMWORDS];
+
+    /** order of the base point */
+    NN_DIGIT order[NUMWORDS];
+
+    /** Barrett reduction data for the order */
+    nn_barrett_t order_red;
+} ecdsa_sign_ctx_t;
+
+/**
+ * Everything ecdsa_verify needs about one public key. Build it once per key
+ * with ecdsa_verify_ctx_init() and reuse it for every signature.
+ * Contexts share nothing, threads verifying at the same time each use their
+ * own (as signing threads do with ecdsa_sign_ctx_t).
+ */
+typedef struct ecdsa_verify_ctx {
+    /** precomputed array of the public key for the window method */
+    point_t qBaseArray[NUM_POINTS];
+
+    /** order of the base point */
+    NN_DIGIT order[NUMWORDS];
+
+    /** Barrett reduction data for the order */
+    nn_barrett_t order_red;
+} ecdsa_verify_ctx_t;
+
 /**
  * \brief             Initialize the ECDSA using the public key that is to be
  *                    used to verify the signature.
+ *                    This fills one context shared by every ecdsa_verify
+ *                    call, threads use ecdsa_verify_ctx_init instead.
  *
  * \param pb_key       A pointer to the public key.
  *                    This public key may not be generated from the private
@@ -40,6 +74,40 @@ void ecdsa_init(point_t * pb_key);
  */
 void ecdsa_sign(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, NN_DIGIT * pr_key);
 
+/**
+ * \brief             Prepare a signing context for a private key.
+ *                    Neither the public key nor the verification table is
+ *                    needed to sign, so none of them is computed.
+ *
+ * \param ctx         The signing context to fill.
+ * \param pr_key      The private key that is used to sign messages.
+ */
+void ecdsa_sign_ctx_init(ecdsa_sign_ctx_t * ctx, NN_DIGIT * pr_key);
+
+/**
+ * \brief             Sign a message using a prepared signing context.
+ *
+ * \param sha256sum   Hash of the message to sign.
+ * \param r
+ * \param s           Signature of the message.
+ * \param ctx         The signing context built by ecdsa_sign_ctx_init.
+ */
+void ecdsa_sign_with_ctx(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, ecdsa_sign_ctx_t * ctx);
+
+/**
+ * \brief             Sign four messages with the key of a signing context.
+ *                    The four nonces share one ecc_secret_mul_base_x4 and
+ *                    one inversion. Nonces are drawn fresh, the nonce pool
+ *                    is left alone.
+ *
+ * \param sha256sum   Hashes of the messages to sign.
+ * \param r
+ * \param s           Signatures of the messages, r[i], s[i] sign
+ *                    sha256sum[i].
+ * \param ctx         The signing context built by ecdsa_sign_ctx_init.
+ */
+void ecdsa_sign_x4(uint8_t sha256sum[][SHA256_DIGEST_LENGTH], NN_DIGIT r[][NUMWORDS], NN_DIGIT s[][NUMWORDS], ecdsa_sign_ctx_t * ctx);
+
 /**
  * \brief             Verify a message using public key.
  * \param sha256sum   Hash of the message to sign.
@@ -53,6 +121,139 @@ void ecdsa_sign(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *
  */
 uint8_t ecdsa_verify(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, point_t * pb_key);
 
+/**
+ * \brief             Prepare a verification context for a public key.
+ *
+ * \param ctx         The verification context to fill.
+ * \param pb_key      The public key that is used to verify signatures.
+ */
+void ecdsa_verify_ctx_init(ecdsa_verify_ctx_t * ctx, point_t * pb_key);
+
+/**
+ * \brief             Verify a message using a prepared verification context.
+ * \param sha256sum   Hash of the message to sign.
+ * \param r
+ * \param s           Signature of the message.
+ * \param ctx         The verification context built by ecdsa_verify_ctx_init.
+ * \return            1 if the signature is verified.
+ */
+uint8_t ecdsa_verify_with_ctx(uint8_t sha256sum[SHA256_DIGEST_LENGTH], NN_DIGIT *r, NN_DIGIT *s, ecdsa_verify_ctx_t * ctx);
+
+/**
+ * Signatures ecdsa_verify_batch handles together. The inversions of s and
+ * those of the points u1*G + u2*Q are shared within a group, the points
+ * being computed side by side with ECC_BATCH_AFFINE (see ecc.h), where the
+ * group takes ECC_BATCH_LANES of them. Each group needs about
+ * ECDSA_BATCH_SIZE * 250 bytes of stack with 32-bit digits, and the chains
+ * of ECC_BATCH_AFFINE about 450 bytes each with 64-bit digits.
+ */
+#ifndef ECDSA_BATCH_SIZE
+#if ECC_BATCH_AFFINE
+#define ECDSA_BATCH_SIZE ECC_BATCH_LANES
+#else
+#define ECDSA_BATCH_SIZE 8
+#endif
+#endif
+
+/**
+ * Threads ecdsa_verify_batch spreads the groups over, the calling thread
+ * included. Values above 1 need POSIX threads (host builds, ESP32).
+ */
+#ifndef ECDSA_BATCH_THREADS
+#define ECDSA_BATCH_THREADS 1
+#endif
+
+/**
+ * Public key tables each thread of ecdsa_verify_batch keeps, the oldest
+ * giving way to a new key. Signatures may then come in any order of up to
+ * this many keys without a table being built twice. With 32-bit digits a
+ * table takes NUM_POINTS * 72 bytes of stack, and NUM_POINTS * 36 more
+ * while it is built.
+ */
+#ifndef ECDSA_BATCH_KEYS
+#define ECDSA_BATCH_KEYS 4
+#endif
+
+/**
+ * \brief             Verify n signatures at once.
+ *                    ecdsa_init is not needed, every signature carries its
+ *                    public key. The table of a key is built once while it
+ *                    stays among the last ECDSA_BATCH_KEYS keys, the tables
+ *                    a group needs share their inversions.
+ * \param n           Number of signatures.
+ * \param digests     Hashes of the messages.
+ * \param r
+ * \param s           Signatures of the messages.
+ * \param keys        Public keys, keys[i] verifies signature i.
+ * \param results     Filled with what ecdsa_verify would return for each
+ *                    signature, 1 if it is verified.
+ * \return            Number of verified signatures.
+ */
+uint16_t ecdsa_verify_batch(uint16_t n, uint8_t digests[][SHA256_DIGEST_LENGTH], NN_DIGIT r[][NUMWORDS], NN_DIGIT s[][NUMWORDS], point_t * keys, uint8_t * results);
+
+/**
+ * Capacity of the nonce pool, 0 leaves it out. The pool holds pairs
+ * (k^-1 mod r, (k*G).x mod r) prepared before the message is known, signing
+ * takes one and only has s = k^-1 * (e + d*r) left to compute. Each pair
+ * costs 2 * NUMWORDS digits. Signing falls back to a fresh nonce when the
+ * pool is empty.
+ */
+#ifndef ECDSA_NONCE_POOL
+#define ECDSA_NONCE_POOL 0
+#endif
+
+#if ECDSA_NONCE_POOL > 0
+
+/**
+ * Nonces prepared per step of the pool, their inversions are shared.
+ */
+#ifndef ECDSA_NONCE_BATCH
+#define ECDSA_NONCE_BATCH 4
+#endif
+
+/**
+ * Stack of the background task on ESP32.
+ */
+#ifndef ECDSA_NONCE_TASK_STACK
+#define ECDSA_NONCE_TASK_STACK 6144
+#endif
+
+/**
+ * \brief             Add up to ECDSA_NONCE_BATCH pairs to the nonce pool in
+ *                    the calling thread, about the work of as many
+ *                    signatures. Targets without a background task call
+ *                    this when idle, from loop() for instance, one step per
+ *                    pass so that the loop is never held for long. Returns
+ *                    at once when the pool is full.
+ * \return            Number of pairs in the pool.
+ */
+uint8_t ecdsa_nonce_pool_step(void);
+
+/**
+ * \brief             Fill the nonce pool in the calling thread, step after
+ *                    step until it is full. For callers that can wait, before
+ *                    a burst of signatures for instance.
+ * \return            Number of pairs in the pool.
+ */
+uint8_t ecdsa_nonce_pool_fill(void);
+
+/**
+ * \brief             Start a background task that keeps the nonce pool full:
+ *                    a FreeRTOS task at idle priority on ESP32, a POSIX
+ *                    thread on host builds. Nothing is started on other
+ *                    targets.
+ * \return            1 if the task runs.
+ */
+uint8_t ecdsa_nonce_pool_start(void);
+
+/**
+ * \brief             Stop the background task and wipe the pool. Not to be
+ *                    called while another thread signs.
+ */
+void ecdsa_nonce_pool_stop(void);
+
+#endif /* ECDSA_NONCE_POOL */
+
 
 #endif /* __EDSA_H__ */
 
@@ -6,6 +6,9 @@
  */
 
 #include "nn.h"
+#include "nn_fixed.h"
+#include "nn_host.h"
+#include "nn_radix29.h"
 #if !defined(WITH_CONTIKI) && defined(HAVE_ASSERT_H)
 #include <assert.h>
 #else
@@ -18,6 +21,14 @@
 
 #define MODINVOPT
 
+/*
+ * NIST P-256 has a dedicated reduction working on 32-bit words, use it in
+ * place of the generic omega multiplication loop.
+ */
+#if defined(NN_HAVE_P256_REDUCTION) && !defined(NN_HOST_KERNELS)
+#define P256_FAST_REDUCTION
+#endif
+
 #define MAX(a,b) ((a) < (b) ? (b) : (a))
 #define DIGIT_MSB(x) (NN_DIGIT)(((x) >> (NN_DIGIT_BITS - 1)) & 1)
 #define DIGIT_2MSB(x) (NN_DIGIT)(((x) >> (NN_DIGIT_BITS - 2)) & 3)
@@ -425,6 +436,496 @@ NN_ModInv(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_UINT digits)
 
 }
 /*---------------------------------------------------------------------------*/
+/*
+ * The products of the chain of NN_ModInvOpt, on the P-256 reduction where it
+ * is built, the chain being that of the P-256 prime.
+ */
+static inline void
+NN_ModMultChain(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_DIGIT *d, NN_DIGIT *omega, NN_UINT digits)
+{
+#ifdef NN_HAVE_P256_REDUCTION
+  (void)d;
+  (void)omega;
+  NN_ModMultP256(a, b, c, digits);
+#else
+  NN_ModMultOpt(a, b, c, d, omega, digits);
+#endif
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * a = b^(2^n) mod d
+ */
+static void
+NN_ModSqrN(NN_DIGIT *a, NN_DIGIT *b, NN_UINT n, NN_DIGIT *d, NN_DIGIT *omega, NN_UINT digits)
+{
+#ifdef NN_HAVE_P256_REDUCTION
+  (void)d;
+  (void)omega;
+#endif
+  NN_Assign(a, b, digits);
+  while(n-- > 0) {
+#ifdef NN_HAVE_P256_REDUCTION
+    NN_ModSqrP256(a, a, digits);
+#else
+    NN_ModSqrOpt(a, a, d, omega, digits);
+#endif
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_ModInvOpt(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *d, NN_DIGIT *omega, NN_UINT digits)
+{
+  NN_DIGIT x1[MAX_NN_DIGITS], x2[MAX_NN_DIGITS], x3[MAX_NN_DIGITS],
+          x15[MAX_NN_DIGITS], x30[MAX_NN_DIGITS], x32[MAX_NN_DIGITS],
+          t[MAX_NN_DIGITS];
+
+  /*
+   * d - 2 = 2^256 - 2^224 + 2^192 + 2^96 - 3, from the top:
+   * 32 ones, 31 zeros, a one, 96 zeros, 94 ones, a zero, a one.
+   * xN below is b^(2^N - 1), a run of N ones.
+   */
+  NN_Assign(x1, b, digits);
+  NN_ModSqrN(t, x1, 1, d, omega, digits);
+  NN_ModMultChain(x2, t, x1, d, omega, digits);
+  NN_ModSqrN(t, x2, 1, d, omega, digits);
+  NN_ModMultChain(x3, t, x1, d, omega, digits);
+  NN_ModSqrN(t, x3, 3, d, omega, digits);
+  NN_ModMultChain(x15, t, x3, d, omega, digits);                /* x6 */
+  NN_ModSqrN(t, x15, 6, d, omega, digits);
+  NN_ModMultChain(x30, t, x15, d, omega, digits);               /* x12 */
+  NN_ModSqrN(t, x30, 3, d, omega, digits);
+  NN_ModMultChain(x15, t, x3, d, omega, digits);
+  NN_ModSqrN(t, x15, 15, d, omega, digits);
+  NN_ModMultChain(x30, t, x15, d, omega, digits);
+  NN_ModSqrN(t, x30, 2, d, omega, digits);
+  NN_ModMultChain(x32, t, x2, d, omega, digits);
+
+  /* 32 ones, then 31 zeros and a one */
+  NN_ModSqrN(t, x32, 32, d, omega, digits);
+  NN_ModMultChain(t, t, x1, d, omega, digits);
+  /* 96 zeros and 32 ones */
+  NN_ModSqrN(t, t, 128, d, omega, digits);
+  NN_ModMultChain(t, t, x32, d, omega, digits);
+  /* 32 ones */
+  NN_ModSqrN(t, t, 32, d, omega, digits);
+  NN_ModMultChain(t, t, x32, d, omega, digits);
+  /* 30 ones */
+  NN_ModSqrN(t, t, 30, d, omega, digits);
+  NN_ModMultChain(t, t, x30, d, omega, digits);
+  /* a zero and a one */
+  NN_ModSqrN(t, t, 2, d, omega, digits);
+  NN_ModMultChain(a, t, x1, d, omega, digits);
+}
+/*---------------------------------------------------------------------------*/
+#ifdef NN_HAVE_SAFEGCD
+/*
+ * Bernstein-Yang inversion, "Fast constant-time gcd computation and modular
+ * inversion" (2019), in the form of libsecp256k1's modinv64: numbers are
+ * held as five signed 62-bit limbs, divsteps are batched 59 at a time into a
+ * 2x2 transition matrix scaled by 2^62 that is then applied to the full
+ * length (f, g) and (d, e) pairs.
+ */
+__extension__ typedef __int128 NN_SDOUBLE_DIGIT;
+
+#define SG_LIMBS 5
+#define SG_M62 (MAX_NN_DIGIT >> 2)
+
+typedef struct {
+  int64_t v[SG_LIMBS];
+} sg_signed62_t;
+
+typedef struct {
+  int64_t u, v, q, r;
+} sg_trans_t;
+
+typedef struct {
+  sg_signed62_t modulus;
+  /* modulus^-1 mod 2^62 */
+  uint64_t modulus_inv62;
+} sg_modinfo_t;
+/*---------------------------------------------------------------------------*/
+static void
+sg_from_digits(sg_signed62_t *r, NN_DIGIT *a)
+{
+  r->v[0] = (int64_t)(a[0] & SG_M62);
+  r->v[1] = (int64_t)(((a[0] >> 62) | (a[1] << 2)) & SG_M62);
+  r->v[2] = (int64_t)(((a[1] >> 60) | (a[2] << 4)) & SG_M62);
+  r->v[3] = (int64_t)(((a[2] >> 58) | (a[3] << 6)) & SG_M62);
+  r->v[4] = (int64_t)(a[3] >> 56);
+}
+/*---------------------------------------------------------------------------*/
+static void
+sg_to_digits(NN_DIGIT *a, const sg_signed62_t *r)
+{
+  const uint64_t r0 = r->v[0], r1 = r->v[1], r2 = r->v[2], r3 = r->v[3],
+                 r4 = r->v[4];
+
+  a[0] = r0 | (r1 << 62);
+  a[1] = (r1 >> 2) | (r2 << 60);
+  a[2] = (r2 >> 4) | (r3 << 58);
+  a[3] = (r3 >> 6) | (r4 << 56);
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * 59 divsteps on the low 64 bits of f and g. zeta = -(delta + 1/2).
+ * The matrix starts as the identity times 8, so after 59 doublings it is
+ * scaled by 2^62. Branch free: conditions become masks.
+ */
+static int64_t
+sg_divsteps_59(int64_t zeta, uint64_t f0, uint64_t g0, sg_trans_t *t)
+{
+  uint64_t u = 8, v = 0, q = 0, r = 8;
+  uint64_t c1, c2, f = f0, g = g0, x, y, z;
+  int i;
+
+  for(i = 3; i < 62; i++) {
+    /* masks for zeta < 0 and for g odd */
+    c1 = (uint64_t)(zeta >> 63);
+    c2 = (uint64_t)0 - (g & 1);
+    /* conditionally negated f, u, v */
+    x = (f ^ c1) - c1;
+    y = (u ^ c1) - c1;
+    z = (v ^ c1) - c1;
+    /* added to g, q, r when g is odd */
+    g += x & c2;
+    q += y & c2;
+    r += z & c2;
+    /* on a swap zeta becomes -zeta - 2, otherwise zeta - 1 */
+    c1 &= c2;
+    zeta = (zeta ^ (int64_t)c1) - 1;
+    /* and f, u, v take the old g, q, r */
+    f += g & c1;
+    u += q & c1;
+    v += r & c1;
+    g >>= 1;
+    u <<= 1;
+    v <<= 1;
+  }
+  t->u = (int64_t)u;
+  t->v = (int64_t)v;
+  t->q = (int64_t)q;
+  t->r = (int64_t)r;
+  return zeta;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * [d, e] = t * [d, e] / 2^62 mod modulus, with d, e kept in
+ * (-2 * modulus, modulus).
+ */
+static void
+sg_update_de(sg_signed62_t *d, sg_signed62_t *e, const sg_trans_t *t,
+             const sg_modinfo_t *mod)
+{
+  const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+  int64_t md, me, sd, se;
+  NN_SDOUBLE_DIGIT cd, ce;
+  int i;
+
+  /* add the modulus back in for negative inputs */
+  sd = d->v[4] >> 63;
+  se = e->v[4] >> 63;
+  md = (u & sd) + (v & se);
+  me = (q & sd) + (r & se);
+  cd = (NN_SDOUBLE_DIGIT)u * d->v[0] + (NN_SDOUBLE_DIGIT)v * e->v[0];
+  ce = (NN_SDOUBLE_DIGIT)q * d->v[0] + (NN_SDOUBLE_DIGIT)r * e->v[0];
+  /* pick md, me so the low 62 bits of t*[d,e] + modulus*[md,me] vanish */
+  md -= (int64_t)((mod->modulus_inv62 * (uint64_t)cd + (uint64_t)md) & SG_M62);
+  me -= (int64_t)((mod->modulus_inv62 * (uint64_t)ce + (uint64_t)me) & SG_M62);
+  cd += (NN_SDOUBLE_DIGIT)mod->modulus.v[0] * md;
+  ce += (NN_SDOUBLE_DIGIT)mod->modulus.v[0] * me;
+  cd >>= 62;
+  ce >>= 62;
+  for(i = 1; i < SG_LIMBS; i++) {
+    cd += (NN_SDOUBLE_DIGIT)u * d->v[i] + (NN_SDOUBLE_DIGIT)v * e->v[i]
+          + (NN_SDOUBLE_DIGIT)mod->modulus.v[i] * md;
+    ce += (NN_SDOUBLE_DIGIT)q * d->v[i] + (NN_SDOUBLE_DIGIT)r * e->v[i]
+          + (NN_SDOUBLE_DIGIT)mod->modulus.v[i] * me;
+    d->v[i - 1] = (int64_t)((uint64_t)cd & SG_M62);
+    e->v[i - 1] = (int64_t)((uint64_t)ce & SG_M62);
+    cd >>= 62;
+    ce >>= 62;
+  }
+  d->v[SG_LIMBS - 1] = (int64_t)cd;
+  e->v[SG_LIMBS - 1] = (int64_t)ce;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * [f, g] = t * [f, g] / 2^62, exact
+ */
+static void
+sg_update_fg(sg_signed62_t *f, sg_signed62_t *g, const sg_trans_t *t)
+{
+  const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+  NN_SDOUBLE_DIGIT cf, cg;
+  int i;
+
+  cf = (NN_SDOUBLE_DIGIT)u * f->v[0] + (NN_SDOUBLE_DIGIT)v * g->v[0];
+  cg = (NN_SDOUBLE_DIGIT)q * f->v[0] + (NN_SDOUBLE_DIGIT)r * g->v[0];
+  cf >>= 62;
+  cg >>= 62;
+  for(i = 1; i < SG_LIMBS; i++) {
+    cf += (NN_SDOUBLE_DIGIT)u * f->v[i] + (NN_SDOUBLE_DIGIT)v * g->v[i];
+    cg += (NN_SDOUBLE_DIGIT)q * f->v[i] + (NN_SDOUBLE_DIGIT)r * g->v[i];
+    f->v[i - 1] = (int64_t)((uint64_t)cf & SG_M62);
+    g->v[i - 1] = (int64_t)((uint64_t)cg & SG_M62);
+    cf >>= 62;
+    cg >>= 62;
+  }
+  f->v[SG_LIMBS - 1] = (int64_t)cf;
+  g->v[SG_LIMBS - 1] = (int64_t)cg;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * r = sign(f) * r mod modulus in [0, modulus), r in (-2 * modulus, modulus)
+ */
+static void
+sg_normalize(sg_signed62_t *r, int64_t sign, const sg_modinfo_t *mod)
+{
+  int64_t cond_add, cond_negate;
+  int pass, i;
+
+  cond_negate = sign >> 63;
+  for(pass = 0; pass < 2; pass++) {
+    /* add the modulus when negative */
+    cond_add = r->v[SG_LIMBS - 1] >> 63;
+    for(i = 0; i < SG_LIMBS; i++) {
+      r->v[i] += mod->modulus.v[i] & cond_add;
+    }
+    /* negate after the first addition if f ended at -1 */
+    if(pass == 0) {
+      for(i = 0; i < SG_LIMBS; i++) {
+        r->v[i] = (r->v[i] ^ cond_negate) - cond_negate;
+      }
+    }
+    /* and bring the limbs back to 62 bits */
+    for(i = 0; i < SG_LIMBS - 1; i++) {
+      r->v[i + 1] += r->v[i] >> 62;
+      r->v[i] &= (int64_t)SG_M62;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_ModInvSafegcd(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_UINT digits)
+{
+  sg_modinfo_t mod;
+  sg_signed62_t d = {{0, 0, 0, 0, 0}}, e = {{1, 0, 0, 0, 0}}, f, g;
+  sg_trans_t t;
+  uint64_t inv;
+  int64_t zeta = -1;
+  int i;
+
+  sg_from_digits(&mod.modulus, c);
+  /* Newton iteration, each step doubles the number of correct low bits */
+  inv = c[0];
+  for(i = 0; i < 5; i++) {
+    inv *= 2 - c[0] * inv;
+  }
+  mod.modulus_inv62 = inv & SG_M62;
+
+  f = mod.modulus;
+  sg_from_digits(&g, b);
+  /* 590 divsteps are enough for 256-bit inputs */
+  for(i = 0; i < 10; i++) {
+    zeta = sg_divsteps_59(zeta, (uint64_t)f.v[0], (uint64_t)g.v[0], &t);
+    sg_update_de(&d, &e, &t, &mod);
+    sg_update_fg(&f, &g, &t);
+  }
+  /* g is 0 now and f is +1 or -1 */
+  sg_normalize(&d, f.v[SG_LIMBS - 1], &mod);
+
+  sg_to_digits(a, &d);
+  NN_AssignZero(a + KEYDIGITS, digits - KEYDIGITS);
+}
+#endif /* NN_HAVE_SAFEGCD */
+/*---------------------------------------------------------------------------*/
+int
+NN_BarrettInit(nn_barrett_t *ctx, NN_DIGIT *d, NN_UINT digits)
+{
+  NN_DIGIT t[2 * KEYDIGITS + 1], q[2 * KEYDIGITS + 1], rem[MAX_NN_DIGITS];
+
+  ctx->d_digits = NN_Digits(d, digits);
+  if(ctx->d_digits == 0 || ctx->d_digits > KEYDIGITS) {
+    ctx->d_digits = 0;
+    return FALSE;
+  }
+
+  NN_AssignZero(ctx->d, KEYDIGITS + 1);
+  NN_Assign(ctx->d, d, ctx->d_digits);
+  if(ctx->d_digits < KEYDIGITS) {
+    /* the estimate of q needs the top digit of d nonzero, divide instead */
+    NN_AssignZero(ctx->mu, KEYDIGITS + 1);
+    return TRUE;
+  }
+
+  /* mu = B^(2k) / d has k + 1 digits, B being the digit base */
+  NN_AssignZero(t, 2 * KEYDIGITS);
+  t[2 * KEYDIGITS] = 1;
+  NN_Div(q, rem, t, 2 * KEYDIGITS + 1, ctx->d, KEYDIGITS);
+  NN_Assign(ctx->mu, q, KEYDIGITS + 1);
+  return TRUE;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * a = b mod d, b[2*KEYDIGITS], a[KEYDIGITS]. a and b can be same.
+ */
+static void
+NN_BarrettReduce(NN_DIGIT *a, NN_DIGIT *b, nn_barrett_t *ctx)
+{
+  NN_DIGIT q[2 * (KEYDIGITS + 1)], qd[KEYDIGITS + 1];
+  NN_DIGIT r[KEYDIGITS + 1], t[KEYDIGITS + 1], keep;
+  NN_UINT i, j;
+
+  if(ctx->d_digits < KEYDIGITS) {
+    NN_Mod(a, b, 2 * KEYDIGITS, ctx->d, KEYDIGITS);
+    return;
+  }
+
+  /*
+   * q = floor(floor(b / B^(k-1)) * mu / B^(k+1)), at most 3 below b / d:
+   * 2 from the estimate and 1 from the columns skipped in the product.
+   */
+  NN_MultHighFixed<KEYDIGITS + 1, KEYDIGITS - 1>(q, b + KEYDIGITS - 1, ctx->mu);
+  /* r = (b - q * d) mod B^(k+1), in [0, 4d) */
+  NN_MultLowFixed<KEYDIGITS + 1>(qd, q + KEYDIGITS + 1, ctx->d);
+  NN_SubFixed<KEYDIGITS + 1>(r, b, qd);
+
+  for(j = 0; j < 3; j++) {
+    keep = (NN_DIGIT)0 - NN_SubFixed<KEYDIGITS + 1>(t, r, ctx->d);
+    for(i = 0; i < KEYDIGITS + 1; i++) {
+      r[i] = (r[i] & keep) | (t[i] & ~keep);
+    }
+  }
+  NN_Assign(a, r, KEYDIGITS);
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_BarrettMod(NN_DIGIT *a, NN_DIGIT *b, NN_UINT b_digits, nn_barrett_t *ctx, NN_UINT digits)
+{
+  NN_DIGIT t[2 * KEYDIGITS];
+
+  assert(NN_Digits(b, b_digits) <= 2 * KEYDIGITS);
+
+  NN_AssignZero(t, 2 * KEYDIGITS);
+  NN_Assign(t, b, b_digits < 2 * KEYDIGITS ? b_digits : 2 * KEYDIGITS);
+  NN_BarrettReduce(a, t, ctx);
+  NN_AssignZero(a + KEYDIGITS, digits - KEYDIGITS);
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_BarrettModMult(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, nn_barrett_t *ctx, NN_UINT digits)
+{
+  NN_DIGIT t[2 * KEYDIGITS];
+
+  NN_MultFixed<KEYDIGITS>(t, b, c);
+  NN_BarrettReduce(a, t, ctx);
+  NN_AssignZero(a + KEYDIGITS, digits - KEYDIGITS);
+}
+/*---------------------------------------------------------------------------*/
+#ifdef P256_FAST_REDUCTION
+/*
+ * p = 2^256 - 2^224 + 2^192 + 2^96 - 1 in 32-bit words
+ */
+static const uint32_t p256_words[8] = {
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+  0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF
+};
+/*
+ * 2^256 mod p = 2^224 - 2^192 - 2^96 + 1, by word
+ */
+static const int8_t p256_fold[8] = { 1, 0, 0, -1, 0, 0, -1, 1 };
+/**
+ * \brief             Computes a = b mod p, p being the P-256 prime
+ *                    Lengths: a[KEYDIGITS], b[2*KEYDIGITS]. a and b can be same.
+ *                    Fast reduction for NIST primes (Algorithm 2.29 in "Guide
+ *                    to ECC"): with b split in 32-bit words c15..c0 the result
+ *                    is s1 + 2s2 + 2s3 + s4 + s5 - s6 - s7 - s8 - s9 mod p,
+ *                    summed here column by column.
+ */
+static void
+NN_ModP256(NN_DIGIT *a, NN_DIGIT *b)
+{
+#ifdef THIRTYTWO_BIT_PROCESSOR
+  const uint32_t *c = b;
+#else
+  uint32_t c[16];
+#endif
+  uint32_t r[8], s[8], keep;
+  int64_t acc, top;
+  uint8_t i, j;
+
+#ifdef SIXTY_FOUR_BIT_PROCESSOR
+  for(i = 0; i < 2 * KEYDIGITS; i++) {
+    c[2 * i] = (uint32_t)b[i];
+    c[2 * i + 1] = (uint32_t)(b[i] >> 32);
+  }
+#endif
+
+  acc = (int64_t)c[0] + c[8] + c[9] - c[11] - c[12] - c[13] - c[14];
+  r[0] = (uint32_t)acc;
+  acc >>= 32;
+  acc += (int64_t)c[1] + c[9] + c[10] - c[12] - c[13] - c[14] - c[15];
+  r[1] = (uint32_t)acc;
+  acc >>= 32;
+  acc += (int64_t)c[2] + c[10] + c[11] - c[13] - c[14] - c[15];
+  r[2] = (uint32_t)acc;
+  acc >>= 32;
+  acc += (int64_t)c[3] + 2 * ((int64_t)c[11] + c[12]) + c[13] - c[8] - c[9] - c[15];
+  r[3] = (uint32_t)acc;
+  acc >>= 32;
+  acc += (int64_t)c[4] + 2 * ((int64_t)c[12] + c[13]) + c[14] - c[9] - c[10];
+  r[4] = (uint32_t)acc;
+  acc >>= 32;
+  acc += (int64_t)c[5] + 2 * ((int64_t)c[13] + c[14]) + c[15] - c[10] - c[11];
+  r[5] = (uint32_t)acc;
+  acc >>= 32;
+  acc += (int64_t)c[6] + 3 * (int64_t)c[14] + 2 * (int64_t)c[15] + c[13] - c[8] - c[9];
+  r[6] = (uint32_t)acc;
+  acc >>= 32;
+  acc += (int64_t)c[7] + 3 * (int64_t)c[15] + c[8] - c[10] - c[11] - c[12] - c[13];
+  r[7] = (uint32_t)acc;
+  top = acc >> 32;
+
+  /*
+   * The carry out of the top word is in [-4, 5], fold it back as
+   * top * 2^256 mod p, twice: the first fold leaves a carry in [-1, 1], the
+   * second none. A zero carry folds to nothing, so the steps do not depend
+   * on the value.
+   */
+  for(j = 0; j < 2; j++) {
+    acc = 0;
+    for(i = 0; i < 8; i++) {
+      acc += (int64_t)r[i] + top * p256_fold[i];
+      r[i] = (uint32_t)acc;
+      acc >>= 32;
+    }
+    top = acc;
+  }
+
+  /* r < 2^256 < 2p, one subtraction is enough */
+  acc = 0;
+  for(i = 0; i < 8; i++) {
+    acc += (int64_t)r[i] - p256_words[i];
+    s[i] = (uint32_t)acc;
+    acc >>= 32;
+  }
+  keep = (uint32_t)acc;
+  for(i = 0; i < 8; i++) {
+    r[i] = (r[i] & keep) | (s[i] & ~keep);
+  }
+
+#ifdef THIRTYTWO_BIT_PROCESSOR
+  for(i = 0; i < KEYDIGITS; i++) {
+    a[i] = r[i];
+  }
+#else
+  for(i = 0; i < KEYDIGITS; i++) {
+    a[i] = r[2 * i] | ((NN_DIGIT)r[2 * i + 1] << 32);
+  }
+#endif
+}
+#endif /* P256_FAST_REDUCTION */
+/*---------------------------------------------------------------------------*/
 void
 NN_ModMultOpt(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c, NN_DIGIT * d, NN_DIGIT * omega, NN_UINT digits)
 {
@@ -440,7 +941,7 @@ NN_ModMultOpt(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c, NN_DIGIT * d, NN_DIGIT *
   t2[2*MAX_NN_DIGITS-1]=0;
   t2[2*MAX_NN_DIGITS-2]=0;
 
-  NN_Mult(t1, b, c, KEYDIGITS);
+  NN_MultFixed<KEYDIGITS>(t1, b, c);
 
   pt1 = &(t1[KEYDIGITS]);
   len_t2 = 2 * KEYDIGITS;
@@ -462,7 +963,7 @@ NN_ModMultOpt(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c, NN_DIGIT * d, NN_DIGIT *
     }
   }
 
-  while(NN_Cmp(t1, d, digits) > 0) {
+  while(NN_Cmp(t1, d, digits) >= 0) {
     NN_Sub(t1, t1, d, digits);
   }
 
@@ -543,7 +1044,7 @@ NN_ModSqrOpt(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * d, NN_DIGIT * omega, NN_UINT
   t2[2*MAX_NN_DIGITS-1]=0;
   t2[2*MAX_NN_DIGITS-2]=0;
 
-  NN_Sqr(t1, b, KEYDIGITS);
+  NN_SqrFixed<KEYDIGITS>(t1, b);
 
   pt1 = &(t1[KEYDIGITS]);
   len_t2 = 2*KEYDIGITS;
@@ -565,12 +1066,50 @@ NN_ModSqrOpt(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * d, NN_DIGIT * omega, NN_UINT
     }
   }
 
-  while(NN_Cmp(t1, d, digits) > 0) {
+  while(NN_Cmp(t1, d, digits) >= 0) {
     NN_Sub(t1, t1, d, digits);
   }
   NN_Assign (a, t1, digits);
 
 }
+#ifdef NN_HAVE_P256_REDUCTION
+/*---------------------------------------------------------------------------*/
+void
+NN_ModMultP256(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c, NN_UINT digits)
+{
+#ifdef NN_HOST_KERNELS
+  NN_HostModMultP256(a, b, c);
+#else
+  NN_DIGIT t[2*KEYDIGITS];
+
+#ifdef NN_RADIX29_KERNELS
+  NN_Radix29MultP256(t, b, c);
+#else
+  NN_MultFixed<KEYDIGITS>(t, b, c);
+#endif
+  NN_ModP256(a, t);
+#endif /* NN_HOST_KERNELS */
+  NN_AssignZero(&(a[KEYDIGITS]), digits - KEYDIGITS);
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_ModSqrP256(NN_DIGIT * a, NN_DIGIT * b, NN_UINT digits)
+{
+#ifdef NN_HOST_KERNELS
+  NN_HostModSqrP256(a, b);
+#else
+  NN_DIGIT t[2*KEYDIGITS];
+
+#ifdef NN_RADIX29_KERNELS
+  NN_Radix29SqrP256(t, b);
+#else
+  NN_SqrFixed<KEYDIGITS>(t, b);
+#endif
+  NN_ModP256(a, t);
+#endif /* NN_HOST_KERNELS */
+  NN_AssignZero(&(a[KEYDIGITS]), digits - KEYDIGITS);
+}
+#endif /* NN_HAVE_P256_REDUCTION */
 /*--------------------------- OTHER OPERATIONS -------------------------------*/
 void
 NN_Gcd(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_UINT digits)
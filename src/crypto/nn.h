@@ -1,6 +1,18 @@
 // AUTOGENERATED, DO NOT EDIT. See CONTRIBUTING.md for instructions.
 #define SECP256R1
+/*
+ * Digit size: 64-bit digits on 64-bit hosts with a 128-bit integer type,
+ * 32-bit digits everywhere else. Define one of the *_BIT_PROCESSOR symbols
+ * in the build to override the choice.
+ */
+#if !defined(EIGHT_BIT_PROCESSOR) && !defined(SIXTEEN_BIT_PROCESSOR) && \
+    !defined(THIRTYTWO_BIT_PROCESSOR) && !defined(SIXTY_FOUR_BIT_PROCESSOR)
+#if defined(__SIZEOF_INT128__) && defined(__SIZEOF_POINTER__) && (__SIZEOF_POINTER__ == 8)
+#define SIXTY_FOUR_BIT_PROCESSOR
+#else
 #define THIRTYTWO_BIT_PROCESSOR
+#endif
+#endif
 /**
  * \defgroup nn Natural Number Arithmatic
  *
@@ -167,6 +179,47 @@ typedef uint16_t NN_UINT2;
 
 #endif /* THIRTYTWO_BIT_PROCESSOR */
 
+/*--------------------------- 64-bit PROCESSOR -------------------------------*/
+
+#ifdef SIXTY_FOUR_BIT_PROCESSOR
+
+/* Type definitions */
+typedef uint64_t NN_DIGIT;
+__extension__ typedef unsigned __int128 NN_DOUBLE_DIGIT;
+
+/* Types for length */
+typedef uint8_t NN_UINT;
+typedef uint16_t NN_UINT2;
+
+/* Length of digit in bits */
+#define NN_DIGIT_BITS 64
+
+/* Length of digit in bytes */
+#define NN_DIGIT_LEN (NN_DIGIT_BITS/8)
+
+/* Maximum value of digit */
+#define MAX_NN_DIGIT 0xffffffffffffffffull
+
+/* Number of digits in key
+ * used by optimized mod multiplication (ModMultOpt) and optimized mod square (ModSqrOpt)
+ *
+ */
+#define KEYDIGITS (KEY_BIT_LEN/NN_DIGIT_BITS)
+
+/* Maximum length in digits */
+#define MAX_NN_DIGITS (KEYDIGITS+1)
+
+/* Buffer size should be large enough to hold order of base point
+ */
+#define NUMWORDS MAX_NN_DIGITS
+#define NUMBYTES (NUMWORDS * sizeof(NN_DIGIT))
+
+/* the mask for ModSqrOpt */
+#define MOD_SQR_MASK1 ((NN_DOUBLE_DIGIT)1 << 127)
+#define MOD_SQR_MASK2 ((NN_DOUBLE_DIGIT)1 << 64)
+
+#endif /* SIXTY_FOUR_BIT_PROCESSOR */
+
 /************************* Conversion functions *******************************/
 
 /**
@@ -309,6 +362,7 @@ void NN_ModInv(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_UINT digits);
  * \brief       Computes a = b * c mod d
  *              d is generalized mersenne prime, d = 2^KEYBITS - omega
  *              (Integer multipication with curve-specific optimizations)
+ *              The operands need only be below 2^KEYBITS, not below d.
  */
 void NN_ModMultOpt(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c, NN_DIGIT * d, NN_DIGIT * omega, NN_UINT digits);
 /**
@@ -321,9 +375,104 @@ void NN_ModDivOpt(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_DIGIT *d, NN_UINT di
  * \brief       Computes a = b^2 mod d
  *              d is generalized mersenne prime, d = 2^KEYBITS - omega
  *              (Integer multipication with curve-specific optimizations)
+ *              The operands need only be below 2^KEYBITS, not below d.
  */
 void NN_ModSqrOpt(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * d, NN_DIGIT * omega, NN_UINT digits);
 
+#if defined(SECP256R1) && (defined(THIRTYTWO_BIT_PROCESSOR) || defined(SIXTY_FOUR_BIT_PROCESSOR))
+/**
+ * Field products with a reduction dedicated to the P-256 prime: the host
+ * kernels of nn_host.h on 64-bit x86/ARM hosts, the NIST fast reduction
+ * otherwise. With 16-bit digits NN_ModMultOpt and NN_ModSqrOpt serve.
+ */
+#define NN_HAVE_P256_REDUCTION
+
+/**
+ * \brief       Computes a = b * c mod p, p being the P-256 prime
+ *              a, b, c can be same
+ *              Lengths: a[digits], b[digits], c[digits], digits >= KEYDIGITS.
+ *              The operands need only be below 2^256, not below p.
+ *              Same number of steps for every operand.
+ */
+void NN_ModMultP256(NN_DIGIT * a, NN_DIGIT * b, NN_DIGIT * c, NN_UINT digits);
+/**
+ * \brief       Computes a = b^2 mod p, p being the P-256 prime
+ *              a, b can be same
+ *              Lengths: a[digits], b[digits], digits >= KEYDIGITS.
+ *              The operand need only be below 2^256, not below p.
+ *              Same number of steps for every operand.
+ */
+void NN_ModSqrP256(NN_DIGIT * a, NN_DIGIT * b, NN_UINT digits);
+#endif
+
+/**
+ * \brief       Computes a = 1/b mod d, d being the P-256 prime.
+ *              a, b can be same
+ *              Fermat's little theorem, b^(d-2) with a fixed addition chain
+ *              of 255 squarings and 12 multiplications, on NN_ModSqrP256 and
+ *              NN_ModMultP256 where they are built. The chain is that of
+ *              d - 2 for the P-256 prime, other moduli get a wrong result.
+ *              Constant time. Returns 0 for b = 0.
+ */
+void NN_ModInvOpt(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *d, NN_DIGIT *omega, NN_UINT digits);
+
+#ifdef SIXTY_FOUR_BIT_PROCESSOR
+/**
+ * Bernstein-Yang inversion needs 128-bit intermediates
+ */
+#define NN_HAVE_SAFEGCD
+
+/**
+ * \brief       Computes a = 1/b mod c, c odd, assuming inverse exists.
+ *              a, b, c can be same
+ *              Lengths: a[digits], b[digits], c[digits].
+ *              Assumes b < c < 2^256, digits >= KEYDIGITS.
+ *              Bernstein-Yang "safegcd", 10 batches of 59 constant-time
+ *              divsteps on 62-bit signed limbs, any odd modulus.
+ */
+void NN_ModInvSafegcd(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_UINT digits);
+#endif
+
+/**
+ * Precomputed data for Barrett reduction modulo a fixed d of up to
+ * KEYDIGITS digits.
+ */
+typedef struct nn_barrett {
+  /** the modulus, one zero digit above */
+  NN_DIGIT d[KEYDIGITS + 1];
+  /** floor(2^(2 * KEYDIGITS * NN_DIGIT_BITS) / d) */
+  NN_DIGIT mu[KEYDIGITS + 1];
+  /** significant digits of d, reductions divide with NN_Mod below KEYDIGITS */
+  NN_UINT d_digits;
+} nn_barrett_t;
+
+/**
+ * \brief       Builds the Barrett context for modulus d.
+ *              Lengths: d[digits].
+ *              Runs NN_Div once. A d of KEYDIGITS significant digits (the
+ *              group order) gets Barrett reductions that never divide, a
+ *              shorter one the long division of NN_Mod.
+ *              Returns 1, or 0 if d is zero or longer than KEYDIGITS digits:
+ *              the context is left unusable.
+ */
+int NN_BarrettInit(nn_barrett_t *ctx, NN_DIGIT *d, NN_UINT digits);
+/**
+ * \brief       Computes a = b mod d, d being the modulus of ctx.
+ *              a, b can be same
+ *              Lengths: a[digits], b[b_digits].
+ *              Assumes b < 2^(2 * KEYDIGITS * NN_DIGIT_BITS).
+ *              Algorithm 14.42 in "Handbook of Applied Cryptography", with
+ *              the final corrections done by masking.
+ */
+void NN_BarrettMod(NN_DIGIT *a, NN_DIGIT *b, NN_UINT b_digits, nn_barrett_t *ctx, NN_UINT digits);
+/**
+ * \brief       Computes a = b * c mod d, d being the modulus of ctx.
+ *              a, b, c can be same
+ *              Lengths: a[digits], b[digits], c[digits].
+ *              Assumes b, c < d.
+ */
+void NN_BarrettModMult(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, nn_barrett_t *ctx, NN_UINT digits);
+
 
 /*************************** OTHER OPERATIONS ********************************/
 
@@ -0,0 +1,364 @@
+/**
+ * \defgroup nn_fixed Fixed-width Natural Number Arithmetic
+ * \ingroup nn
+ *
+ * @{
+ */
+
+/**
+ * \file
+ * Fixed-width versions of the natural number primitives in nn.h.
+ * The length is a template argument, so every loop has a constant trip count
+ * that the compiler can fully unroll, and no leading-digit trimming or
+ * data-dependent branching is done. Instantiated with KEYDIGITS they carry
+ * the field arithmetic of the curve; the generic NN_* API stays for other
+ * lengths.
+ *
+ * Carries and borrows travel through NN_DOUBLE_DIGIT arithmetic and results
+ * are selected with masks instead of branches.
+ */
+
+#ifndef __NN_FIXED_H__
+#define __NN_FIXED_H__
+
+#include "nn.h"
+
+/**
+ * \brief       Computes a = b + c. Returns carry.
+ *              a, b, c can be same
+ *              Lengths: a[DIGITS], b[DIGITS], c[DIGITS].
+ */
+template <NN_UINT DIGITS>
+static inline NN_DIGIT
+NN_AddFixed(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c)
+{
+  NN_DOUBLE_DIGIT t = 0;
+  NN_UINT i;
+
+  for(i = 0; i < DIGITS; i++) {
+    t += (NN_DOUBLE_DIGIT)b[i] + c[i];
+    a[i] = (NN_DIGIT)t;
+    t >>= NN_DIGIT_BITS;
+  }
+
+  return (NN_DIGIT)t;
+}
+
+/**
+ * \brief       Computes a = b - c. Returns borrow.
+ *              a, b, c can be same
+ *              Lengths: a[DIGITS], b[DIGITS], c[DIGITS].
+ */
+template <NN_UINT DIGITS>
+static inline NN_DIGIT
+NN_SubFixed(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c)
+{
+  NN_DOUBLE_DIGIT t;
+  NN_DIGIT borrow = 0;
+  NN_UINT i;
+
+  for(i = 0; i < DIGITS; i++) {
+    t = (NN_DOUBLE_DIGIT)b[i] - c[i] - borrow;
+    a[i] = (NN_DIGIT)t;
+    borrow = (NN_DIGIT)(t >> NN_DIGIT_BITS) & 1;
+  }
+
+  return borrow;
+}
+
+/**
+ * \brief       Adds the double digit t to the three digit column
+ *              accumulator (acc, acc2) used by the product-scanning routines.
+ */
+#define NN_COMBA_ADD(acc, acc2, t) do { \
+    NN_DOUBLE_DIGIT __t = (t);          \
+    (acc) += __t;                       \
+    (acc2) += ((acc) < __t);            \
+  } while(0)
+
+/**
+ * \brief       Stores the low digit of the column accumulator in r and
+ *              shifts it down by one digit for the next column.
+ */
+#define NN_COMBA_NEXT(r, acc, acc2) do {                              \
+    (r) = (NN_DIGIT)(acc);                                            \
+    (acc) = ((acc) >> NN_DIGIT_BITS) |                                \
+            ((NN_DOUBLE_DIGIT)(acc2) << NN_DIGIT_BITS);               \
+    (acc2) = 0;                                                       \
+  } while(0)
+
+/**
+ * \brief       Computes a = b * c.
+ *              a can not be the same as b or c
+ *              Lengths: a[2*DIGITS], b[DIGITS], c[DIGITS].
+ *              Product scanning (Comba): each output digit is the sum of
+ *              its column of partial products, kept in a three digit
+ *              accumulator, so no intermediate row goes to memory.
+ */
+template <NN_UINT DIGITS>
+static inline void
+NN_MultFixed(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c)
+{
+  NN_DOUBLE_DIGIT acc = 0;
+  NN_DIGIT acc2 = 0;
+  NN_UINT i, k;
+
+  for(k = 0; k < 2 * DIGITS - 1; k++) {
+    for(i = (k < DIGITS ? 0 : k - DIGITS + 1); i <= k && i < DIGITS; i++) {
+      NN_COMBA_ADD(acc, acc2, (NN_DOUBLE_DIGIT)b[i] * c[k - i]);
+    }
+    NN_COMBA_NEXT(a[k], acc, acc2);
+  }
+  a[2 * DIGITS - 1] = (NN_DIGIT)acc;
+}
+
+/**
+ * \brief       Computes a = b * c mod 2^(DIGITS * NN_DIGIT_BITS).
+ *              a can not be the same as b or c
+ *              Lengths: a[DIGITS], b[DIGITS], c[DIGITS].
+ *              Only the columns of the low half of the product.
+ */
+template <NN_UINT DIGITS>
+static inline void
+NN_MultLowFixed(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c)
+{
+  NN_DOUBLE_DIGIT acc = 0;
+  NN_DIGIT acc2 = 0;
+  NN_UINT i, k;
+
+  for(k = 0; k < DIGITS; k++) {
+    for(i = 0; i <= k; i++) {
+      NN_COMBA_ADD(acc, acc2, (NN_DOUBLE_DIGIT)b[i] * c[k - i]);
+    }
+    NN_COMBA_NEXT(a[k], acc, acc2);
+  }
+}
+
+/**
+ * \brief       Computes a[FROM..2*DIGITS-1], the high digits of b * c,
+ *              leaving out the columns below FROM.
+ *              a can not be the same as b or c
+ *              Lengths: a[2*DIGITS], b[DIGITS], c[DIGITS].
+ *              The missing carry makes the result up to FROM * 2^NN_DIGIT_BITS
+ *              too small in units of digit FROM, see HAC 14.44.
+ */
+template <NN_UINT DIGITS, NN_UINT FROM>
+static inline void
+NN_MultHighFixed(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c)
+{
+  NN_DOUBLE_DIGIT acc = 0;
+  NN_DIGIT acc2 = 0;
+  NN_UINT i, k;
+
+  for(k = FROM; k < 2 * DIGITS - 1; k++) {
+    for(i = (k < DIGITS ? 0 : k - DIGITS + 1); i <= k && i < DIGITS; i++) {
+      NN_COMBA_ADD(acc, acc2, (NN_DOUBLE_DIGIT)b[i] * c[k - i]);
+    }
+    NN_COMBA_NEXT(a[k], acc, acc2);
+  }
+  a[2 * DIGITS - 1] = (NN_DIGIT)acc;
+}
+
+/**
+ * \brief       Computes a = b^2.
+ *              a can not be the same as b
+ *              Lengths: a[2*DIGITS], b[DIGITS].
+ *              Product scanning as NN_MultFixed, with each cross product
+ *              b[i]*b[j], i < j, computed once and doubled: about half the
+ *              digit multiplications of a general product.
+ */
+template <NN_UINT DIGITS>
+static inline void
+NN_SqrFixed(NN_DIGIT *a, const NN_DIGIT *b)
+{
+  NN_DOUBLE_DIGIT acc = 0, cross;
+  NN_DIGIT acc2 = 0, cross2;
+  NN_UINT i, k;
+
+  for(k = 0; k < 2 * DIGITS - 1; k++) {
+    cross = 0;
+    cross2 = 0;
+    for(i = (k < DIGITS ? 0 : k - DIGITS + 1); 2 * i < k; i++) {
+      NN_COMBA_ADD(cross, cross2, (NN_DOUBLE_DIGIT)b[i] * b[k - i]);
+    }
+    /* double the cross products, cross2 stays below two digits of headroom */
+    acc2 += (cross2 << 1) | (NN_DIGIT)(cross >> (2 * NN_DIGIT_BITS - 1));
+    NN_COMBA_ADD(acc, acc2, cross << 1);
+    if((k & 1) == 0) {
+      NN_COMBA_ADD(acc, acc2, (NN_DOUBLE_DIGIT)b[k / 2] * b[k / 2]);
+    }
+    NN_COMBA_NEXT(a[k], acc, acc2);
+  }
+  a[2 * DIGITS - 1] = (NN_DIGIT)acc;
+}
+
+/**
+ * \brief       Computes a = (b + c) mod d.
+ *              a, b, c can be same
+ *              Assumption: b, c are in [0, d)
+ *              Lengths: a[DIGITS], b[DIGITS], c[DIGITS], d[DIGITS].
+ */
+template <NN_UINT DIGITS>
+static inline void
+NN_ModAddFixed(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c, const NN_DIGIT *d)
+{
+  NN_DIGIT sum[DIGITS];
+  NN_DIGIT diff[DIGITS];
+  NN_DIGIT carry, borrow, keep;
+  NN_UINT i;
+
+  carry = NN_AddFixed<DIGITS>(sum, b, c);
+  borrow = NN_SubFixed<DIGITS>(diff, sum, d);
+
+  /* keep the sum only if it did not overflow and is below d */
+  keep = (NN_DIGIT)0 - (borrow & (carry ^ 1));
+  for(i = 0; i < DIGITS; i++) {
+    a[i] = (sum[i] & keep) | (diff[i] & ~keep);
+  }
+}
+
+/**
+ * \brief       Computes a = (b - c) mod d.
+ *              a, b, c can be same
+ *              Assumption: b, c are in [0, d)
+ *              Lengths: a[DIGITS], b[DIGITS], c[DIGITS], d[DIGITS].
+ *              d is always added, masked to zero without a borrow, so the
+ *              time does not tell whether b < c. NN_ModSub, which skips the
+ *              addition, only wins when its branch is always predicted.
+ */
+template <NN_UINT DIGITS>
+static inline void
+NN_ModSubFixed(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c, const NN_DIGIT *d)
+{
+  NN_DIGIT dd[DIGITS];
+  NN_DIGIT mask;
+  NN_UINT i;
+
+  /* add d back when the subtraction borrowed */
+  mask = (NN_DIGIT)0 - NN_SubFixed<DIGITS>(a, b, c);
+  for(i = 0; i < DIGITS; i++) {
+    dd[i] = d[i] & mask;
+  }
+  NN_AddFixed<DIGITS>(a, a, dd);
+}
+
+/**
+ * \brief       Computes a = b / 2 mod d, d odd.
+ *              a, b can be same
+ *              Assumption: b is in [0, d)
+ *              Lengths: a[DIGITS], b[DIGITS], d[DIGITS].
+ */
+template <NN_UINT DIGITS>
+static inline void
+NN_ModHalfFixed(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *d)
+{
+  NN_DIGIT dd[DIGITS];
+  NN_DIGIT mask, carry;
+  NN_UINT i;
+
+  /* make b even by adding d when it is odd, then shift the carry back in */
+  mask = (NN_DIGIT)0 - (b[0] & 1);
+  for(i = 0; i < DIGITS; i++) {
+    dd[i] = d[i] & mask;
+  }
+  carry = NN_AddFixed<DIGITS>(a, b, dd);
+  for(i = 0; i < DIGITS - 1; i++) {
+    a[i] = (a[i] >> 1) | (a[i + 1] << (NN_DIGIT_BITS - 1));
+  }
+  a[DIGITS - 1] = (a[DIGITS - 1] >> 1) | (carry << (NN_DIGIT_BITS - 1));
+}
+
+/*
+ * Lazy reduction. The results below are only brought under
+ * 2^(DIGITS*NN_DIGIT_BITS), not under d: a multiplication reduces its
+ * product anyway, so a sum that only feeds one can skip the comparison
+ * with d. omega = 2^(DIGITS*NN_DIGIT_BITS) - d, the value a carry out of
+ * the top digit is worth mod d.
+ */
+
+/**
+ * \brief       Computes a = (b + c) mod d, a < 2^(DIGITS*NN_DIGIT_BITS).
+ *              a, b, c can be same
+ *              Assumption: c is in [0, d), b needs not be reduced
+ *              Lengths: a[DIGITS], b[DIGITS], c[DIGITS], omega[DIGITS].
+ */
+template <NN_UINT DIGITS>
+static inline void
+NN_ModAddLazyFixed(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c, const NN_DIGIT *omega)
+{
+  NN_DIGIT oo[DIGITS];
+  NN_DIGIT mask;
+  NN_UINT i;
+
+  /* b + c < 2^(DIGITS*NN_DIGIT_BITS) + d, folding the carry cannot carry */
+  mask = (NN_DIGIT)0 - NN_AddFixed<DIGITS>(a, b, c);
+  for(i = 0; i < DIGITS; i++) {
+    oo[i] = omega[i] & mask;
+  }
+  NN_AddFixed<DIGITS>(a, a, oo);
+}
+
+/**
+ * \brief       Computes a = k * b mod d, a < 2^(DIGITS*NN_DIGIT_BITS).
+ *              a, b can be same
+ *              Assumption: 2 <= k <= 8, 8 * omega <= 2^(DIGITS*NN_DIGIT_BITS),
+ *              b needs not be reduced
+ *              Lengths: a[DIGITS], b[DIGITS], omega[DIGITS].
+ *              Replaces the chains of doublings and additions that make
+ *              3b, 4b or 8b with a single pass and two folds.
+ */
+template <NN_UINT DIGITS>
+static inline void
+NN_ModMultSmallLazyFixed(NN_DIGIT *a, const NN_DIGIT *b, NN_DIGIT k, const NN_DIGIT *omega)
+{
+  NN_DOUBLE_DIGIT t = 0;
+  NN_DIGIT oo[DIGITS];
+  NN_DIGIT top, mask;
+  NN_UINT i;
+
+  for(i = 0; i < DIGITS; i++) {
+    t += (NN_DOUBLE_DIGIT)b[i] * k;
+    a[i] = (NN_DIGIT)t;
+    t >>= NN_DIGIT_BITS;
+  }
+  top = (NN_DIGIT)t;
+
+  /* top < k, top * omega < 2^(DIGITS*NN_DIGIT_BITS): at most one carry */
+  t = 0;
+  for(i = 0; i < DIGITS; i++) {
+    t += (NN_DOUBLE_DIGIT)a[i] + (NN_DOUBLE_DIGIT)omega[i] * top;
+    a[i] = (NN_DIGIT)t;
+    t >>= NN_DIGIT_BITS;
+  }
+
+  /* what is left is below top * omega, one more fold cannot carry */
+  mask = (NN_DIGIT)0 - (NN_DIGIT)t;
+  for(i = 0; i < DIGITS; i++) {
+    oo[i] = omega[i] & mask;
+  }
+  NN_AddFixed<DIGITS>(a, a, oo);
+}
+
+/**
+ * \brief       Computes a = b mod d for a lazily reduced b.
+ *              a, b can be same
+ *              Assumption: b < 2d
+ *              Lengths: a[DIGITS], b[DIGITS], d[DIGITS].
+ */
+template <NN_UINT DIGITS>
+static inline void
+NN_ModReduceLazyFixed(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *d)
+{
+  NN_DIGIT diff[DIGITS];
+  NN_DIGIT keep;
+  NN_UINT i;
+
+  keep = (NN_DIGIT)0 - NN_SubFixed<DIGITS>(diff, b, d);
+  for(i = 0; i < DIGITS; i++) {
+    a[i] = (b[i] & keep) | (diff[i] & ~keep);
+  }
+}
+
+#endif /* __NN_FIXED_H__ */
+
+/** @} */
@@ -0,0 +1,298 @@
+/**
+ * \addtogroup nn_host
+ * @{
+ */
+
+/**
+ * \file
+ * P-256 field kernels for 64-bit hosts, see nn_host.h.
+ */
+
+#include "nn_host.h"
+
+#ifdef NN_HOST_KERNELS
+
+#include "nn_fixed.h"
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+__extension__ typedef __int128 NN_SDOUBLE_DIGIT;
+
+typedef void (*p256_mult_fn)(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c);
+typedef void (*p256_sqr_fn)(NN_DIGIT *a, const NN_DIGIT *b);
+
+#define LO32 0x00000000ffffffffull
+#define HI32 0xffffffff00000000ull
+
+/*
+ * p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+ */
+static const NN_DIGIT p256[KEYDIGITS] = {
+  0xffffffffffffffffull, 0x00000000ffffffffull,
+  0x0000000000000000ull, 0xffffffff00000001ull
+};
+/*---------------------------------------------------------------------------*/
+/*
+ * r = r + top * (2^256 mod p), with 2^256 mod p = 2^224 - 2^192 - 2^96 + 1.
+ * Returns the signed carry out of r.
+ */
+static inline int64_t
+p256_fold(NN_DIGIT *r, int64_t top)
+{
+  NN_SDOUBLE_DIGIT acc;
+
+  acc = (NN_SDOUBLE_DIGIT)r[0] + top;
+  r[0] = (NN_DIGIT)acc;
+  acc >>= NN_DIGIT_BITS;
+  acc += (NN_SDOUBLE_DIGIT)r[1] - ((NN_SDOUBLE_DIGIT)top << 32);
+  r[1] = (NN_DIGIT)acc;
+  acc >>= NN_DIGIT_BITS;
+  acc += r[2];
+  r[2] = (NN_DIGIT)acc;
+  acc >>= NN_DIGIT_BITS;
+  acc += (NN_SDOUBLE_DIGIT)r[3] + (NN_SDOUBLE_DIGIT)top * LO32;
+  r[3] = (NN_DIGIT)acc;
+  return (int64_t)(acc >> NN_DIGIT_BITS);
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Computes a = t mod p
+ *                    Lengths: a[KEYDIGITS], t[2*KEYDIGITS].
+ *                    The fast reduction of NN_ModP256 with its 32-bit words
+ *                    c15..c0 regrouped into 64-bit limbs: every term
+ *                    s1..s9 is assembled from the product digits with
+ *                    shifts and masks and summed limb by limb.
+ */
+static inline void
+p256_reduce(NN_DIGIT *a, const NN_DIGIT *t)
+{
+  const NN_DIGIT t4 = t[4], t5 = t[5], t6 = t[6], t7 = t[7];
+  NN_DIGIT r[KEYDIGITS], s[KEYDIGITS], keep;
+  NN_SDOUBLE_DIGIT acc;
+  int64_t top;
+  NN_UINT i;
+
+  /* s1 + s4 + s5 - s6 - s7 - s8 - s9 */
+  acc = (NN_SDOUBLE_DIGIT)t[0] + t4 + ((t4 >> 32) | (t5 << 32))
+        - ((t5 >> 32) | (t6 << 32)) - t6 - ((t6 >> 32) | (t7 << 32)) - t7;
+  r[0] = (NN_DIGIT)acc;
+  acc >>= NN_DIGIT_BITS;
+  /* s1 + 2s2 + 2s3 + s4 + s5 - s6 - s7 - s8 - s9 */
+  acc += (NN_SDOUBLE_DIGIT)t[1] + 2 * (NN_SDOUBLE_DIGIT)(t5 & HI32)
+         + 2 * (NN_SDOUBLE_DIGIT)(t6 << 32) + (t5 & LO32)
+         + ((t5 >> 32) | (t6 & HI32))
+         - (t6 >> 32) - t7 - ((t7 >> 32) | (t4 << 32)) - (t4 & HI32);
+  r[1] = (NN_DIGIT)acc;
+  acc >>= NN_DIGIT_BITS;
+  /* s1 + 2s2 + 2s3 + s5 - s8 - s9 */
+  acc += (NN_SDOUBLE_DIGIT)t[2] + 2 * (NN_SDOUBLE_DIGIT)t6
+         + 2 * (NN_SDOUBLE_DIGIT)((t6 >> 32) | (t7 << 32)) + t7
+         - ((t4 >> 32) | (t5 << 32)) - t5;
+  r[2] = (NN_DIGIT)acc;
+  acc >>= NN_DIGIT_BITS;
+  /* s1 + 2s2 + 2s3 + s4 + s5 - s6 - s7 - s8 - s9 */
+  acc += (NN_SDOUBLE_DIGIT)t[3] + 2 * (NN_SDOUBLE_DIGIT)t7 + 2 * (t7 >> 32) + t7
+         + ((t6 >> 32) | (t4 << 32))
+         - ((t4 & LO32) | (t5 << 32)) - ((t4 >> 32) | (t5 & HI32))
+         - (t6 << 32) - (t6 & HI32);
+  r[3] = (NN_DIGIT)acc;
+  top = (int64_t)(acc >> NN_DIGIT_BITS);
+
+  /*
+   * top is in [-4, 6]. The first fold leaves a carry of -1, 0 or 1, and
+   * when there is one the second fold cannot carry again: two folds always
+   * bring r into [0, 2^256), without a data dependent loop.
+   */
+  top = p256_fold(r, top);
+  p256_fold(r, top);
+
+  /* r < 2^256 < 2p, one subtraction is enough */
+  keep = (NN_DIGIT)0 - NN_SubFixed<KEYDIGITS>(s, r, p256);
+  for(i = 0; i < KEYDIGITS; i++) {
+    a[i] = (r[i] & keep) | (s[i] & ~keep);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Portable kernels, the 128-bit products compile to MUL/UMULH on ARM64 and
+ * to MUL on x86-64.
+ */
+static void
+p256_mult_int128(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c)
+{
+  NN_DIGIT t[2 * KEYDIGITS];
+
+  NN_MultFixed<KEYDIGITS>(t, b, c);
+  p256_reduce(a, t);
+}
+/*---------------------------------------------------------------------------*/
+static void
+p256_sqr_int128(NN_DIGIT *a, const NN_DIGIT *b)
+{
+  NN_DIGIT t[2 * KEYDIGITS];
+
+  NN_SqrFixed<KEYDIGITS>(t, b);
+  p256_reduce(a, t);
+}
+/*---------------------------------------------------------------------------*/
+#if defined(__x86_64__)
+/*
+ * BMI2/ADX kernel. MULX leaves the flags alone, so each row of partial
+ * products is accumulated with two independent carry chains: ADCX adds the
+ * low halves through CF while ADOX adds the high halves through OF. Written
+ * in assembly because compilers serialize the two chains through SETC.
+ *
+ * t[0..7] = a[0..3] * b[0..3]
+ */
+#define MULX_ROW(b_off, l0, l1, l2, l3, h)                    \
+  "movq " b_off "(%[b]), %%rdx\n\t"                           \
+  "xorl %%r8d, %%r8d\n\t"                                     \
+  "mulx 0(%[a]), %%rax, %%rcx\n\t"                            \
+  "adcx %%rax, " l0 "\n\t"                                    \
+  "adox %%rcx, " l1 "\n\t"                                    \
+  "mulx 8(%[a]), %%rax, %%rcx\n\t"                            \
+  "adcx %%rax, " l1 "\n\t"                                    \
+  "adox %%rcx, " l2 "\n\t"                                    \
+  "mulx 16(%[a]), %%rax, %%rcx\n\t"                           \
+  "adcx %%rax, " l2 "\n\t"                                    \
+  "adox %%rcx, " l3 "\n\t"                                    \
+  "mulx 24(%[a]), %%rax, " h "\n\t"                           \
+  "adcx %%rax, " l3 "\n\t"                                    \
+  "adox %%r8, " h "\n\t"                                      \
+  "adcx %%r8, " h "\n\t"
+
+static inline void
+mult_4x4_mulx(NN_DIGIT *t, const NN_DIGIT *a, const NN_DIGIT *b)
+{
+  __asm__ volatile(
+    /* first row, a single carry chain */
+    "movq 0(%[b]), %%rdx\n\t"
+    "mulx 0(%[a]), %%r8, %%r9\n\t"
+    "mulx 8(%[a]), %%rax, %%r10\n\t"
+    "addq %%rax, %%r9\n\t"
+    "mulx 16(%[a]), %%rax, %%r11\n\t"
+    "adcq %%rax, %%r10\n\t"
+    "mulx 24(%[a]), %%rax, %%r12\n\t"
+    "adcq %%rax, %%r11\n\t"
+    "adcq $0, %%r12\n\t"
+    "movq %%r8, 0(%[t])\n\t"
+    MULX_ROW("8", "%%r9", "%%r10", "%%r11", "%%r12", "%%r13")
+    "movq %%r9, 8(%[t])\n\t"
+    MULX_ROW("16", "%%r10", "%%r11", "%%r12", "%%r13", "%%r14")
+    "movq %%r10, 16(%[t])\n\t"
+    MULX_ROW("24", "%%r11", "%%r12", "%%r13", "%%r14", "%%r15")
+    "movq %%r11, 24(%[t])\n\t"
+    "movq %%r12, 32(%[t])\n\t"
+    "movq %%r13, 40(%[t])\n\t"
+    "movq %%r14, 48(%[t])\n\t"
+    "movq %%r15, 56(%[t])\n\t"
+    :
+    : [t] "r" (t), [a] "r" (a), [b] "r" (b)
+    : "rax", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14",
+      "r15", "cc", "memory");
+}
+/*---------------------------------------------------------------------------*/
+static void
+p256_mult_mulx(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c)
+{
+  NN_DIGIT t[2 * KEYDIGITS];
+
+  mult_4x4_mulx(t, b, c);
+  p256_reduce(a, t);
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Squaring reuses the product: with four digits the six cross products
+ * saved by a dedicated squaring cost about as much as the extra shifts and
+ * carry fixups it needs.
+ */
+static void
+p256_sqr_mulx(NN_DIGIT *a, const NN_DIGIT *b)
+{
+  NN_DIGIT t[2 * KEYDIGITS];
+
+  mult_4x4_mulx(t, b, b);
+  p256_reduce(a, t);
+}
+/*---------------------------------------------------------------------------*/
+static int
+cpu_has_mulx_adx(void)
+{
+  unsigned int eax, ebx, ecx, edx;
+
+  if(!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+    return 0;
+  }
+  /* leaf 7: EBX bit 8 is BMI2, bit 19 is ADX */
+  return (ebx & (1u << 8)) && (ebx & (1u << 19));
+}
+#endif /* __x86_64__ */
+/*---------------------------------------------------------------------------*/
+static void p256_mult_select(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c);
+static void p256_sqr_select(NN_DIGIT *a, const NN_DIGIT *b);
+
+static p256_mult_fn p256_mult = p256_mult_select;
+static p256_sqr_fn p256_sqr = p256_sqr_select;
+static const char *kernel_name = "int128";
+
+/*
+ * Resolves the kernels on first use. Concurrent first calls all store the
+ * same pointers.
+ */
+static void
+p256_select(void)
+{
+#if defined(__x86_64__)
+  if(cpu_has_mulx_adx()) {
+    kernel_name = "mulx-adx";
+    p256_sqr = p256_sqr_mulx;
+    p256_mult = p256_mult_mulx;
+    return;
+  }
+#endif
+  kernel_name = "int128";
+  p256_sqr = p256_sqr_int128;
+  p256_mult = p256_mult_int128;
+}
+/*---------------------------------------------------------------------------*/
+static void
+p256_mult_select(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c)
+{
+  p256_select();
+  p256_mult(a, b, c);
+}
+/*---------------------------------------------------------------------------*/
+static void
+p256_sqr_select(NN_DIGIT *a, const NN_DIGIT *b)
+{
+  p256_select();
+  p256_sqr(a, b);
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_HostModMultP256(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c)
+{
+  p256_mult(a, b, c);
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_HostModSqrP256(NN_DIGIT *a, const NN_DIGIT *b)
+{
+  p256_sqr(a, b);
+}
+/*---------------------------------------------------------------------------*/
+const char *
+NN_HostKernelName(void)
+{
+  if(p256_mult == p256_mult_select) {
+    p256_select();
+  }
+  return kernel_name;
+}
+/*---------------------------------------------------------------------------*/
+
+#endif /* NN_HOST_KERNELS */
+
+/** @} */
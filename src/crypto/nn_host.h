@@ -0,0 +1,62 @@
+/**
+ * \defgroup nn_host Host field kernels
+ * \ingroup nn
+ *
+ * @{
+ */
+
+/**
+ * \file
+ * P-256 field multiplication and squaring kernels for 64-bit hosts.
+ * Each kernel computes the 4x64-bit product and reduces it in the same
+ * function with the NIST fast reduction on 64-bit limbs. The best kernel
+ * for the running CPU is picked on first use:
+ *  - x86-64 with BMI2 and ADX: MULX products with ADCX/ADOX carry chains,
+ *  - otherwise: 128-bit integer products (MUL/UMULH on ARM64).
+ *
+ * NN_ModMultP256 and NN_ModSqrP256 forward to these kernels when
+ * NN_HOST_KERNELS is defined, callers keep using the nn.h API. Define
+ * NN_NO_HOST_KERNELS in the build to keep the portable code path.
+ */
+
+#ifndef __NN_HOST_H__
+#define __NN_HOST_H__
+
+#include "nn.h"
+
+#if defined(SECP256R1) && defined(SIXTY_FOUR_BIT_PROCESSOR) && \
+    (defined(__x86_64__) || defined(__aarch64__)) && !defined(NN_NO_HOST_KERNELS)
+#define NN_HOST_KERNELS
+#endif
+
+#ifdef NN_HOST_KERNELS
+
+/**
+ * \brief             Computes a = b * c mod p, p being the P-256 prime
+ *                    a, b, c can be same
+ *                    Assumption: b, c are in [0, 2^256), the result is
+ *                    reduced whatever their range
+ *                    Lengths: a[KEYDIGITS], b[KEYDIGITS], c[KEYDIGITS].
+ */
+void NN_HostModMultP256(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c);
+
+/**
+ * \brief             Computes a = b^2 mod p, p being the P-256 prime
+ *                    a, b can be same
+ *                    Assumption: b is in [0, 2^256), the result is
+ *                    reduced whatever its range
+ *                    Lengths: a[KEYDIGITS], b[KEYDIGITS].
+ */
+void NN_HostModSqrP256(NN_DIGIT *a, const NN_DIGIT *b);
+
+/**
+ * \brief             Returns the name of the selected kernel ("mulx-adx" or
+ *                    "int128").
+ */
+const char *NN_HostKernelName(void);
+
+#endif /* NN_HOST_KERNELS */
+
+#endif /* __NN_HOST_H__ */
+
+/** @} */
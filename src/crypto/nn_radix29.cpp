@@ -0,0 +1,144 @@
+/**
+ * \addtogroup nn_radix29
+ * @{
+ */
+
+/**
+ * \file
+ * P-256 field products on unsaturated 29-bit limbs, see nn_radix29.h.
+ */
+
+#include "nn_radix29.h"
+
+#ifdef NN_RADIX29_KERNELS
+
+#define R29_BITS 29
+#define R29_LIMBS 9
+#define R29_MASK ((1u << R29_BITS) - 1)
+
+/*
+ * Everything below is spelled out with constant indices, the Arduino cores
+ * build with -Os which keeps the loops and turns every limb offset into a
+ * division by 29.
+ */
+
+/* limb i of b, bits 29*i .. 29*i+28 */
+#define R29_LIMB(l, b, i)                                                   \
+  l[i] = (uint32_t)((((uint64_t)b[(R29_BITS * (i)) / 32]) |                 \
+                     ((R29_BITS * (i)) / 32 + 1 < KEYDIGITS ?               \
+                      (uint64_t)b[(R29_BITS * (i)) / 32 + 1] << 32 : 0))    \
+                    >> ((R29_BITS * (i)) % 32)) & R29_MASK
+
+/* the only carry chain of the product */
+#define R29_NORM(l, col, k, carry)                                          \
+  v = col[k] + carry;                                                       \
+  l[k] = (uint32_t)v & R29_MASK;                                            \
+  carry = v >> R29_BITS
+
+/* word k spans limbs i, i+1 and maybe i+2 */
+#define R29_WORD(a, l, k)                                                   \
+  a[k] = (uint32_t)((l[(32 * (k)) / R29_BITS] |                            \
+                     ((uint64_t)l[(32 * (k)) / R29_BITS + 1] << 29) |       \
+                     ((uint64_t)l[(32 * (k)) / R29_BITS + 2] << 58))        \
+                    >> ((32 * (k)) % R29_BITS))
+
+#define R29_MAC(i, j) col[(i) + (j)] += (uint64_t)x[i] * y[j]
+#define R29_ROW(i)                                                          \
+  R29_MAC(i, 0); R29_MAC(i, 1); R29_MAC(i, 2); R29_MAC(i, 3);               \
+  R29_MAC(i, 4); R29_MAC(i, 5); R29_MAC(i, 6); R29_MAC(i, 7);               \
+  R29_MAC(i, 8)
+
+#define R29_SQR(i) col[2 * (i)] += (uint64_t)x[i] * x[i]
+#define R29_MAC2(i, j) col[(i) + (j)] += (uint64_t)x2[i] * x[j]
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Splits the KEYDIGITS words of b into R29_LIMBS limbs
+ */
+static inline void
+r29_split(uint32_t *l, const NN_DIGIT *b)
+{
+  R29_LIMB(l, b, 0); R29_LIMB(l, b, 1); R29_LIMB(l, b, 2);
+  R29_LIMB(l, b, 3); R29_LIMB(l, b, 4); R29_LIMB(l, b, 5);
+  R29_LIMB(l, b, 6); R29_LIMB(l, b, 7); R29_LIMB(l, b, 8);
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Resolves the carries of the 2*R29_LIMBS-1 columns and
+ *                    packs the result into 2*KEYDIGITS words
+ *                    Assumption: the columns add up to less than 2^512
+ */
+static inline void
+r29_pack(NN_DIGIT *a, const uint64_t *col)
+{
+  uint32_t l[2 * R29_LIMBS + 1];
+  uint64_t v, carry = 0;
+
+  R29_NORM(l, col, 0, carry);  R29_NORM(l, col, 1, carry);
+  R29_NORM(l, col, 2, carry);  R29_NORM(l, col, 3, carry);
+  R29_NORM(l, col, 4, carry);  R29_NORM(l, col, 5, carry);
+  R29_NORM(l, col, 6, carry);  R29_NORM(l, col, 7, carry);
+  R29_NORM(l, col, 8, carry);  R29_NORM(l, col, 9, carry);
+  R29_NORM(l, col, 10, carry); R29_NORM(l, col, 11, carry);
+  R29_NORM(l, col, 12, carry); R29_NORM(l, col, 13, carry);
+  R29_NORM(l, col, 14, carry); R29_NORM(l, col, 15, carry);
+  R29_NORM(l, col, 16, carry);
+  l[2 * R29_LIMBS - 1] = (uint32_t)carry;
+  l[2 * R29_LIMBS] = 0;
+
+  R29_WORD(a, l, 0);  R29_WORD(a, l, 1);  R29_WORD(a, l, 2);
+  R29_WORD(a, l, 3);  R29_WORD(a, l, 4);  R29_WORD(a, l, 5);
+  R29_WORD(a, l, 6);  R29_WORD(a, l, 7);  R29_WORD(a, l, 8);
+  R29_WORD(a, l, 9);  R29_WORD(a, l, 10); R29_WORD(a, l, 11);
+  R29_WORD(a, l, 12); R29_WORD(a, l, 13); R29_WORD(a, l, 14);
+  R29_WORD(a, l, 15);
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_Radix29MultP256(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c)
+{
+  uint32_t x[R29_LIMBS], y[R29_LIMBS];
+  uint64_t col[2 * R29_LIMBS - 1] = { 0 };
+
+  r29_split(x, b);
+  r29_split(y, c);
+
+  /* a column is at most 9 products below 2^58, no carry to track */
+  R29_ROW(0); R29_ROW(1); R29_ROW(2);
+  R29_ROW(3); R29_ROW(4); R29_ROW(5);
+  R29_ROW(6); R29_ROW(7); R29_ROW(8);
+
+  r29_pack(a, col);
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_Radix29SqrP256(NN_DIGIT *a, const NN_DIGIT *b)
+{
+  uint32_t x[R29_LIMBS], x2[R29_LIMBS];
+  uint64_t col[2 * R29_LIMBS - 1] = { 0 };
+
+  r29_split(x, b);
+
+  /* cross products once, doubled through the 30-bit 2*x[i] */
+  x2[0] = x[0] << 1; x2[1] = x[1] << 1; x2[2] = x[2] << 1;
+  x2[3] = x[3] << 1; x2[4] = x[4] << 1; x2[5] = x[5] << 1;
+  x2[6] = x[6] << 1; x2[7] = x[7] << 1;
+  R29_SQR(0); R29_MAC2(0, 1); R29_MAC2(0, 2); R29_MAC2(0, 3); R29_MAC2(0, 4);
+  R29_MAC2(0, 5); R29_MAC2(0, 6); R29_MAC2(0, 7); R29_MAC2(0, 8);
+  R29_SQR(1); R29_MAC2(1, 2); R29_MAC2(1, 3); R29_MAC2(1, 4); R29_MAC2(1, 5);
+  R29_MAC2(1, 6); R29_MAC2(1, 7); R29_MAC2(1, 8);
+  R29_SQR(2); R29_MAC2(2, 3); R29_MAC2(2, 4); R29_MAC2(2, 5); R29_MAC2(2, 6);
+  R29_MAC2(2, 7); R29_MAC2(2, 8);
+  R29_SQR(3); R29_MAC2(3, 4); R29_MAC2(3, 5); R29_MAC2(3, 6); R29_MAC2(3, 7);
+  R29_MAC2(3, 8);
+  R29_SQR(4); R29_MAC2(4, 5); R29_MAC2(4, 6); R29_MAC2(4, 7); R29_MAC2(4, 8);
+  R29_SQR(5); R29_MAC2(5, 6); R29_MAC2(5, 7); R29_MAC2(5, 8);
+  R29_SQR(6); R29_MAC2(6, 7); R29_MAC2(6, 8);
+  R29_SQR(7); R29_MAC2(7, 8);
+  R29_SQR(8);
+
+  r29_pack(a, col);
+}
+
+#endif /* NN_RADIX29_KERNELS */
+
+/** @} */
@@ -0,0 +1,54 @@
+/**
+ * \defgroup nn_radix29 Unsaturated field products
+ * \ingroup nn
+ *
+ * @{
+ */
+
+/**
+ * \file
+ * P-256 field products on unsaturated 29-bit limbs for 32-bit cores
+ * without a carry flag (the Xtensa cores of the ESP32).
+ * The saturated Comba products of nn_fixed.h keep a three digit column
+ * accumulator, each partial product costs an extra compare for the carry
+ * into the third digit. Here the operands are split into 9 limbs of 29 bits,
+ * so a column of up to 9 products of 58 bits fits a 64-bit accumulator with
+ * room to spare: the carries are resolved once, when the 17 columns are
+ * normalized back to 32-bit words for the reduction of NN_ModP256. The cost
+ * is 81 partial products instead of 64 (45 instead of 36 for a square).
+ *
+ * Define NN_RADIX29 in the build to make NN_ModMultP256 and NN_ModSqrP256 use
+ * these products; the saturated ones stay the default. Only 32-bit digits
+ * without the host kernels are covered.
+ */
+
+#ifndef __NN_RADIX29_H__
+#define __NN_RADIX29_H__
+
+#include "nn.h"
+
+#if defined(NN_RADIX29) && defined(SECP256R1) && defined(THIRTYTWO_BIT_PROCESSOR)
+#define NN_RADIX29_KERNELS
+#endif
+
+#ifdef NN_RADIX29_KERNELS
+
+/**
+ * \brief             Computes a = b * c
+ *                    a can not be the same as b or c
+ *                    Lengths: a[2*KEYDIGITS], b[KEYDIGITS], c[KEYDIGITS].
+ */
+void NN_Radix29MultP256(NN_DIGIT *a, const NN_DIGIT *b, const NN_DIGIT *c);
+
+/**
+ * \brief             Computes a = b^2
+ *                    a can not be the same as b
+ *                    Lengths: a[2*KEYDIGITS], b[KEYDIGITS].
+ */
+void NN_Radix29SqrP256(NN_DIGIT *a, const NN_DIGIT *b);
+
+#endif /* NN_RADIX29_KERNELS */
+
+#endif /* __NN_RADIX29_H__ */
+
+/** @} */
@@ -0,0 +1,523 @@
+/**
+ * \addtogroup nn_x4
+ * @{
+ */
+
+/**
+ * \file
+ * 4-way P-256 field arithmetic on AVX2 or NEON, see nn_x4.h.
+ */
+
+#include "nn_x4.h"
+
+#ifdef NN_X4_KERNELS
+
+#define X4_BITS 26
+#define X4_MASK ((1u << X4_BITS) - 1)
+/* bits of the top limb below 2^256 */
+#define X4_TOP_BITS (KEY_BIT_LEN - X4_BITS * (NN_X4_LIMBS - 1))
+/* columns of a product */
+#define X4_COLS (2 * NN_X4_LIMBS - 1)
+
+/*
+ * One vector holds limb i of the four elements, each in a 64-bit lane.
+ * x4_mul multiplies the low 32 bits of the lanes into the whole lane.
+ * The functions using the vectors are compiled for AVX2 whatever the build
+ * flags, they only run once NN_X4Available() said so. Their loops run over
+ * the limbs and are unrolled so that the limbs stay in registers.
+ */
+#if defined(__x86_64__)
+#include <immintrin.h>
+#include <cpuid.h>
+
+#define X4_TARGET __attribute__((target("avx2"), optimize("unroll-loops")))
+
+typedef __m256i x4_v;
+
+static inline X4_TARGET x4_v
+x4_load(const uint32_t *l)
+{
+  return _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *)l));
+}
+
+static inline X4_TARGET void
+x4_store(uint32_t *l, x4_v a)
+{
+  const __m256i low = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+  _mm_storeu_si128((__m128i *)l,
+                   _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(a, low)));
+}
+
+static inline X4_TARGET x4_v
+x4_set(uint64_t c)
+{
+  return _mm256_set1_epi64x((long long)c);
+}
+
+static inline X4_TARGET x4_v
+x4_add(x4_v a, x4_v b)
+{
+  return _mm256_add_epi64(a, b);
+}
+
+static inline X4_TARGET x4_v
+x4_sub(x4_v a, x4_v b)
+{
+  return _mm256_sub_epi64(a, b);
+}
+
+static inline X4_TARGET x4_v
+x4_and(x4_v a, x4_v b)
+{
+  return _mm256_and_si256(a, b);
+}
+
+static inline X4_TARGET x4_v
+x4_mul(x4_v a, x4_v b)
+{
+  return _mm256_mul_epu32(a, b);
+}
+
+#define x4_shl(a, n) _mm256_slli_epi64(a, n)
+#define x4_shr(a, n) _mm256_srli_epi64(a, n)
+
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+
+#define X4_TARGET __attribute__((optimize("unroll-loops")))
+
+typedef struct {
+  uint64x2_t lo, hi;
+} x4_v;
+
+static inline x4_v
+x4_pair(uint64x2_t lo, uint64x2_t hi)
+{
+  x4_v a;
+
+  a.lo = lo;
+  a.hi = hi;
+  return a;
+}
+
+static inline x4_v
+x4_load(const uint32_t *l)
+{
+  uint32x4_t t = vld1q_u32(l);
+
+  return x4_pair(vmovl_u32(vget_low_u32(t)), vmovl_high_u32(t));
+}
+
+static inline void
+x4_store(uint32_t *l, x4_v a)
+{
+  vst1q_u32(l, vcombine_u32(vmovn_u64(a.lo), vmovn_u64(a.hi)));
+}
+
+static inline x4_v
+x4_set(uint64_t c)
+{
+  return x4_pair(vdupq_n_u64(c), vdupq_n_u64(c));
+}
+
+static inline x4_v
+x4_add(x4_v a, x4_v b)
+{
+  return x4_pair(vaddq_u64(a.lo, b.lo), vaddq_u64(a.hi, b.hi));
+}
+
+static inline x4_v
+x4_sub(x4_v a, x4_v b)
+{
+  return x4_pair(vsubq_u64(a.lo, b.lo), vsubq_u64(a.hi, b.hi));
+}
+
+static inline x4_v
+x4_and(x4_v a, x4_v b)
+{
+  return x4_pair(vandq_u64(a.lo, b.lo), vandq_u64(a.hi, b.hi));
+}
+
+static inline x4_v
+x4_mul(x4_v a, x4_v b)
+{
+  return x4_pair(vmull_u32(vmovn_u64(a.lo), vmovn_u64(b.lo)),
+                 vmull_u32(vmovn_u64(a.hi), vmovn_u64(b.hi)));
+}
+
+#define x4_shl(a, n) x4_pair(vshlq_n_u64((a).lo, n), vshlq_n_u64((a).hi, n))
+#define x4_shr(a, n) x4_pair(vshrq_n_u64((a).lo, n), vshrq_n_u64((a).hi, n))
+
+#endif /* __aarch64__ */
+
+/*
+ * The constants in radix 2^26, standard form.
+ * p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+ * omega = 2^256 - p
+ * 32p spread so that every limb below the top one is at least 2^29, the
+ * largest limb of a lazy value: c - b limb by limb never goes below zero.
+ */
+static const uint32_t x4_p[NN_X4_LIMBS] = {
+  0x3ffffff, 0x3ffffff, 0x3ffffff, 0x003ffff, 0x0000000,
+  0x0000000, 0x0000000, 0x0000400, 0x3ff0000, 0x03fffff
+};
+
+static const uint32_t x4_omega[NN_X4_LIMBS] = {
+  0x0000001, 0x0000000, 0x0000000, 0x3fc0000, 0x3ffffff,
+  0x3ffffff, 0x3ffffff, 0x3fffbff, 0x000ffff, 0x0000000
+};
+
+static const uint32_t x4_p32[NN_X4_LIMBS] = {
+  0x27ffffe0, 0x27fffff6, 0x27fffff6, 0x247ffff6, 0x23fffff7,
+  0x23fffff7, 0x23fffff7, 0x24007ff7, 0x27dffff7, 0x07fffff6
+};
+
+/* R^2 mod p and R mod p, R = 2^260 */
+static const uint32_t x4_r2[NN_X4_LIMBS] = {
+  0x0000300, 0x0000000, 0x3f00000, 0x3ffffff, 0x3fffffb,
+  0x3ffffbf, 0x3ffffff, 0x3f7ffff, 0x0ffffff, 0x0000001
+};
+
+static const uint32_t x4_r1[NN_X4_LIMBS] = {
+  0x0000010, 0x0000000, 0x0000000, 0x3c00000, 0x3ffffff,
+  0x3ffffff, 0x3ffffff, 0x3ffbfff, 0x00fffff, 0x0000000
+};
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Propagates the carries of r[0..8] up to r[9]
+ */
+static inline X4_TARGET void
+x4_carry(x4_v *r)
+{
+  const x4_v mask = x4_set(X4_MASK);
+  uint8_t i;
+
+  for(i = 0; i < NN_X4_LIMBS - 1; i++) {
+    r[i + 1] = x4_add(r[i + 1], x4_shr(r[i], X4_BITS));
+    r[i] = x4_and(r[i], mask);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Brings r below 2^257, normalized
+ *                    Assumption: r[0..8] below 2^26, r below 2^262
+ *                    The bits q of r from 2^256 up are folded back as
+ *                    q * omega, q < 64 keeps every limb in its lane.
+ */
+static inline X4_TARGET void
+x4_fold(x4_v *r)
+{
+  x4_v q;
+  uint8_t i;
+
+  q = x4_shr(r[NN_X4_LIMBS - 1], X4_TOP_BITS);
+  r[NN_X4_LIMBS - 1] = x4_and(r[NN_X4_LIMBS - 1], x4_set((1u << X4_TOP_BITS) - 1));
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    if(x4_omega[i]) {
+      r[i] = x4_add(r[i], x4_mul(q, x4_set(x4_omega[i])));
+    }
+  }
+  x4_carry(r);
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             r = t / R mod p, normalized
+ *                    Assumption: t holds the columns of a product of two
+ *                    lazy values, t is destroyed
+ *                    Montgomery reduction one limb at a time: p = -1 mod
+ *                    2^26, so m = t[i] mod 2^26 makes t + m*p a multiple
+ *                    of 2^26(i+1). The limbs of p are 2^26-1 (three times),
+ *                    2^18-1, 0 (three times), 2^10, 2^26-2^16 and 2^22-1,
+ *                    every m*p[j] is a shift and a subtraction.
+ */
+static inline X4_TARGET void
+x4_redc(x4_v *r, x4_v *t)
+{
+  const x4_v mask = x4_set(X4_MASK);
+  x4_v m, m26;
+  uint8_t i;
+
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    m = x4_and(t[i], mask);
+    m26 = x4_sub(x4_shl(m, 26), m);
+    /* t[i] + m * (2^26 - 1) = (t[i] / 2^26 + m) * 2^26 */
+    t[i + 1] = x4_add(t[i + 1], x4_add(x4_add(x4_shr(t[i], X4_BITS), m), m26));
+    t[i + 2] = x4_add(t[i + 2], m26);
+    t[i + 3] = x4_add(t[i + 3], x4_sub(x4_shl(m, 18), m));
+    t[i + 7] = x4_add(t[i + 7], x4_shl(m, 10));
+    t[i + 8] = x4_add(t[i + 8], x4_sub(x4_shl(m, 26), x4_shl(m, 16)));
+    t[i + 9] = x4_add(t[i + 9], x4_sub(x4_shl(m, 22), m));
+  }
+
+  /* below 2^260 + p for operands below 2^260 */
+  for(i = 0; i < NN_X4_LIMBS - 1; i++) {
+    r[i] = t[NN_X4_LIMBS + i];
+  }
+  r[NN_X4_LIMBS - 1] = x4_set(0);
+  x4_carry(r);
+  x4_fold(r);
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             a = the four elements of l
+ *                    Lengths: l[NN_X4_LIMBS].
+ */
+static void
+x4_broadcast(nn_x4_t *a, const uint32_t *l)
+{
+  uint8_t i, j;
+
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    for(j = 0; j < 4; j++) {
+      a->l[i][j] = l[i];
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+#if defined(__x86_64__)
+static int
+cpu_has_avx2(void)
+{
+  unsigned int eax, ebx, ecx, edx, xcr0;
+
+  /* leaf 1: ECX bit 27 is OSXSAVE, bit 28 is AVX */
+  if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+     !(ecx & (1u << 27)) || !(ecx & (1u << 28))) {
+    return 0;
+  }
+  /* the OS saves the YMM registers */
+  __asm__ ("xgetbv" : "=a"(xcr0), "=d"(edx) : "c"(0));
+  if((xcr0 & 6) != 6) {
+    return 0;
+  }
+  /* leaf 7: EBX bit 5 is AVX2 */
+  if(!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+    return 0;
+  }
+  return (ebx & (1u << 5)) != 0;
+}
+#endif
+/*---------------------------------------------------------------------------*/
+/*
+ * Set on the first call. Concurrent first calls all store the same value.
+ */
+static int x4_available = -1;
+
+int
+NN_X4Available(void)
+{
+  if(x4_available < 0) {
+#if defined(__x86_64__)
+    x4_available = cpu_has_avx2();
+#else
+    x4_available = 1;
+#endif
+  }
+  return x4_available;
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_X4Set(nn_x4_t *a, uint8_t lane, NN_DIGIT *b)
+{
+  unsigned char buf[KEYDIGITS * NN_DIGIT_LEN];
+  uint64_t acc = 0;
+  uint8_t bits = 0, i = 0;
+  int16_t k;
+
+  NN_Encode(buf, sizeof(buf), b, KEYDIGITS);
+
+  /* buf is big endian */
+  for(k = sizeof(buf) - 1; k >= 0; k--) {
+    acc |= (uint64_t)buf[k] << bits;
+    bits += 8;
+    if(bits >= X4_BITS && i < NN_X4_LIMBS - 1) {
+      a->l[i++][lane] = (uint32_t)acc & X4_MASK;
+      acc >>= X4_BITS;
+      bits -= X4_BITS;
+    }
+  }
+  a->l[i][lane] = (uint32_t)acc;
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_X4Get(NN_DIGIT *a, const nn_x4_t *b, uint8_t lane)
+{
+  unsigned char buf[KEYDIGITS * NN_DIGIT_LEN];
+  uint32_t v[NN_X4_LIMBS], d[NN_X4_LIMBS], keep;
+  int64_t acc = 0;
+  uint64_t out = 0;
+  uint8_t i, bits = 0;
+  int16_t k;
+
+  /* below 2^257 < 2p, one subtraction of p */
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    v[i] = b->l[i][lane];
+    acc += (int64_t)v[i] - x4_p[i];
+    d[i] = (uint32_t)acc & X4_MASK;
+    acc >>= X4_BITS;
+  }
+  /* a borrow out means b < p */
+  keep = (uint32_t)0 - (uint32_t)(acc < 0);
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    v[i] = (v[i] & keep) | (d[i] & ~keep);
+  }
+
+  /* big endian bytes for NN_Decode */
+  k = sizeof(buf) - 1;
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    out |= (uint64_t)v[i] << bits;
+    bits += X4_BITS;
+    while(bits >= 8 && k >= 0) {
+      buf[k--] = (unsigned char)out;
+      out >>= 8;
+      bits -= 8;
+    }
+  }
+
+  NN_Decode(a, KEYDIGITS, buf, sizeof(buf));
+  NN_AssignZero(a + KEYDIGITS, NUMWORDS - KEYDIGITS);
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_X4ToMont(nn_x4_t *a, const nn_x4_t *b)
+{
+  nn_x4_t r2;
+
+  x4_broadcast(&r2, x4_r2);
+  NN_X4Mult(a, b, &r2);
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_X4FromMont(nn_x4_t *a, const nn_x4_t *b)
+{
+  static const uint32_t one[NN_X4_LIMBS] = { 1 };
+  nn_x4_t t;
+
+  x4_broadcast(&t, one);
+  NN_X4Mult(a, b, &t);
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_X4One(nn_x4_t *a)
+{
+  x4_broadcast(a, x4_r1);
+}
+/*---------------------------------------------------------------------------*/
+X4_TARGET void
+NN_X4Mult(nn_x4_t *a, const nn_x4_t *b, const nn_x4_t *c)
+{
+  x4_v x[NN_X4_LIMBS], y[NN_X4_LIMBS], t[X4_COLS], r[NN_X4_LIMBS];
+  uint8_t i, j;
+
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    x[i] = x4_load(b->l[i]);
+    y[i] = x4_load(c->l[i]);
+  }
+
+  /* a column is at most 10 products below 2^58 */
+  for(i = 0; i < X4_COLS; i++) {
+    t[i] = x4_set(0);
+  }
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    for(j = 0; j < NN_X4_LIMBS; j++) {
+      t[i + j] = x4_add(t[i + j], x4_mul(x[i], y[j]));
+    }
+  }
+
+  x4_redc(r, t);
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    x4_store(a->l[i], r[i]);
+  }
+}
+/*---------------------------------------------------------------------------*/
+X4_TARGET void
+NN_X4Sqr(nn_x4_t *a, const nn_x4_t *b)
+{
+  x4_v x[NN_X4_LIMBS], x2, t[X4_COLS], r[NN_X4_LIMBS];
+  uint8_t i, j;
+
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    x[i] = x4_load(b->l[i]);
+  }
+
+  /* cross products once, doubled through the 30-bit 2*x[i] */
+  for(i = 0; i < X4_COLS; i++) {
+    t[i] = x4_set(0);
+  }
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    t[2 * i] = x4_add(t[2 * i], x4_mul(x[i], x[i]));
+    x2 = x4_shl(x[i], 1);
+    for(j = i + 1; j < NN_X4_LIMBS; j++) {
+      t[i + j] = x4_add(t[i + j], x4_mul(x2, x[j]));
+    }
+  }
+
+  x4_redc(r, t);
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    x4_store(a->l[i], r[i]);
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_X4Add(nn_x4_t *a, const nn_x4_t *b, const nn_x4_t *c)
+{
+  uint8_t i, j;
+
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    for(j = 0; j < 4; j++) {
+      a->l[i][j] = b->l[i][j] + c->l[i][j];
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+X4_TARGET void
+NN_X4Sub(nn_x4_t *a, const nn_x4_t *b, const nn_x4_t *c)
+{
+  x4_v r[NN_X4_LIMBS];
+  uint8_t i;
+
+  /* b + 32p - c, below 2^262 */
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    r[i] = x4_sub(x4_add(x4_load(b->l[i]), x4_set(x4_p32[i])), x4_load(c->l[i]));
+  }
+
+  x4_carry(r);
+  x4_fold(r);
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    x4_store(a->l[i], r[i]);
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_X4MultSmall(nn_x4_t *a, const nn_x4_t *b, uint32_t k)
+{
+  uint8_t i, j;
+
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    for(j = 0; j < 4; j++) {
+      a->l[i][j] = b->l[i][j] * k;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+NN_X4Select(nn_x4_t *a, const nn_x4_t *b, const nn_x4_t *c, uint8_t lanes)
+{
+  uint32_t mask[4];
+  uint8_t i, j;
+
+  for(j = 0; j < 4; j++) {
+    mask[j] = (uint32_t)0 - ((lanes >> j) & 1);
+  }
+  for(i = 0; i < NN_X4_LIMBS; i++) {
+    for(j = 0; j < 4; j++) {
+      a->l[i][j] = (b->l[i][j] & mask[j]) | (c->l[i][j] & ~mask[j]);
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+
+#endif /* NN_X4_KERNELS */
+
+/** @} */
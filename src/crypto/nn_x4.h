@@ -0,0 +1,131 @@
+/**
+ * \defgroup nn_x4 4-way field arithmetic
+ * \ingroup nn
+ *
+ * @{
+ */
+
+/**
+ * \file
+ * P-256 field arithmetic on four independent elements at once, for hosts
+ * with AVX2 (x86-64) or NEON (ARM64).
+ * An element is held in Montgomery form, x * R mod p with R = 2^260, as 10
+ * limbs of 26 bits. Limb i of the four elements shares one vector of four
+ * 64-bit lanes: a 26x26-bit product fits a lane with room for the columns
+ * of a whole product, so its carries are resolved once, after the 100
+ * partial products, and the Montgomery reduction runs on shifts because
+ * p = -1 mod 2^26.
+ *
+ * Values are either normalized, as NN_X4Mult, NN_X4Sqr and NN_X4Sub leave
+ * them (limbs below 2^26, value below 2^257), or lazy: the sum of at most 8
+ * normalized values (NN_X4Add, NN_X4MultSmall). Every operand may be lazy.
+ *
+ * NN_X4_KERNELS is defined where the kernels are built, NN_X4Available()
+ * tells whether the running CPU has them: AVX2 is checked at run time,
+ * NEON is part of ARM64. Define NN_NO_X4_KERNELS in the build to leave
+ * them out.
+ */
+
+#ifndef __NN_X4_H__
+#define __NN_X4_H__
+
+#include "nn.h"
+
+#if defined(SECP256R1) && (defined(__x86_64__) || defined(__aarch64__)) && \
+    !defined(ARDUINO) && !defined(NN_NO_X4_KERNELS)
+#define NN_X4_KERNELS
+#endif
+
+#ifdef NN_X4_KERNELS
+
+/**
+ * Limbs of an element.
+ */
+#define NN_X4_LIMBS 10
+
+/**
+ * Four field elements, l[i][j] is limb i of element j.
+ */
+typedef struct nn_x4 {
+    uint32_t l[NN_X4_LIMBS][4];
+} nn_x4_t;
+
+/**
+ * \brief             Returns 1 if the running CPU has the 4-way kernels.
+ *                    The other NN_X4 functions must not be called otherwise.
+ */
+int NN_X4Available(void);
+
+/**
+ * \brief             Sets element lane of a to b, b < p.
+ *                    The element is in standard form, see NN_X4ToMont.
+ *                    Lengths: b[KEYDIGITS].
+ */
+void NN_X4Set(nn_x4_t *a, uint8_t lane, NN_DIGIT *b);
+
+/**
+ * \brief             Reads element lane of b, a = b mod p.
+ *                    b must be normalized and in standard form, see
+ *                    NN_X4FromMont.
+ *                    Lengths: a[NUMWORDS].
+ */
+void NN_X4Get(NN_DIGIT *a, const nn_x4_t *b, uint8_t lane);
+
+/**
+ * \brief             Computes a = b * R mod p, Montgomery form of b
+ */
+void NN_X4ToMont(nn_x4_t *a, const nn_x4_t *b);
+
+/**
+ * \brief             Computes a = b / R mod p, standard form of b
+ */
+void NN_X4FromMont(nn_x4_t *a, const nn_x4_t *b);
+
+/**
+ * \brief             Sets the four elements of a to 1 in Montgomery form
+ */
+void NN_X4One(nn_x4_t *a);
+
+/**
+ * \brief             Computes a = b * c / R mod p, normalized
+ *                    a, b, c can be same
+ */
+void NN_X4Mult(nn_x4_t *a, const nn_x4_t *b, const nn_x4_t *c);
+
+/**
+ * \brief             Computes a = b^2 / R mod p, normalized
+ *                    a, b can be same
+ */
+void NN_X4Sqr(nn_x4_t *a, const nn_x4_t *b);
+
+/**
+ * \brief             Computes a = b + c, lazy
+ *                    a, b, c can be same
+ */
+void NN_X4Add(nn_x4_t *a, const nn_x4_t *b, const nn_x4_t *c);
+
+/**
+ * \brief             Computes a = b - c mod p, normalized
+ *                    a, b, c can be same
+ */
+void NN_X4Sub(nn_x4_t *a, const nn_x4_t *b, const nn_x4_t *c);
+
+/**
+ * \brief             Computes a = k * b, lazy
+ *                    Assumption: b normalized, 2 <= k <= 8
+ *                    a, b can be same
+ */
+void NN_X4MultSmall(nn_x4_t *a, const nn_x4_t *b, uint32_t k);
+
+/**
+ * \brief             Element j of a = element j of b if bit j of lanes is
+ *                    set, otherwise element j of c
+ *                    a, b, c can be same
+ */
+void NN_X4Select(nn_x4_t *a, const nn_x4_t *b, const nn_x4_t *c, uint8_t lanes);
+
+#endif /* NN_X4_KERNELS */
+
+#endif /* __NN_X4_H__ */
+
+/** @} */
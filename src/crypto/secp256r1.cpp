@@ -112,38 +112,38 @@ void get_curve_param(curve_params_t *para)
 
   // b = 7
   memset(para->E.b, 0, NUMWORDS * NN_DIGIT_LEN);
-  para->G.x[31] = 0x5A;
-  para->G.x[30] = 0xC6;
-  para->G.x[29] = 0x35;
-  para->G.x[28] = 0xD8;
-  para->G.x[27] = 0xAA;
-  para->G.x[26] = 0x3A;
-  para->G.x[25] = 0x93;
-  para->G.x[24] = 0xE7;
-  para->G.x[23] = 0xB3;
-  para->G.x[22] = 0xEB;
-  para->G.x[21] = 0xBD;
-  para->G.x[20] = 0x55;
-  para->G.x[19] = 0x76;
-  para->G.x[18] = 0x98;
-  para->G.x[17] = 0x86;
-  para->G.x[16] = 0xBC;
-  para->G.x[15] = 0x65;
-  para->G.x[14] = 0x1D;
-  para->G.x[13] = 0x06;
-  para->G.x[12] = 0xB0;
-  para->G.x[11] = 0xCC;
-  para->G.x[10] = 0x53;
-  para->G.x[9] = 0xB0;
-  para->G.x[8] = 0xF6;
-  para->G.x[7] = 0x3B;
-  para->G.x[6] = 0xCE;
-  para->G.x[5] = 0x3C;
-  para->G.x[4] = 0x3E;
-  para->G.x[3] = 0x27;
-  para->G.x[2] = 0xD2;
-  para->G.x[1] = 0x60;
-  para->G.x[0] = 0x4B;
+  para->E.b[31] = 0x5A;
+  para->E.b[30] = 0xC6;
+  para->E.b[29] = 0x35;
+  para->E.b[28] = 0xD8;
+  para->E.b[27] = 0xAA;
+  para->E.b[26] = 0x3A;
+  para->E.b[25] = 0x93;
+  para->E.b[24] = 0xE7;
+  para->E.b[23] = 0xB3;
+  para->E.b[22] = 0xEB;
+  para->E.b[21] = 0xBD;
+  para->E.b[20] = 0x55;
+  para->E.b[19] = 0x76;
+  para->E.b[18] = 0x98;
+  para->E.b[17] = 0x86;
+  para->E.b[16] = 0xBC;
+  para->E.b[15] = 0x65;
+  para->E.b[14] = 0x1D;
+  para->E.b[13] = 0x06;
+  para->E.b[12] = 0xB0;
+  para->E.b[11] = 0xCC;
+  para->E.b[10] = 0x53;
+  para->E.b[9] = 0xB0;
+  para->E.b[8] = 0xF6;
+  para->E.b[7] = 0x3B;
+  para->E.b[6] = 0xCE;
+  para->E.b[5] = 0x3C;
+  para->E.b[4] = 0x3E;
+  para->E.b[3] = 0x27;
+  para->E.b[2] = 0xD2;
+  para->E.b[1] = 0x60;
+  para->E.b[0] = 0x4B;
 
   // base point
   memset(para->G.x, 0, NUMWORDS * NN_DIGIT_LEN);
@@ -308,22 +308,22 @@ void get_curve_param(curve_params_t *para)
 
   // b = 7
   memset(para->E.b, 0, NUMWORDS * NN_DIGIT_LEN);
-  para->G.x[15] = 0x5AC6;
-  para->G.x[14] = 0x35D8;
-  para->G.x[13] = 0xAA3A;
-  para->G.x[12] = 0x93E7;
-  para->G.x[11] = 0xB3EB;
-  para->G.x[10] = 0xBD55;
-  para->G.x[9] = 0x7698;
-  para->G.x[8] = 0x86BC;
-  para->G.x[7] = 0x651D;
-  para->G.x[6] = 0x06B0;
-  para->G.x[5] = 0xCC53;
-  para->G.x[4] = 0xB0F6;
-  para->G.x[3] = 0x3BCE;
-  para->G.x[2] = 0x3C3E;
-  para->G.x[1] = 0x27D2;
-  para->G.x[0] = 0x604B;
+  para->E.b[15] = 0x5AC6;
+  para->E.b[14] = 0x35D8;
+  para->E.b[13] = 0xAA3A;
+  para->E.b[12] = 0x93E7;
+  para->E.b[11] = 0xB3EB;
+  para->E.b[10] = 0xBD55;
+  para->E.b[9] = 0x7698;
+  para->E.b[8] = 0x86BC;
+  para->E.b[7] = 0x651D;
+  para->E.b[6] = 0x06B0;
+  para->E.b[5] = 0xCC53;
+  para->E.b[4] = 0xB0F6;
+  para->E.b[3] = 0x3BCE;
+  para->E.b[2] = 0x3C3E;
+  para->E.b[1] = 0x27D2;
+  para->E.b[0] = 0x604B;
 
   // base point
   memset(para->G.x, 0, NUMWORDS * NN_DIGIT_LEN);
@@ -420,14 +420,14 @@ void get_curve_param(curve_params_t *para)
 
   // b = 7
   memset(para->E.b, 0, NUMWORDS * NN_DIGIT_LEN);
-  para->G.x[7] = 0x5AC635D8;
-  para->G.x[6] = 0xAA3A93E7;
-  para->G.x[5] = 0xB3EBBD55;
-  para->G.x[4] = 0x769886BC;
-  para->G.x[3] = 0x651D06B0;
-  para->G.x[2] = 0xCC53B0F6;
-  para->G.x[1] = 0x3BCE3C3E;
-  para->G.x[0] = 0x27D2604B;
+  para->E.b[7] = 0x5AC635D8;
+  para->E.b[6] = 0xAA3A93E7;
+  para->E.b[5] = 0xB3EBBD55;
+  para->E.b[4] = 0x769886BC;
+  para->E.b[3] = 0x651D06B0;
+  para->E.b[2] = 0xCC53B0F6;
+  para->E.b[1] = 0x3BCE3C3E;
+  para->E.b[0] = 0x27D2604B;
 
   // base point
   memset(para->G.x, 0, NUMWORDS * NN_DIGIT_LEN);
@@ -461,7 +461,59 @@ void get_curve_param(curve_params_t *para)
   para->r[1] = 0xF3B9CAC2;
   para->r[0] = 0xFC632551;
 
-#endif /* THIRTYTWO_BIT_PROCESSOR */
+  /* THIRTYTWO_BIT_PROCESSOR */
+#elif defined(SIXTY_FOUR_BIT_PROCESSOR)
+  // init parameters
+
+  memset(para->p, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->p[3] = 0xFFFFFFFF00000001;
+  para->p[2] = 0x0000000000000000;
+  para->p[1] = 0x00000000FFFFFFFF;
+  para->p[0] = 0xFFFFFFFFFFFFFFFF;
+
+  memset(para->omega, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->omega[3] = 0x00000000FFFFFFFE;
+  para->omega[2] = 0xFFFFFFFFFFFFFFFF;
+  para->omega[1] = 0xFFFFFFFF00000000;
+  para->omega[0] = 0x0000000000000001;
+  // curve that will be used
+  // a = -3
+  memset(para->E.a, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->E.a[3] = 0xFFFFFFFF00000001;
+  para->E.a[2] = 0x0000000000000000;
+  para->E.a[1] = 0x00000000FFFFFFFF;
+  para->E.a[0] = 0xFFFFFFFFFFFFFFFC;
+
+  para->E.a_minus3 = TRUE;
+  para->E.a_zero = FALSE;
+
+  memset(para->E.b, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->E.b[3] = 0x5AC635D8AA3A93E7;
+  para->E.b[2] = 0xB3EBBD55769886BC;
+  para->E.b[1] = 0x651D06B0CC53B0F6;
+  para->E.b[0] = 0x3BCE3C3E27D2604B;
+
+  // base point
+  memset(para->G.x, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->G.x[3] = 0x6B17D1F2E12C4247;
+  para->G.x[2] = 0xF8BCE6E563A440F2;
+  para->G.x[1] = 0x77037D812DEB33A0;
+  para->G.x[0] = 0xF4A13945D898C296;
+
+  memset(para->G.y, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->G.y[3] = 0x4FE342E2FE1A7F9B;
+  para->G.y[2] = 0x8EE7EB4A7C0F9E16;
+  para->G.y[1] = 0x2BCE33576B315ECE;
+  para->G.y[0] = 0xCBB6406837BF51F5;
+
+  // prime divide the number of points
+  memset(para->r, 0, NUMWORDS * NN_DIGIT_LEN);
+  para->r[3] = 0xFFFFFFFF00000000;
+  para->r[2] = 0xFFFFFFFFFFFFFFFF;
+  para->r[1] = 0xBCE6FAADA7179E84;
+  para->r[0] = 0xF3B9CAC2FC632551;
+
+#endif /* SIXTY_FOUR_BIT_PROCESSOR */
 }
 
 NN_UINT omega_mul(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *omega, NN_UINT digits)
@@ -472,6 +524,8 @@ NN_UINT omega_mul(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *omega, NN_UINT digits)
   int omega_digit_length = 14;
 #elif defined(THIRTYTWO_BIT_PROCESSOR)
   int omega_digit_length = 7;
+#elif defined(SIXTY_FOUR_BIT_PROCESSOR)
+  int omega_digit_length = 4;
 #endif
 
   NN_Mult(a, b, omega,
@@ -0,0 +1,1056 @@
+// Generated by tools/gen_comb_table.py --teeth 6 --blocks 4, do not edit.
+/**
+ * \file
+ * Fixed-base comb table for the P-256 generator, 4 blocks of 63
+ * affine points (16128 bytes). Included by ecc.cpp only.
+ */
+
+#ifndef __SECP256R1_COMB_H__
+#define __SECP256R1_COMB_H__
+
+#define ECC_COMB_TABLE_TEETH 6
+#define ECC_COMB_TABLE_BLOCKS 4
+
+/* keep the table in flash where const data is not mapped there */
+#if defined(ESP8266)
+#include <pgmspace.h>
+#define COMB_ROM PROGMEM
+#else
+#define COMB_ROM
+#endif
+
+/* one 64-bit word of a coordinate, split into NN_DIGITs */
+#if defined(SIXTY_FOUR_BIT_PROCESSOR)
+#define COMB_W(hi, lo) (((NN_DIGIT)(hi) << 32) | (lo))
+#elif defined(THIRTYTWO_BIT_PROCESSOR)
+#define COMB_W(hi, lo) (lo), (hi)
+#elif defined(SIXTEEN_BIT_PROCESSOR)
+#define COMB_W(hi, lo) ((lo) & 0xffff), ((lo) >> 16), ((hi) & 0xffff), ((hi) >> 16)
+#else
+#define COMB_W(hi, lo) ((lo) & 0xff), (((lo) >> 8) & 0xff), (((lo) >> 16) & 0xff), ((lo) >> 24), \
+  ((hi) & 0xff), (((hi) >> 8) & 0xff), (((hi) >> 16) & 0xff), ((hi) >> 24)
+#endif
+
+static const NN_DIGIT ecc_comb_table[ECC_COMB_TABLE_BLOCKS][(1 << ECC_COMB_TABLE_TEETH) - 1][2][KEYDIGITS] COMB_ROM = {
+  { /* block 0 */
+    { /* 1 */
+      { COMB_W(0xf4a13945, 0xd898c296), COMB_W(0x77037d81, 0x2deb33a0), COMB_W(0xf8bce6e5, 0x63a440f2), COMB_W(0x6b17d1f2, 0xe12c4247) },
+      { COMB_W(0xcbb64068, 0x37bf51f5), COMB_W(0x2bce3357, 0x6b315ece), COMB_W(0x8ee7eb4a, 0x7c0f9e16), COMB_W(0x4fe342e2, 0xfe1a7f9b) }
+    },
+    { /* 2 */
+      { COMB_W(0xe1404a86, 0x1abe45c0), COMB_W(0x281b195f, 0xf46f925a), COMB_W(0x886a8f47, 0x49b86176), COMB_W(0xb01a67f7, 0x16475f72) },
+      { COMB_W(0xc72f0dbe, 0x0090106c), COMB_W(0x72fc6763, 0x41b62c7f), COMB_W(0xacd56b13, 0x164ef994), COMB_W(0x7c521bbf, 0x5a3956e2) }
+    },
+    { /* 3 */
+      { COMB_W(0x62ffd5a4, 0x9b38e285), COMB_W(0x6f487392, 0xcfec5fa2), COMB_W(0x20027ab0, 0xf4f94d0c), COMB_W(0xdc441aed, 0xdc2e41e5) },
+      { COMB_W(0x026af984, 0x06f2a769), COMB_W(0xdcd1010a, 0x758aef27), COMB_W(0xfeb4e359, 0x8fef0435), COMB_W(0x34247a73, 0xc0ed45e4) }
+    },
+    { /* 4 */
+      { COMB_W(0x0fd8013b, 0x26d69d8e), COMB_W(0x2ec38faf, 0x35f45d26), COMB_W(0xc73d9890, 0x17e14dd2), COMB_W(0x353d458d, 0x3491b5a8) },
+      { COMB_W(0x842b9d00, 0x20f32b82), COMB_W(0x825dfc12, 0xfb71a9a8), COMB_W(0x3130fde4, 0x0c040a8a), COMB_W(0x9c7d37bf, 0x4f5bde24) }
+    },
+    { /* 5 */
+      { COMB_W(0x442e3cc7, 0xf28c6735), COMB_W(0x494a89d3, 0x09e2a954), COMB_W(0x2ed6fd47, 0x32670fa7), COMB_W(0x3f740b11, 0xad653f1f) },
+      { COMB_W(0x49404ed2, 0x3c2ab0bd), COMB_W(0x52c9bfb4, 0x02a334fb), COMB_W(0x7a430203, 0xa6ad6ab4), COMB_W(0x2e3e3503, 0x9fa1b932) }
+    },
+    { /* 6 */
+      { COMB_W(0xe2ef6e60, 0xc14dcd04), COMB_W(0x66aaca7c, 0x1d8130d9), COMB_W(0xc2db3b7b, 0xaa8330b2), COMB_W(0x79804f22, 0xb4c477ff) },
+      { COMB_W(0xe103475b, 0xb60348e8), COMB_W(0xea3bd7ee, 0xcfdc7a34), COMB_W(0xf34dc92e, 0x840ab738), COMB_W(0x7891bfa2, 0x1b8306e9) }
+    },
+    { /* 7 */
+      { COMB_W(0x6e4e2635, 0xb04d0c5c), COMB_W(0xcc0c4490, 0x9e7651f5), COMB_W(0x34f7c1f6, 0xd20d12f2), COMB_W(0x0e6f1823, 0xd47e7788) },
+      { COMB_W(0x2eb67d18, 0x79826488), COMB_W(0xe8b6bc44, 0x0f483ebe), COMB_W(0x2b584d24, 0xb8215764), COMB_W(0x72602a32, 0x7b445f75) }
+    },
+    { /* 8 */
+      { COMB_W(0x336dd1e7, 0xc68278c2), COMB_W(0xa1dd10b8, 0xa60e47c0), COMB_W(0x6554caa3, 0x43adfa5a), COMB_W(0x61779471, 0x47864343) },
+      { COMB_W(0x9d03ecb2, 0xefabd2cf), COMB_W(0x32796999, 0x2317a1a6), COMB_W(0x03bff005, 0xc8986473), COMB_W(0x4ecee7d5, 0xa568791f) }
+    },
+    { /* 9 */
+      { COMB_W(0x82269113, 0xadc74579), COMB_W(0x2f7e5d26, 0xc67462a5), COMB_W(0x42f406b6, 0x656d7733), COMB_W(0xfb16db4f, 0x88870422) },
+      { COMB_W(0x52782bd4, 0x406d394b), COMB_W(0x4d09cdc6, 0x2fb84dfd), COMB_W(0x0831b6c2, 0xcbf15bb3), COMB_W(0x86c428da, 0x368600fa) }
+    },
+    { /* 10 */
+      { COMB_W(0x4293611d, 0xf53062fd), COMB_W(0x4e6b7ee3, 0xb4d90194), COMB_W(0xb32409de, 0xc9b456d8), COMB_W(0xa39c87e0, 0xcd6418a4) },
+      { COMB_W(0xaecb58ee, 0xd0b939dd), COMB_W(0xc452d174, 0x27f5e0b6), COMB_W(0x5176ec66, 0xe440d151), COMB_W(0x6b192459, 0xc7963c49) }
+    },
+    { /* 11 */
+      { COMB_W(0x4c2f660e, 0x7dad6129), COMB_W(0x7656304f, 0x9c49476f), COMB_W(0x350a8c52, 0xe0f99d51), COMB_W(0xe9660e5e, 0x17be209d) },
+      { COMB_W(0xf4259362, 0x5c6d8ab6), COMB_W(0xd5c7deb8, 0xff413e8a), COMB_W(0xe0e4e585, 0x315c21c1), COMB_W(0xcc9386b8, 0x408a61b5) }
+    },
+    { /* 12 */
+      { COMB_W(0x496ef0ac, 0x3060597b), COMB_W(0xe5da7714, 0x844d5449), COMB_W(0xb9729824, 0x034d4e77), COMB_W(0x624c4947, 0x47df541f) },
+      { COMB_W(0x09894321, 0xe9ada28f), COMB_W(0xc1248c01, 0x7ceb4b0a), COMB_W(0xc8329011, 0xb7ff1618), COMB_W(0x7e49667c, 0xde17aabb) }
+    },
+    { /* 13 */
+      { COMB_W(0x2582bc75, 0xec6e546f), COMB_W(0xf3883771, 0x439eb7f5), COMB_W(0xa3eba4e5, 0x02e3243f), COMB_W(0x62917fde, 0xc66f1bad) },
+      { COMB_W(0x124b4018, 0x42093e26), COMB_W(0xd991228f, 0x1f300dac), COMB_W(0x5e0a1444, 0x64eafc85), COMB_W(0x7275bca1, 0x7b44d762) }
+    },
+    { /* 14 */
+      { COMB_W(0x9f626444, 0x45fe49d9), COMB_W(0xbc2aae87, 0xf4b1aa45), COMB_W(0x43e0562a, 0x225af5a5), COMB_W(0xaa959a34, 0x9f426324) },
+      { COMB_W(0x8b45f311, 0xdca4445b), COMB_W(0xfaef19a7, 0x110d9c08), COMB_W(0x79ca78df, 0xdf822b2f), COMB_W(0x6e77578b, 0x81697fef) }
+    },
+    { /* 15 */
+      { COMB_W(0x224f9894, 0x844cd8a4), COMB_W(0x408b1365, 0x771d9c5f), COMB_W(0x22f87ff0, 0x0fb14b0e), COMB_W(0x581c59f9, 0xfa0ca738) },
+      { COMB_W(0x5496456e, 0x903dea4a), COMB_W(0xb5042cd6, 0xdf7e280a), COMB_W(0xb00ef71a, 0x3a0b6967), COMB_W(0x87b90ea4, 0x5919d796) }
+    },
+    { /* 16 */
+      { COMB_W(0xc6e3197a, 0xa3fe67b2), COMB_W(0x34a8bfe7, 0x0a2e3338), COMB_W(0xbc666b9b, 0xa97323b2), COMB_W(0x6608c243, 0x773c85dc) },
+      { COMB_W(0x1923fe5c, 0xe5b47a28), COMB_W(0xc22b159f, 0x40c54308), COMB_W(0x846f640d, 0xa746e03f), COMB_W(0xa1a916be, 0xc521c168) }
+    },
+    { /* 17 */
+      { COMB_W(0xcd6ec555, 0x19150453), COMB_W(0x810ffbe4, 0x6ce9984b), COMB_W(0xb54efcfb, 0x6e63df58), COMB_W(0xa0b0c902, 0xed460eac) },
+      { COMB_W(0xabe860b8, 0x52ae78c4), COMB_W(0xd921223f, 0xe37072ab), COMB_W(0x81449bb3, 0x75451932), COMB_W(0x3c91362e, 0xd330da81) }
+    },
+    { /* 18 */
+      { COMB_W(0x81db76da, 0xbad0ad1e), COMB_W(0xe8a6ac07, 0xf513d73e), COMB_W(0xbeee0a60, 0x370d5693), COMB_W(0xb3c11c0c, 0x75a533a6) },
+      { COMB_W(0x53dc2660, 0xe1952e88), COMB_W(0x24dbac1e, 0x34996e1a), COMB_W(0x30e8473a, 0x59ea028c), COMB_W(0x3a8ed58c, 0x6cc1d46e) }
+    },
+    { /* 19 */
+      { COMB_W(0x3900c527, 0xd5bc4331), COMB_W(0xeee08ae5, 0x8332e85a), COMB_W(0x4351d3a0, 0x185b5cbe), COMB_W(0x93d4cf56, 0x3eb0c02c) },
+      { COMB_W(0x9898e2b6, 0xee261983), COMB_W(0xe1a3789d, 0x65ddeac4), COMB_W(0x08ea0af5, 0x58099688), COMB_W(0x9a42477e, 0x0cc3872f) }
+    },
+    { /* 20 */
+      { COMB_W(0x557365e8, 0x009ee199), COMB_W(0x30874471, 0xc34e0ec9), COMB_W(0xdf257b06, 0x5b516a00), COMB_W(0x1bdf08d0, 0x63d3144f) },
+      { COMB_W(0xb23973b7, 0x235f8b06), COMB_W(0x073bfdc5, 0x7ef7606a), COMB_W(0x8e46ef3b, 0xd47cfd29), COMB_W(0x0b1d5740, 0x3bd35db5) }
+    },
+    { /* 21 */
+      { COMB_W(0x6179070c, 0x034a3d13), COMB_W(0xc8c45654, 0x3fa116c1), COMB_W(0xee3e1833, 0x24dfddf9), COMB_W(0x2718af11, 0xd611171a) },
+      { COMB_W(0xc34c64c3, 0x950668b7), COMB_W(0xe4001296, 0x813c0727), COMB_W(0xd8ff482a, 0xa251d4b9), COMB_W(0x03590969, 0x2b9929c6) }
+    },
+    { /* 22 */
+      { COMB_W(0x8cc79406, 0x4a87d050), COMB_W(0x32dff574, 0x14fdee4e), COMB_W(0x06004d6d, 0xe7cc1181), COMB_W(0x4d397575, 0xbf79f98e) },
+      { COMB_W(0xb496b00a, 0x4628c8e1), COMB_W(0x59bb90c9, 0xee86be1e), COMB_W(0x7a354013, 0xfdbfd3ca), COMB_W(0xa3cf71fb, 0xf1ae6397) }
+    },
+    { /* 23 */
+      { COMB_W(0x1f44ed30, 0xd5c55d2e), COMB_W(0x5bd78d0d, 0x26abaaa9), COMB_W(0x8f676ff6, 0xe72e1fd5), COMB_W(0x68f25c6c, 0xf2711eca) },
+      { COMB_W(0xc15d3a85, 0x8bfca74b), COMB_W(0xc2f72827, 0x2137c0f7), COMB_W(0xad91e961, 0xbf51a0a8), COMB_W(0x8e2feff9, 0xaaebd0fa) }
+    },
+    { /* 24 */
+      { COMB_W(0x1ae8c29e, 0x7593f9f4), COMB_W(0x7bbb72cb, 0x7ca2b3c5), COMB_W(0xf11a2b42, 0x9d6363c7), COMB_W(0x8adaf399, 0x4e61d714) },
+      { COMB_W(0x5554992e, 0xeb8950ed), COMB_W(0x3cb40096, 0x170bdf31), COMB_W(0xcada98a4, 0x5ae0d5cb), COMB_W(0xa2372d7d, 0x2a5a4fa9) }
+    },
+    { /* 25 */
+      { COMB_W(0x93b70102, 0x5cc911a1), COMB_W(0xab8421d0, 0xe4d06ebb), COMB_W(0x2204e2a0, 0x3f662604), COMB_W(0x25cc2f11, 0x91688fdb) },
+      { COMB_W(0xd911d93f, 0x89d7e1a9), COMB_W(0xebef76a2, 0x02884e36), COMB_W(0xb0d5c05d, 0xdc269012), COMB_W(0x1cd74589, 0x0d8207e4) }
+    },
+    { /* 26 */
+      { COMB_W(0xf59d5794, 0xca946804), COMB_W(0x96d93c01, 0x271e31a9), COMB_W(0x1740f611, 0x4d93889d), COMB_W(0xf66d3a66, 0x29347fd6) },
+      { COMB_W(0xc89dda91, 0xc69e38e5), COMB_W(0xfe9c49cf, 0x61d7e90e), COMB_W(0xf699c2fe, 0x070bc132), COMB_W(0xadc35ad2, 0x9015f49c) }
+    },
+    { /* 27 */
+      { COMB_W(0x2477b2e7, 0x3fd2862a), COMB_W(0xef421c97, 0x993207d7), COMB_W(0x8f3d3cf0, 0x6ba85ce2), COMB_W(0xd5d9d638, 0x3eaac1e7) },
+      { COMB_W(0x7e17b079, 0xf4278803), COMB_W(0xf614edd9, 0xa070559c), COMB_W(0x70c76a55, 0xb3c4cd30), COMB_W(0xc6a9d7cc, 0x8b6068b4) }
+    },
+    { /* 28 */
+      { COMB_W(0xb978f4dc, 0x5576fdf8), COMB_W(0x7a679aed, 0x8bbbfe5f), COMB_W(0x40cdbdc4, 0x62ef9de1), COMB_W(0x57acf5ed, 0x36d06361) },
+      { COMB_W(0xcbca8bb2, 0xca5bc79f), COMB_W(0xd2b4f49e, 0x748fdbdf), COMB_W(0xeb699bbd, 0x2fc2945f), COMB_W(0x1cf9425d, 0xdba3636c) }
+    },
+    { /* 29 */
+      { COMB_W(0x409249e7, 0x75c0a207), COMB_W(0xe8ebcd10, 0x9bdd3881), COMB_W(0x262da752, 0x7521ff8e), COMB_W(0x0023b2f1, 0x1685f2a1) },
+      { COMB_W(0x2dbfc2bd, 0x9ed6aa5a), COMB_W(0x90ef587d, 0x886d15a5), COMB_W(0x4c4e5244, 0xf047d24d), COMB_W(0x99dfdc44, 0x4e3021b0) }
+    },
+    { /* 30 */
+      { COMB_W(0x802f1fc7, 0x806f5f98), COMB_W(0x1f70edf2, 0x1668b474), COMB_W(0x7d43f856, 0x55e5bf9a), COMB_W(0x2dfddf5b, 0x317b1b24) },
+      { COMB_W(0xd0c3422e, 0x8f7cda46), COMB_W(0xd9e6903f, 0x1b696691), COMB_W(0xd20605c8, 0x9fa7707b), COMB_W(0x39e5190c, 0x868963b2) }
+    },
+    { /* 31 */
+      { COMB_W(0x94308bc8, 0x88af9943), COMB_W(0x71d72279, 0xe439e1cd), COMB_W(0x9f26b651, 0x235da74e), COMB_W(0xba6248a1, 0x4c05b219) },
+      { COMB_W(0x3f4140df, 0xc48e9208), COMB_W(0xd9604d5d, 0x87bb3bf1), COMB_W(0xdd9b7cbd, 0x39a956e7), COMB_W(0x02e9f520, 0x6a6347c2) }
+    },
+    { /* 32 */
+      { COMB_W(0x7748532d, 0x4fa43529), COMB_W(0xd505671a, 0xe1abb34a), COMB_W(0x66dceb63, 0x1977d5ba), COMB_W(0xc56dd686, 0xb0fd846a) },
+      { COMB_W(0x59ededac, 0xf9a521f6), COMB_W(0x619e4678, 0x16fb7eee), COMB_W(0x555d2c60, 0xa76b8c11), COMB_W(0xf2acaa85, 0xf3f1b263) }
+    },
+    { /* 33 */
+      { COMB_W(0x22e852e4, 0x018425c8), COMB_W(0xcba66e3d, 0x14b04d0c), COMB_W(0xd97c4650, 0xd1c9ce97), COMB_W(0xd9ca8363, 0x7e690abe) },
+      { COMB_W(0x242ced3e, 0x3195d9a2), COMB_W(0x97165f79, 0xd8b02b63), COMB_W(0xf7b77fe2, 0x41c43826), COMB_W(0x2779ec97, 0x5b9c3f59) }
+    },
+    { /* 34 */
+      { COMB_W(0x911e813f, 0x520cc3be), COMB_W(0xf2967336, 0xf9eceb86), COMB_W(0xf8ddad74, 0x14552118), COMB_W(0x6ce44f35, 0x0f737b08) },
+      { COMB_W(0xf396095b, 0x59c50abd), COMB_W(0xe103eff0, 0x0158f99e), COMB_W(0x3d9cd9e8, 0xb2ddaa85), COMB_W(0x6cad2472, 0x7dcef0fd) }
+    },
+    { /* 35 */
+      { COMB_W(0x623481dd, 0xbc8bc76b), COMB_W(0x9310b554, 0x3f4d4db7), COMB_W(0x23d6abe5, 0x3d5173f6), COMB_W(0xaa570190, 0x3686cebe) },
+      { COMB_W(0x7f7d2743, 0x71175719), COMB_W(0x96e3cdf6, 0xf7df4f4a), COMB_W(0xac0d8ba4, 0x657f70df), COMB_W(0xb5f1800a, 0xd65cdfe0) }
+    },
+    { /* 36 */
+      { COMB_W(0x04476c37, 0x0b48ec6c), COMB_W(0x68e87e1b, 0xba28810b), COMB_W(0x5cd43bbc, 0x4cc9964a), COMB_W(0x7ab86684, 0x94e93de0) },
+      { COMB_W(0x6696d6ef, 0x152a53ea), COMB_W(0x6b32a913, 0xfb939932), COMB_W(0x1f7dc0f9, 0x5c056d52), COMB_W(0x89523f28, 0x1dd268e1) }
+    },
+    { /* 37 */
+      { COMB_W(0x4ccb8c73, 0x988ba1a8), COMB_W(0xc1575195, 0x4138f406), COMB_W(0x943d75a5, 0x2a9e0493), COMB_W(0x5a970637, 0xf221b444) },
+      { COMB_W(0xbf6d645c, 0x9a61b88b), COMB_W(0xb6a407e7, 0x57320d6d), COMB_W(0xdf702435, 0xbddace4d), COMB_W(0xfe5bac0a, 0x4f6ace0e) }
+    },
+    { /* 38 */
+      { COMB_W(0x4553be75, 0xb67bd713), COMB_W(0xa145e032, 0x50adc2a4), COMB_W(0x36fd9c09, 0x8ac16ed4), COMB_W(0x856f8d92, 0x8de52b64) },
+      { COMB_W(0xe7cc6e7d, 0xac8373d5), COMB_W(0x520f1a12, 0xfb88669d), COMB_W(0x08e29e7a, 0x47b9b879), COMB_W(0xc7408178, 0xbeda21ef) }
+    },
+    { /* 39 */
+      { COMB_W(0x86874f8f, 0x634f4d83), COMB_W(0x94337592, 0xf17b4f6c), COMB_W(0xdb099755, 0xceed8b77), COMB_W(0xe4eb9704, 0x4ccf5a13) },
+      { COMB_W(0x2d049261, 0xe06dcdb3), COMB_W(0xcfff0ada, 0x89bd73ee), COMB_W(0x96ea331a, 0xf8c317b8), COMB_W(0x01b60ceb, 0x5cd906a9) }
+    },
+    { /* 40 */
+      { COMB_W(0xe07fc4f8, 0x59888797), COMB_W(0x4ddfbc67, 0x94cbd037), COMB_W(0x6e542c71, 0xffc51e98), COMB_W(0x76587967, 0x6d0022d9) },
+      { COMB_W(0x607cc945, 0x589a4fec), COMB_W(0x694afd04, 0x7b278ed5), COMB_W(0xe603f4cb, 0x4dab84c1), COMB_W(0x13828bc5, 0x1c10af39) }
+    },
+    { /* 41 */
+      { COMB_W(0x889f983c, 0x8a6b247d), COMB_W(0xddff5865, 0x10b35de7), COMB_W(0x337d01dd, 0xddcf9bf6), COMB_W(0xaa6875f0, 0x16989d40) },
+      { COMB_W(0xa8210072, 0xd029a4ed), COMB_W(0xbca9a5a2, 0x58ba9b7c), COMB_W(0x9f6c5ce5, 0x631ade12), COMB_W(0x846172c1, 0xabd4f87d) }
+    },
+    { /* 42 */
+      { COMB_W(0x615d4803, 0xd27ae0d2), COMB_W(0x5ee8ffd0, 0x3af66f52), COMB_W(0xa10aada6, 0x73070084), COMB_W(0xf52118f0, 0x18d7e165) },
+      { COMB_W(0x47a28348, 0x4595cead), COMB_W(0x0ec0c756, 0xef91b903), COMB_W(0x50078bdb, 0x8ba399a1), COMB_W(0x7dad79b5, 0xf4bcfc6f) }
+    },
+    { /* 43 */
+      { COMB_W(0xdd8b6d0c, 0x1d0aa4b2), COMB_W(0x5bea73de, 0xe356bc6d), COMB_W(0x9267f864, 0x49d8751b), COMB_W(0x1e8f4bae, 0xdd74dcfc) },
+      { COMB_W(0xcb4b64d5, 0xa1804dac), COMB_W(0x92471485, 0xe2df0a34), COMB_W(0xde5d9c53, 0xc1689593), COMB_W(0x6a447ad8, 0x66407ad7) }
+    },
+    { /* 44 */
+      { COMB_W(0xffc700c5, 0xa4c29ffb), COMB_W(0x6d86ddee, 0x21c4af62), COMB_W(0x5437a8e1, 0xfd2185d9), COMB_W(0xc91cfa4e, 0xb919e1e0) },
+      { COMB_W(0xda9da887, 0xa619eadc), COMB_W(0x33fcdde1, 0x215c4663), COMB_W(0xeb9fc235, 0x1aa52531), COMB_W(0x2abf5a30, 0xe0b2ce73) }
+    },
+    { /* 45 */
+      { COMB_W(0xe787df98, 0x407ef6fd), COMB_W(0x1fec7d62, 0xc28fb9af), COMB_W(0x4411f0f1, 0x08b63123), COMB_W(0xca1ff32d, 0x2789f997) },
+      { COMB_W(0x0bd583a9, 0xc625b496), COMB_W(0xdbda622f, 0xae8637b3), COMB_W(0x9548806e, 0xbb474918), COMB_W(0x09d2920b, 0x63439efe) }
+    },
+    { /* 46 */
+      { COMB_W(0x2f4c9220, 0x73d3bde2), COMB_W(0x90b8248e, 0xb5f68734), COMB_W(0x7087f402, 0xe772c754), COMB_W(0x180e13df, 0xfcbcce7c) },
+      { COMB_W(0x0dc31e52, 0xb2cfdbd9), COMB_W(0xff36e14e, 0xc4be20b6), COMB_W(0xb4d72277, 0x8e4bfef5), COMB_W(0x9904dc8a, 0xeccf2fcf) }
+    },
+    { /* 47 */
+      { COMB_W(0x41765b28, 0x03275692), COMB_W(0x8e87f34a, 0x5a486dc4), COMB_W(0x87fc959f, 0x895d4384), COMB_W(0x8fd31aac, 0x15231e09) },
+      { COMB_W(0x1e19c40c, 0xd159a96b), COMB_W(0x3b2782b5, 0x57e776cb), COMB_W(0xf1e2d473, 0x2a9b2fea), COMB_W(0xe13dc069, 0xd0c07b79) }
+    },
+    { /* 48 */
+      { COMB_W(0x39ccee55, 0xfa6f051e), COMB_W(0xbb4ff7b0, 0xacb3fb8b), COMB_W(0xf59d3d92, 0xc333ba2c), COMB_W(0xcf792ede, 0x02bd0339) },
+      { COMB_W(0x4307b4f1, 0x7e41731b), COMB_W(0x40a75f74, 0x99313f20), COMB_W(0x395c554f, 0x0d3e940d), COMB_W(0x0da18e76, 0xbffd31bb) }
+    },
+    { /* 49 */
+      { COMB_W(0xeacb16ae, 0xbd047ee4), COMB_W(0x123b18ec, 0x14c49cdd), COMB_W(0x30ac1302, 0x91e2addd), COMB_W(0xbe3d0eec, 0x02df1b12) },
+      { COMB_W(0xf6428ece, 0x59fdee48), COMB_W(0x044ff136, 0xb24a9a05), COMB_W(0xa05ee3b9, 0x9671e9ca), COMB_W(0x52415e4d, 0x5504f834) }
+    },
+    { /* 50 */
+      { COMB_W(0xc6be7a65, 0xbfddc1b0), COMB_W(0x69334234, 0x5fa2258d), COMB_W(0x92390a9c, 0xaf22e700), COMB_W(0xc63444f7, 0x5cba90ce) },
+      { COMB_W(0x1b4c3baa, 0xc8d187f6), COMB_W(0x9422242e, 0x00760c7f), COMB_W(0xe14cd23d, 0xd0b48ea6), COMB_W(0xcca21c37, 0x6ed11cf9) }
+    },
+    { /* 51 */
+      { COMB_W(0xef48ce89, 0x2caa268d), COMB_W(0x122cca90, 0x93d063f7), COMB_W(0x837f3274, 0x91132f41), COMB_W(0x3468932d, 0xe25d4cfc) },
+      { COMB_W(0x383a3b51, 0x7f3e8ee5), COMB_W(0x7c689678, 0x034416d9), COMB_W(0xdb409942, 0xafe91406), COMB_W(0x3baff66e, 0x89826a6c) }
+    },
+    { /* 52 */
+      { COMB_W(0x46b75abf, 0x8aa9a8bb), COMB_W(0x9514d3ce, 0x60a87aed), COMB_W(0x17200b76, 0x0fd0c98b), COMB_W(0xecc69a88, 0x2556b32a) },
+      { COMB_W(0x246e8c84, 0x688087e8), COMB_W(0x91a4bd14, 0xc08d703a), COMB_W(0xb02984dd, 0x5d02228f), COMB_W(0x3ce888ad, 0xd6ae0f68) }
+    },
+    { /* 53 */
+      { COMB_W(0x72b9b3e4, 0xc0f43db7), COMB_W(0xe64cea79, 0xa2fa6697), COMB_W(0xedaad7eb, 0x46666e37), COMB_W(0x54b9fa8f, 0x3c3f9fbf) },
+      { COMB_W(0x0bb06f92, 0x5c6d5194), COMB_W(0x58a00384, 0xcc278c98), COMB_W(0x299e8119, 0x5bd2d51c), COMB_W(0x68d08494, 0x3d10fb0a) }
+    },
+    { /* 54 */
+      { COMB_W(0xc76d5d37, 0x3c242cb9), COMB_W(0x51b45cb5, 0x15abb132), COMB_W(0xef41f36f, 0xca190df3), COMB_W(0x23d2fb49, 0xcb24db4e) },
+      { COMB_W(0xef2d3598, 0x5d8cf226), COMB_W(0x2ff2378a, 0xd8998910), COMB_W(0x4f3efb92, 0xd64366ca), COMB_W(0x4f2324cb, 0xf17671ed) }
+    },
+    { /* 55 */
+      { COMB_W(0xd32b3d37, 0x2fc93cad), COMB_W(0x0a1ea5a7, 0x26eec31b), COMB_W(0x31de9b86, 0xa3749df7), COMB_W(0x6a7ba5f2, 0xe1937eeb) },
+      { COMB_W(0x4059c77e, 0xa4e7823f), COMB_W(0xebfd7466, 0x1746284b), COMB_W(0xaf7df48f, 0x1fc1094c), COMB_W(0xc68959e7, 0xaacfbcfc) }
+    },
+    { /* 56 */
+      { COMB_W(0xb87ddb90, 0x1fd7208d), COMB_W(0xfbab2ab3, 0x48befb64), COMB_W(0x5c895090, 0xca9b0d0a), COMB_W(0xec00a74f, 0xdb6f2ca4) },
+      { COMB_W(0xd2f3a488, 0xe7de0469), COMB_W(0x186e3d6c, 0x2a494ec2), COMB_W(0x23d85d02, 0xdff19d1c), COMB_W(0xe616b278, 0x12d435b6) }
+    },
+    { /* 57 */
+      { COMB_W(0xa2588ab3, 0x475c6884), COMB_W(0xc5d2a52c, 0xcc6877e0), COMB_W(0x4965faac, 0x18afe006), COMB_W(0x66e628bd, 0xd052efe5) },
+      { COMB_W(0x13ef1910, 0x7cea8d58), COMB_W(0x4d9b7933, 0x8ca097de), COMB_W(0x0c545d94, 0x33a5ba96), COMB_W(0x25fc5d3e, 0x4b9f341d) }
+    },
+    { /* 58 */
+      { COMB_W(0x6ce91cc1, 0x5dc24f56), COMB_W(0xaed5c5eb, 0x9d7a073f), COMB_W(0x26d12adc, 0x3b9c3e8b), COMB_W(0x1ea65308, 0x2e54d514) },
+      { COMB_W(0x11f8c1aa, 0x8f514c01), COMB_W(0x68b92922, 0x7b2b3f1a), COMB_W(0x87157a7a, 0x9a27ddd4), COMB_W(0x97db6855, 0x0677e332) }
+    },
+    { /* 59 */
+      { COMB_W(0xd6972674, 0xb0c4a937), COMB_W(0x15f328dc, 0x319330e6), COMB_W(0xd4ee97cc, 0x574541c9), COMB_W(0x6e942286, 0x1348adf0) },
+      { COMB_W(0x3c197092, 0x6b36a2c4), COMB_W(0x1b9982b7, 0xd5bc83c0), COMB_W(0xe4a93d0b, 0x01f84986), COMB_W(0x5f3bfb07, 0xc3493c2b) }
+    },
+    { /* 60 */
+      { COMB_W(0xe032f548, 0x4f761ad6), COMB_W(0x22a11d24, 0x0bbd4be3), COMB_W(0xf9457908, 0x055f92b4), COMB_W(0x1a4dd4af, 0x86ed1738) },
+      { COMB_W(0x7fafd6f4, 0xce7e73f5), COMB_W(0x9fb2c2eb, 0x5eb32156), COMB_W(0x54b29f1c, 0x1c5a467f), COMB_W(0x3a21b153, 0x457ff836) }
+    },
+    { /* 61 */
+      { COMB_W(0xfb45ef53, 0xea5abfc8), COMB_W(0x07acb9bf, 0xafa61bb6), COMB_W(0x2e0a3372, 0x2d2bd8cb), COMB_W(0x0159587a, 0xe2e0d4ee) },
+      { COMB_W(0xce883ef3, 0x06064eb3), COMB_W(0x14729529, 0xa90d20ff), COMB_W(0xe596b952, 0xe2bdce56), COMB_W(0x7b7da594, 0x4beb7b66) }
+    },
+    { /* 62 */
+      { COMB_W(0x379db4d8, 0xc5cd525d), COMB_W(0xbdda426b, 0x4a954c99), COMB_W(0x8b146edc, 0x95e450e6), COMB_W(0x64b733c6, 0xa1d24388) },
+      { COMB_W(0x57029381, 0xa11a224d), COMB_W(0xef04c6b2, 0x6b04ada7), COMB_W(0x6c544878, 0x98cceb0a), COMB_W(0xbf027b74, 0x1537a269) }
+    },
+    { /* 63 */
+      { COMB_W(0xc1462a9c, 0x03f4fcea), COMB_W(0xaaf7e01d, 0x41324f25), COMB_W(0xa6725a79, 0x73f619a3), COMB_W(0x66c93ef0, 0x3fd1f24d) },
+      { COMB_W(0x23588ae4, 0x17c1099f), COMB_W(0x831491c3, 0x0e07022b), COMB_W(0xa3d4390f, 0x6a69a5dd), COMB_W(0xb81ff5b8, 0x5b096f58) }
+    }
+  },
+  { /* block 1 */
+    { /* 1 */
+      { COMB_W(0x015e2e65, 0x580b2322), COMB_W(0x4eccac60, 0x96513cca), COMB_W(0xf9571975, 0xc0d5934a), COMB_W(0xa7163c2b, 0x9b973c17) },
+      { COMB_W(0x3933b223, 0x2197ffe9), COMB_W(0xb841a4f4, 0xe09952d7), COMB_W(0x63389991, 0x545a6b7a), COMB_W(0x308a9a79, 0x7af31fa5) }
+    },
+    { /* 2 */
+      { COMB_W(0x0758cb4d, 0x57c6f8fb), COMB_W(0xf517323e, 0x3f09b5d3), COMB_W(0x38f9434c, 0x2f72e662), COMB_W(0x8c76689b, 0xa78a1661) },
+      { COMB_W(0x7dc5b39a, 0x9bcf2306), COMB_W(0xf0b11fc3, 0x136bc05f), COMB_W(0x288489b0, 0xc63d6dcd), COMB_W(0xcd317299, 0x0a409d3a) }
+    },
+    { /* 3 */
+      { COMB_W(0x68e48623, 0x17aafa0f), COMB_W(0x3da6df32, 0x1dfcf87f), COMB_W(0x4f857216, 0x62785193), COMB_W(0x5dfafba5, 0x26ab2157) },
+      { COMB_W(0xa4c580fe, 0x492233e7), COMB_W(0xe26a6315, 0x8cb20c2f), COMB_W(0xe8e2f48c, 0xebf0e66a), COMB_W(0xd97650fc, 0x4b0d0978) }
+    },
+    { /* 4 */
+      { COMB_W(0xc7d0b24c, 0xc5852e50), COMB_W(0x8b2c7e63, 0xcf570cc5), COMB_W(0xc1f9aa23, 0x49ee7eff), COMB_W(0xe486c7df, 0xfeabb058) },
+      { COMB_W(0x66ba3cad, 0xaecf107d), COMB_W(0x694463d6, 0x3392ebd8), COMB_W(0x9ee88a5c, 0x9f51e05a), COMB_W(0x51fd75ed, 0x5606a12e) }
+    },
+    { /* 5 */
+      { COMB_W(0xedb18b45, 0x3cdec644), COMB_W(0x571b3202, 0xf467b2fc), COMB_W(0x1ab533f0, 0x4ef33529), COMB_W(0x560bf6b6, 0xb3f8f8a3) },
+      { COMB_W(0xf65d6c5e, 0x27b7d5a7), COMB_W(0xdeafb716, 0x5dfcaac8), COMB_W(0x1e1beb43, 0x673a94cd), COMB_W(0xdbbccfb7, 0xc5967ef2) }
+    },
+    { /* 6 */
+      { COMB_W(0xfd3d4165, 0xe27a0516), COMB_W(0x2f4339bc, 0xd897729c), COMB_W(0xea33894b, 0x20fd52d2), COMB_W(0x5ddf1338, 0x5d3349ea) },
+      { COMB_W(0x5bb9c1b6, 0x17bcf9bc), COMB_W(0x4c62e673, 0xa7e88caf), COMB_W(0xf5f3a905, 0xf83c1a49), COMB_W(0xe5830939, 0xa1e7e77b) }
+    },
+    { /* 7 */
+      { COMB_W(0x0161fa32, 0xba61d6fc), COMB_W(0x0cf828ab, 0x43e894e6), COMB_W(0x722fd035, 0xcd15fba4), COMB_W(0xa30bbfe1, 0xd01e9582) },
+      { COMB_W(0x029987d7, 0x8a299d82), COMB_W(0x54d9eb33, 0x1be78777), COMB_W(0xf322e82a, 0x7b689173), COMB_W(0x85526b0a, 0xc2824d9a) }
+    },
+    { /* 8 */
+      { COMB_W(0x355c95a1, 0xfd698f73), COMB_W(0xcb4cb3a7, 0x2a5c98ea), COMB_W(0x676e37e7, 0xfc8b8d71), COMB_W(0x9c7a4efa, 0x52a32680) },
+      { COMB_W(0x122443bd, 0x120cf142), COMB_W(0x94b07cd5, 0xea879e7c), COMB_W(0x16c424c1, 0xd0ade69b), COMB_W(0xa2c4a71a, 0xb2150c7b) }
+    },
+    { /* 9 */
+      { COMB_W(0x3327fe1a, 0x6de3b304), COMB_W(0x68b4bb10, 0xf65d99a5), COMB_W(0xee2effa9, 0x1208ebec), COMB_W(0x1280f6fc, 0xb3562f47) },
+      { COMB_W(0xe8cf6bef, 0xf177f436), COMB_W(0xb6ff63d8, 0xf2931248), COMB_W(0x21d11307, 0x0615e1c9), COMB_W(0xf6c0788a, 0x0c58e53d) }
+    },
+    { /* 10 */
+      { COMB_W(0xc3a1c02c, 0x2c4d34b4), COMB_W(0xca6c8ae5, 0x7b709103), COMB_W(0xb4370086, 0x893b217b), COMB_W(0x131db560, 0xb4205fa4) },
+      { COMB_W(0xa412d677, 0xbbbc250d), COMB_W(0x63dbb4f1, 0x4797d1b2), COMB_W(0x9d1a84b3, 0x378e27d3), COMB_W(0xc3f1514c, 0xd855276d) }
+    },
+    { /* 11 */
+      { COMB_W(0xb6578cfe, 0xf44a9339), COMB_W(0x78d1fdf8, 0x230c78f8), COMB_W(0xc4cbbec5, 0x3bb8e49c), COMB_W(0xe6b4d063, 0x0ddbdfb0) },
+      { COMB_W(0x7680a1d0, 0x4fe2ac81), COMB_W(0x268eb744, 0x3395d406), COMB_W(0xca5ff576, 0xe7fc33f9), COMB_W(0x477a1cc8, 0x7e94e100) }
+    },
+    { /* 12 */
+      { COMB_W(0x4699846c, 0xb1835a6d), COMB_W(0x57f89157, 0xcbb53e56), COMB_W(0xc8c45694, 0x97287500), COMB_W(0x055f94a1, 0x8b9e10b4) },
+      { COMB_W(0x7e33c5ca, 0x25c6f601), COMB_W(0xa7e2b1f6, 0xbb79834a), COMB_W(0x6e7f43ba, 0x5917ac67), COMB_W(0xf41b782b, 0xd3d555c8) }
+    },
+    { /* 13 */
+      { COMB_W(0xc1fd5309, 0xe2bea696), COMB_W(0x7e53fee3, 0xf9b7562d), COMB_W(0xf5614cc9, 0x3c100cc1), COMB_W(0xecc1b19a, 0x10afcea0) },
+      { COMB_W(0x230c2836, 0xf8afff76), COMB_W(0x3d050752, 0x13ee3387), COMB_W(0x77d02db3, 0xbe3f2b4f), COMB_W(0xd1964bd3, 0xe22db746) }
+    },
+    { /* 14 */
+      { COMB_W(0x304e3cae, 0xe4eb5cea), COMB_W(0xe6e81c30, 0x6140dce4), COMB_W(0x0c5d4495, 0xfccf731c), COMB_W(0x975e77f4, 0x743c0e60) },
+      { COMB_W(0x2434001b, 0xe641b6e4), COMB_W(0xc2df4766, 0xeaaa967d), COMB_W(0x1106a835, 0x3e95bd9a), COMB_W(0x6560a33f, 0xb7cdc9f5) }
+    },
+    { /* 15 */
+      { COMB_W(0x3bc02f96, 0x342d2724), COMB_W(0xd7f9660f, 0xf983e78d), COMB_W(0xd53feece, 0x9af8d061), COMB_W(0xeb0a6410, 0x20478874) },
+      { COMB_W(0x22187474, 0xb63aadd5), COMB_W(0xfeb32a68, 0xe4375922), COMB_W(0x7a854545, 0x9c8e4e0a), COMB_W(0x469e0866, 0xa37dd4b2) }
+    },
+    { /* 16 */
+      { COMB_W(0x29dd16ed, 0x044c1b21), COMB_W(0xd8432893, 0xc3d8180f), COMB_W(0xb39e7d76, 0x65bc22d4), COMB_W(0x1b3e00b3, 0x20971112) },
+      { COMB_W(0x8de24014, 0xb7f594c7), COMB_W(0x4fff41a9, 0xf0b6a9e9), COMB_W(0xf11325d9, 0xc0df7684), COMB_W(0x9b442543, 0xfaf3e2d2) }
+    },
+    { /* 17 */
+      { COMB_W(0x25d5dc67, 0xb1a64230), COMB_W(0xabcf322d, 0x6161b90d), COMB_W(0x443b92ce, 0xe80cbb34), COMB_W(0x67eb8b42, 0x0880854f) },
+      { COMB_W(0x92f7c528, 0x3d845312), COMB_W(0x8f495927, 0x1689ada4), COMB_W(0xf3da5538, 0x3e93138b), COMB_W(0xb215cdf6, 0xfe1a41f1) }
+    },
+    { /* 18 */
+      { COMB_W(0xb2a5372d, 0x4bffac00), COMB_W(0x53f45f00, 0x2a1b3f2c), COMB_W(0xc805cfcc, 0x132ddeb2), COMB_W(0x3d98b935, 0xf366e6a9) },
+      { COMB_W(0x39e80de2, 0xd30bbaa4), COMB_W(0xe44be412, 0xf36d956c), COMB_W(0x6d6473c8, 0xb402b28d), COMB_W(0xce79fd94, 0x96ee76f2) }
+    },
+    { /* 19 */
+      { COMB_W(0x88e87aac, 0x400ae954), COMB_W(0x798461dd, 0x2c140600), COMB_W(0xda187196, 0xc2542392), COMB_W(0x702dff38, 0x47d30c6f) },
+      { COMB_W(0x6151d313, 0xbbc791c4), COMB_W(0x54e467b2, 0x7bca4454), COMB_W(0x6a4b540e, 0x3f967475), COMB_W(0x73a646e6, 0x7a6178ca) }
+    },
+    { /* 20 */
+      { COMB_W(0x1a4b5180, 0x1ccfd54b), COMB_W(0xc5cc7e37, 0xdd4936fb), COMB_W(0x97518efa, 0x91afcdee), COMB_W(0x5db0c35a, 0x41dfdc9f) },
+      { COMB_W(0x69bf13b3, 0x85b8175f), COMB_W(0x3d9234ed, 0xbe3d5ff6), COMB_W(0x5b96f619, 0x18bcf93f), COMB_W(0xd000379c, 0x4bc32b89) }
+    },
+    { /* 21 */
+      { COMB_W(0x479fff92, 0x5ac7597a), COMB_W(0x87812048, 0x0aa8c113), COMB_W(0xa7cfd8f1, 0x15e99283), COMB_W(0x5907fbe9, 0x663d7329) },
+      { COMB_W(0x6094878d, 0x646a6696), COMB_W(0x4d0d5390, 0x42a1fbb5), COMB_W(0xce4be50b, 0x222a4165), COMB_W(0x0efb091b, 0x191d1704) }
+    },
+    { /* 22 */
+      { COMB_W(0x80376790, 0x5e3bf84b), COMB_W(0xd5590cbf, 0x656e936d), COMB_W(0x5a357875, 0x77ec3968), COMB_W(0x4afc4993, 0xf8fdd0ad) },
+      { COMB_W(0x7bd6bdbb, 0x8ed740fe), COMB_W(0x02923b6d, 0x48479dc2), COMB_W(0x524975a5, 0x2dc677a9), COMB_W(0x03d978a5, 0xa330bbbb) }
+    },
+    { /* 23 */
+      { COMB_W(0xaa9de6b3, 0x5a33ed31), COMB_W(0x8f867d85, 0x469fbb92), COMB_W(0x459642b3, 0x4a543318), COMB_W(0x49f3ea5d, 0xc01b71b4) },
+      { COMB_W(0xa8ee3b42, 0x86f3b9de), COMB_W(0x47903666, 0x56aad9c6), COMB_W(0x31345fb3, 0x58bacf65), COMB_W(0x1f83470d, 0xe8661737) }
+    },
+    { /* 24 */
+      { COMB_W(0x14e593cc, 0x53e6fdfe), COMB_W(0x5be91163, 0x9f19ed82), COMB_W(0x51cddb7c, 0x124c715f), COMB_W(0xa2a3d0d8, 0xdc6ad0b6) },
+      { COMB_W(0xff0912cf, 0xb65dd89c), COMB_W(0x38664e11, 0x2122dd6d), COMB_W(0xb5f47434, 0x7401e81c), COMB_W(0xf19ef68a, 0x4ae34d1a) }
+    },
+    { /* 25 */
+      { COMB_W(0x34ccac5c, 0xeea3dcc7), COMB_W(0x7b62d2e3, 0x7954cb54), COMB_W(0xb961692f, 0xe09fa08e), COMB_W(0xe24f4db2, 0x811cd715) },
+      { COMB_W(0x2a4922f0, 0x630c6b77), COMB_W(0xc3905cb8, 0x385e49d1), COMB_W(0x12472042, 0x908d3e1c), COMB_W(0x2f9926c9, 0x1206758f) }
+    },
+    { /* 26 */
+      { COMB_W(0xfc7477c5, 0x3b1be51a), COMB_W(0x5d64119e, 0x58f95ccd), COMB_W(0x5791786a, 0x56a711ac), COMB_W(0x8062e0a2, 0x77658d3a) },
+      { COMB_W(0x7bf3be0a, 0xf07a7b7f), COMB_W(0xfc6c6b05, 0x5dc011cc), COMB_W(0xf52cddd6, 0xe9435088), COMB_W(0x13b7a6ff, 0x0af60b15) }
+    },
+    { /* 27 */
+      { COMB_W(0x15c7d500, 0xe43100b2), COMB_W(0xa4b590a9, 0x6af02e13), COMB_W(0xefdd9039, 0x7f5e37d1), COMB_W(0x9206f43c, 0xe5e6b4e3) },
+      { COMB_W(0xbaa85680, 0x2058eeef), COMB_W(0x4fe4913d, 0x6de92169), COMB_W(0xeec93bbb, 0x234e5eef), COMB_W(0x5c8088e7, 0xf8f04f5a) }
+    },
+    { /* 28 */
+      { COMB_W(0xb36830db, 0x4304e903), COMB_W(0xacbed09d, 0xa30caf7e), COMB_W(0xf3ea2313, 0x7ee376e7), COMB_W(0x9df83fbb, 0x57c96c48) },
+      { COMB_W(0x51d65c4c, 0xef5fa391), COMB_W(0x2eadaf31, 0x4a58bf59), COMB_W(0xb6dd7e59, 0x485cb56f), COMB_W(0xee9ce866, 0x686154d0) }
+    },
+    { /* 29 */
+      { COMB_W(0x46110ba1, 0x2b678eca), COMB_W(0xe9a9e140, 0x97951b20), COMB_W(0x2775693d, 0x72e4cb7a), COMB_W(0xe90991a5, 0x385fce5a) },
+      { COMB_W(0xe3cb24ce, 0xeb149789), COMB_W(0x2188c8b4, 0x14e767a0), COMB_W(0x1da73c28, 0x09f89388), COMB_W(0xab71518a, 0xbd20b508) }
+    },
+    { /* 30 */
+      { COMB_W(0xcee646b0, 0x96b60b23), COMB_W(0x4917e606, 0x2b772fc4), COMB_W(0x94890553, 0x2bf86a09), COMB_W(0xebe9bca2, 0x25e6f01d) },
+      { COMB_W(0xe1efdb7c, 0x86191b66), COMB_W(0x81325d01, 0x7b025655), COMB_W(0xd668e8ad, 0x1dfa5798), COMB_W(0x6eece93c, 0x4ae9aabf) }
+    },
+    { /* 31 */
+      { COMB_W(0x28dc76ce, 0xa9a23a70), COMB_W(0x64d5a0b3, 0x8a3bc209), COMB_W(0xff8fb2eb, 0xbf86202f), COMB_W(0x605b5f2d, 0x618d2cec) },
+      { COMB_W(0x1406c5b5, 0x952be9cf), COMB_W(0x3b08c1be, 0x46453369), COMB_W(0xf2b7af7f, 0x1139c685), COMB_W(0x696ba750, 0x994bfdf5) }
+    },
+    { /* 32 */
+      { COMB_W(0x0c665cf9, 0x73b4df41), COMB_W(0xfe6784fa, 0x0f696a51), COMB_W(0x44d95fec, 0xd3177c78), COMB_W(0xc827ed76, 0x3ffec8d1) },
+      { COMB_W(0x2e5b6a23, 0x80f91f4a), COMB_W(0xbfe9a610, 0x6c0047b3), COMB_W(0x60e17d7b, 0x66ef3cd3), COMB_W(0x1e4c4475, 0xf2da5ed5) }
+    },
+    { /* 33 */
+      { COMB_W(0xb455e75a, 0xf94e7894), COMB_W(0x4264f9ac, 0xcccad784), COMB_W(0xb97cf39b, 0xbeba0c7e), COMB_W(0xa975079a, 0xb82c64d8) },
+      { COMB_W(0x5472a3c3, 0x28e0c904), COMB_W(0xe64a6735, 0xa8ebe45a), COMB_W(0x3f849034, 0xbb231283), COMB_W(0x349f7d22, 0x91ad58a5) }
+    },
+    { /* 34 */
+      { COMB_W(0xd35e8bcf, 0xb012083b), COMB_W(0x69a80b85, 0x02d4e412), COMB_W(0x10870d1d, 0xd3c5d3b8), COMB_W(0xea394352, 0x584e9c72) },
+      { COMB_W(0x67c5a243, 0x3942d95f), COMB_W(0xcad267a1, 0x003e1e51), COMB_W(0xa62e8eb4, 0x4817430f), COMB_W(0xd3dd8146, 0x1d0c7468) }
+    },
+    { /* 35 */
+      { COMB_W(0x51edd473, 0x3616e31a), COMB_W(0xcf2888ad, 0x13ecc717), COMB_W(0x4181dd10, 0x58aeb1f0), COMB_W(0x91229c82, 0xd48bc7f4) },
+      { COMB_W(0xe1d9e52a, 0x951fb7a7), COMB_W(0x94bc69cd, 0x46b73218), COMB_W(0xce6df37e, 0xf3adc699), COMB_W(0x1d088e15, 0xb43f0963) }
+    },
+    { /* 36 */
+      { COMB_W(0x56d4d41e, 0x944f2e41), COMB_W(0x6aec136c, 0x31d1960d), COMB_W(0x6121b8b2, 0xdbce3ea3), COMB_W(0x0915b932, 0x3b3463d9) },
+      { COMB_W(0x3d68a1da, 0x36e1f466), COMB_W(0xd2dbb1b5, 0xcbcf8953), COMB_W(0x16fd4c20, 0xfa050f0c), COMB_W(0xbc3fe6e2, 0x265b94d6) }
+    },
+    { /* 37 */
+      { COMB_W(0x43aa1d81, 0x7f17e9a9), COMB_W(0xac095b1a, 0x137cd480), COMB_W(0x298a63ee, 0x02b099eb), COMB_W(0xdb75d9f5, 0xb9452dc5) },
+      { COMB_W(0x76278600, 0x1b86115e), COMB_W(0x40d74f46, 0xf5a47363), COMB_W(0x672d02c4, 0x025fb4d0), COMB_W(0xba7fde31, 0xfecc3d9f) }
+    },
+    { /* 38 */
+      { COMB_W(0xaeb102e3, 0xfcb447fa), COMB_W(0xe9751101, 0xe4ee0904), COMB_W(0xe0557079, 0x74d13b84), COMB_W(0x48fc62e9, 0x0b7adf06) },
+      { COMB_W(0x45e462e8, 0xe9ba11d8), COMB_W(0x3a47de7b, 0x4616a384), COMB_W(0x1766b37d, 0x78ba29f5), COMB_W(0xfcdbfcc0, 0xda076aa0) }
+    },
+    { /* 39 */
+      { COMB_W(0xcf5502d8, 0xaf52edc6), COMB_W(0xc1ddc0ac, 0xd87bb4c8), COMB_W(0x0b7253ea, 0xa98e2371), COMB_W(0xb05fc89e, 0xfae188f9) },
+      { COMB_W(0x52fbc262, 0x2627d750), COMB_W(0x3a4bc8a4, 0xcb3bbba9), COMB_W(0xedbce50c, 0xeb077440), COMB_W(0xd6c8f310, 0xcf1d34ba) }
+    },
+    { /* 40 */
+      { COMB_W(0xdba17342, 0x0b59ef60), COMB_W(0xae507354, 0xa6eb2b73), COMB_W(0x49dc5b1f, 0x34ef1f86), COMB_W(0xb143f572, 0x3aa510be) },
+      { COMB_W(0xed616c32, 0x14219bd3), COMB_W(0x6c449022, 0xd8ebf654), COMB_W(0x03c233a9, 0x3bb2bc71), COMB_W(0x939d9970, 0xfbc5f98b) }
+    },
+    { /* 41 */
+      { COMB_W(0xc36d4286, 0x6b6ea820), COMB_W(0x305acc07, 0x7d7a4141), COMB_W(0xd740f49a, 0xa13220cb), COMB_W(0x3467071d, 0x4495ec5a) },
+      { COMB_W(0x2d741f80, 0xa2afd14b), COMB_W(0xd4fcc737, 0x2cd794fa), COMB_W(0x1549c5ee, 0xcd61c152), COMB_W(0x037fc20c, 0xddd4876c) }
+    },
+    { /* 42 */
+      { COMB_W(0x4c0e0f2b, 0xd32b8dc7), COMB_W(0xe045ef53, 0x9923ca33), COMB_W(0x0c59ddbf, 0xb69d2c43), COMB_W(0xec7a430f, 0xaa81be4e) },
+      { COMB_W(0xb4c8652d, 0x2d279c9d), COMB_W(0xab792607, 0x399bb704), COMB_W(0x1391e3f4, 0x089b9d95), COMB_W(0x2601a3f0, 0xffdd24d5) }
+    },
+    { /* 43 */
+      { COMB_W(0x5d6a0b41, 0x0db48017), COMB_W(0xfa8ce8d6, 0x7d1a1a19), COMB_W(0xd99a5645, 0x798b9ed6), COMB_W(0x2664a585, 0x87830cbc) },
+      { COMB_W(0xa235461d, 0x3c01c9c3), COMB_W(0xa369ea45, 0x29c5b6bd), COMB_W(0x78135576, 0x3931a7c3), COMB_W(0x10be3a08, 0x020e2cdc) }
+    },
+    { /* 44 */
+      { COMB_W(0x7e16fabb, 0x334d8b2a), COMB_W(0xbb113ff6, 0x294f1e2e), COMB_W(0x06f1515a, 0x73ac872a), COMB_W(0x7e6d099c, 0xb5533e55) },
+      { COMB_W(0xf7af284e, 0x8cfeb695), COMB_W(0xa70d7185, 0xdef0b431), COMB_W(0x41e4f83f, 0x3f930a61), COMB_W(0xaae40123, 0x5cd097d1) }
+    },
+    { /* 45 */
+      { COMB_W(0x8f70666c, 0x5300902f), COMB_W(0xac888e12, 0xa49bafc3), COMB_W(0xe0edcb0c, 0x9e0af006), COMB_W(0xd409fe67, 0xa3aef01b) },
+      { COMB_W(0x006be696, 0xae33b4e8), COMB_W(0xcf4e4650, 0x09c4e70c), COMB_W(0xb7319e53, 0x972dc463), COMB_W(0xe53cb614, 0x9f913600) }
+    },
+    { /* 46 */
+      { COMB_W(0x467c8bd3, 0x5050951a), COMB_W(0x651797d3, 0xdc6fb2ea), COMB_W(0x108832b6, 0xda536382), COMB_W(0xd6caeba2, 0x19e0413d) },
+      { COMB_W(0xd692b7b6, 0x5c1172d5), COMB_W(0xa7822220, 0x9bfc8371), COMB_W(0x8ee697ed, 0xe75687bd), COMB_W(0x78f849bc, 0xe2b034d3) }
+    },
+    { /* 47 */
+      { COMB_W(0x16a7126a, 0x867a9466), COMB_W(0x26f40bab, 0x60397d8f), COMB_W(0x9e919bbf, 0xc33cb0f6), COMB_W(0xe6a67f56, 0x9b9b21aa) },
+      { COMB_W(0x8e662dda, 0xb4c39359), COMB_W(0x9138a236, 0xf468a2db), COMB_W(0xe0c3a149, 0xd2f9ecb9), COMB_W(0xc6155adf, 0xa18e7261) }
+    },
+    { /* 48 */
+      { COMB_W(0x8353dcfc, 0x6d200ae0), COMB_W(0xf3015f83, 0x5663262b), COMB_W(0x09cad462, 0xa4c899c9), COMB_W(0x2a908507, 0x7fae0d08) },
+      { COMB_W(0xc40c80aa, 0xc05fc437), COMB_W(0xc3d803f6, 0x2b0a2fc7), COMB_W(0x64382a4b, 0x2ec236e7), COMB_W(0x561ad5b5, 0xf715e635) }
+    },
+    { /* 49 */
+      { COMB_W(0xfd4882dc, 0xc16e6fc3), COMB_W(0x78864b42, 0x1bd9ac3e), COMB_W(0x84934a99, 0x3147d743), COMB_W(0xb403d8a9, 0xb696fab0) },
+      { COMB_W(0x5626a07b, 0x2e6647a6), COMB_W(0x80719ab6, 0x29dbd000), COMB_W(0xa563dc37, 0x4c008fa4), COMB_W(0x2d19e77d, 0xf9b57006) }
+    },
+    { /* 50 */
+      { COMB_W(0x1eabcf75, 0x3261f650), COMB_W(0x85b3ffa8, 0xf75ee5d4), COMB_W(0x4e2d80ab, 0xa4cd0ab6), COMB_W(0xd0769578, 0x3c35196e) },
+      { COMB_W(0x7d258abe, 0x1b3f2002), COMB_W(0xf52f5868, 0x1ece27f2), COMB_W(0xb4a0d73a, 0x68d5b805), COMB_W(0xf664e660, 0x5be6f823) }
+    },
+    { /* 51 */
+      { COMB_W(0xda56080d, 0x37e5a639), COMB_W(0x78be5635, 0x0fdbdf9b), COMB_W(0xfc42e29c, 0x6bacf47b), COMB_W(0xa788d561, 0xcb07ebe1) },
+      { COMB_W(0xfc61c6e8, 0x2d4ef7e0), COMB_W(0x950de57e, 0x9ab95e61), COMB_W(0xe4eb1925, 0x9ada3bfb), COMB_W(0x3e82abdd, 0x901c1d4d) }
+    },
+    { /* 52 */
+      { COMB_W(0x552e6592, 0x1015a787), COMB_W(0x3e708240, 0x8364dda3), COMB_W(0x70f0f5f9, 0x34cadce9), COMB_W(0x5eeb7df7, 0x9ec1188c) },
+      { COMB_W(0x2295990d, 0x500c6fe4), COMB_W(0xc8e8e772, 0x90b4ff9d), COMB_W(0xcd60d8ce, 0xc68a071f), COMB_W(0x0d1298bc, 0x64d89fe2) }
+    },
+    { /* 53 */
+      { COMB_W(0xbbb1c772, 0xd32e4b79), COMB_W(0x33749b95, 0xd4bfd722), COMB_W(0x6783ad02, 0x2f55a75f), COMB_W(0x06ccb662, 0x89caabed) },
+      { COMB_W(0xd6f3bf6e, 0x817e10c6), COMB_W(0xd63f8835, 0xdf4e592f), COMB_W(0x92952a86, 0xd476e184), COMB_W(0x8cb74b97, 0x4fdef5e5) }
+    },
+    { /* 54 */
+      { COMB_W(0xd4084443, 0x97665901), COMB_W(0xd56cb9b4, 0x0d22b869), COMB_W(0xa3d4d3ad, 0x93a70f94), COMB_W(0xffe32824, 0x6215c4c6) },
+      { COMB_W(0x834c9b77, 0x4aa33d61), COMB_W(0xda275b60, 0x20232adf), COMB_W(0xde66a8f8, 0x0f2962c5), COMB_W(0x48cf2270, 0xc0e71ff7) }
+    },
+    { /* 55 */
+      { COMB_W(0x31e65ee6, 0x9c512087), COMB_W(0xe4021730, 0xb9b83149), COMB_W(0x0b395e88, 0x23884447), COMB_W(0x0afe7c89, 0x379d6457) },
+      { COMB_W(0x3d9094b5, 0xa4b6fda5), COMB_W(0x4c17af46, 0x8e9d4328), COMB_W(0xe61d906e, 0x4b0127ce), COMB_W(0x760540ec, 0xa1257687) }
+    },
+    { /* 56 */
+      { COMB_W(0x63e21151, 0x77a76190), COMB_W(0x08cdcfe6, 0x387b806d), COMB_W(0x9e03d929, 0x9f494f63), COMB_W(0x56395695, 0x4ae2ce84) },
+      { COMB_W(0x96dc1552, 0xdb2fd0e2), COMB_W(0xb031a096, 0xc79025fa), COMB_W(0x99259022, 0x4fe12e3e), COMB_W(0x32de2a69, 0xbec5abfc) }
+    },
+    { /* 57 */
+      { COMB_W(0x467276c2, 0xcf35f2d9), COMB_W(0x4d1ef387, 0x3956857f), COMB_W(0x1714a7e6, 0x2227d0dc), COMB_W(0x8ed251da, 0x6bfd99ef) },
+      { COMB_W(0xa154d4cb, 0x6a0d4d17), COMB_W(0x26e82b1a, 0xf45d7146), COMB_W(0x1bf1de47, 0xe93d283b), COMB_W(0xfa64d127, 0xc26b0911) }
+    },
+    { /* 58 */
+      { COMB_W(0x9c60e638, 0x1e84d149), COMB_W(0xce32931e, 0x98c3f8a7), COMB_W(0xa3066b59, 0x803c544a), COMB_W(0x378ab00b, 0xe8771d01) },
+      { COMB_W(0xf9b30a3e, 0xaef3d893), COMB_W(0xfb1f1be7, 0x957b174a), COMB_W(0xacbc38ee, 0x958459b5), COMB_W(0x6df85e8e, 0xf87e5d8f) }
+    },
+    { /* 59 */
+      { COMB_W(0x5b9c7959, 0x86cfd0cd), COMB_W(0xadb97fed, 0x7de867da), COMB_W(0x2b17865b, 0xb01a404e), COMB_W(0x960c1c6f, 0xd4cbe941) },
+      { COMB_W(0x7d3a831c, 0x88e3ce50), COMB_W(0x72a9649e, 0x399ca4be), COMB_W(0x60e9a2b0, 0x41894512), COMB_W(0xe60ab41b, 0x1e93c6d3) }
+    },
+    { /* 60 */
+      { COMB_W(0x30e8aedd, 0x9962138a), COMB_W(0x4218a8f9, 0x43f26d97), COMB_W(0x61346e6b, 0xbfacecf0), COMB_W(0x78973123, 0xcdb87560) },
+      { COMB_W(0xd375c6b6, 0x3d167ea3), COMB_W(0xf6e0c329, 0x27ab7f3e), COMB_W(0xd41aee58, 0x379b8c9a), COMB_W(0x44d875c9, 0x4afa000f) }
+    },
+    { /* 61 */
+      { COMB_W(0x2ef975fe, 0x01c1cb85), COMB_W(0x5907c173, 0x9548bc85), COMB_W(0x23d6ebb7, 0xf581af86), COMB_W(0xf95003ec, 0xfc8efc21) },
+      { COMB_W(0x1365e4a7, 0x5c2476da), COMB_W(0xce91897a, 0xe5219de8), COMB_W(0xb440a819, 0xcbc2b183), COMB_W(0x3501b955, 0x45b9b3f7) }
+    },
+    { /* 62 */
+      { COMB_W(0x08b2b4bb, 0x76beed18), COMB_W(0x672d58e3, 0xa04491ef), COMB_W(0xfdb72cbb, 0xe77623dd), COMB_W(0x2c64dc4d, 0x4386be10) },
+      { COMB_W(0x47527cba, 0x52c33f03), COMB_W(0xbdb0168b, 0x917a6db2), COMB_W(0x9729d129, 0x419635e7), COMB_W(0x1f6fbb3e, 0x1ab8051a) }
+    },
+    { /* 63 */
+      { COMB_W(0x8097b414, 0x9866d55f), COMB_W(0xf0bd9109, 0x52e7803a), COMB_W(0x6be88a0d, 0x35afb696), COMB_W(0xb59456d7, 0x53709f92) },
+      { COMB_W(0x5280be9c, 0xc8e448d0), COMB_W(0x5d320135, 0xf8b79007), COMB_W(0x766febfb, 0x4419b5c1), COMB_W(0x4419176e, 0x7d6db830) }
+    }
+  },
+  { /* block 2 */
+    { /* 1 */
+      { COMB_W(0x1ebd8bac, 0x137de736), COMB_W(0xa2f8d561, 0x8688ce24), COMB_W(0x8937542b, 0x8cdec18e), COMB_W(0x9022e314, 0x949ccf3e) },
+      { COMB_W(0xf4ef5c08, 0x44c42ecc), COMB_W(0x7f49366c, 0x44ea7657), COMB_W(0x66d0bb04, 0x5226ce08), COMB_W(0x2fae5e4f, 0x2904a394) }
+    },
+    { /* 2 */
+      { COMB_W(0x96282910, 0xaee1337b), COMB_W(0x0898022a, 0x45c4a1b1), COMB_W(0xca356ef3, 0xefc35de1), COMB_W(0x8c6c923c, 0xf1a4351c) },
+      { COMB_W(0xcb451d5c, 0xd9c84abe), COMB_W(0x845362c1, 0xc6ddfa2a), COMB_W(0x5efbb231, 0x9eaa8e84), COMB_W(0xa1256fc8, 0x4d40ff6a) }
+    },
+    { /* 3 */
+      { COMB_W(0x436f1616, 0x4a2d1723), COMB_W(0x3f5c6f15, 0x27f903bc), COMB_W(0xbca045e4, 0x31758de2), COMB_W(0x8c4f098c, 0x250362a6) },
+      { COMB_W(0xdf9447ee, 0x1c1b2ab8), COMB_W(0xe8310496, 0x273bb696), COMB_W(0xa9eabab0, 0xf50b8c39), COMB_W(0x606949d3, 0xe8a0f64d) }
+    },
+    { /* 4 */
+      { COMB_W(0xbe840ca8, 0x4d6a6a96), COMB_W(0x953b9a77, 0x9a2e613f), COMB_W(0x9b8018b7, 0x5e7d2586), COMB_W(0x934c89b9, 0xaa1cdc48) },
+      { COMB_W(0xebef1485, 0x33d838ed), COMB_W(0x107d2df0, 0xe2e4ca9f), COMB_W(0x4516d6d6, 0xb31b2e9d), COMB_W(0x856af4ff, 0xbccaf40a) }
+    },
+    { /* 5 */
+      { COMB_W(0x94a67823, 0xeda37be9), COMB_W(0x8a4b256f, 0x698dc85e), COMB_W(0x07aadf0a, 0x83e5bf06), COMB_W(0x195b4201, 0x0c0da02e) },
+      { COMB_W(0x2d75a97c, 0x64e4fc64), COMB_W(0x98381440, 0x145c160d), COMB_W(0x512a2b54, 0xda0a0701), COMB_W(0xfc3b96fe, 0xaaf171ea) }
+    },
+    { /* 6 */
+      { COMB_W(0xc0311ab8, 0xa3b50775), COMB_W(0x0f5e3754, 0xafb56ef3), COMB_W(0x3aff8063, 0xb9cba4d9), COMB_W(0xe55c92ff, 0x229bb541) },
+      { COMB_W(0x2c05a834, 0x72dd3522), COMB_W(0x613fc089, 0x4aec9aad), COMB_W(0xa24ff0d6, 0xa36345e1), COMB_W(0xce82ab34, 0xdef7dc60) }
+    },
+    { /* 7 */
+      { COMB_W(0xcb4a478a, 0x1633d9c7), COMB_W(0x74cc1996, 0x3b562115), COMB_W(0x30145ed9, 0x483e492a), COMB_W(0xc81a09ea, 0x2788b96e) },
+      { COMB_W(0x675d1348, 0x1f4d8ede), COMB_W(0xe5586fb5, 0xf7efe624), COMB_W(0xb57051fd, 0x8e239fb0), COMB_W(0xb606ba2b, 0x45f96d3c) }
+    },
+    { /* 8 */
+      { COMB_W(0xad180dc0, 0xcaed764b), COMB_W(0x227f1d75, 0x86bd4cb5), COMB_W(0x2626f6ca, 0x66f6a11f), COMB_W(0x7e4573da, 0x81bc84dc) },
+      { COMB_W(0x9c83115f, 0x17c2f2f7), COMB_W(0x2fedf3c7, 0xd11e7fb4), COMB_W(0xf1bb9fc9, 0x3651b20b), COMB_W(0x8cbbeffd, 0x96069f25) }
+    },
+    { /* 9 */
+      { COMB_W(0x1452c258, 0xaa4a1ac0), COMB_W(0x2183f23e, 0x543da560), COMB_W(0x101d5b46, 0x03f6056a), COMB_W(0x6741bc2c, 0x929f5a7a) },
+      { COMB_W(0x394e9ce4, 0x363b30f4), COMB_W(0x083fdc9d, 0x528fa035), COMB_W(0x931d2afc, 0x310e234e), COMB_W(0x015b6593, 0xd84e8e63) }
+    },
+    { /* 10 */
+      { COMB_W(0xc9826030, 0xfc7779fa), COMB_W(0x78204475, 0x2bddeb07), COMB_W(0xdb2a86c3, 0xf366625d), COMB_W(0x16747592, 0xb44d6df6) },
+      { COMB_W(0xfc326eb2, 0xcf08b2dc), COMB_W(0x01e050b9, 0x74a605e9), COMB_W(0xd85b2ba0, 0x126acb40), COMB_W(0x82656396, 0x0679d832) }
+    },
+    { /* 11 */
+      { COMB_W(0x2c6c2f9b, 0x09f1d09c), COMB_W(0xbf4ea9cc, 0x91a3d6af), COMB_W(0xb8ec0404, 0x0d39733d), COMB_W(0x20712b15, 0x6730254a) },
+      { COMB_W(0x37a10905, 0xce48c883), COMB_W(0x5033900c, 0xd691fe2e), COMB_W(0x94279972, 0xfcb76ec3), COMB_W(0xdbe0b7e4, 0xffccdadc) }
+    },
+    { /* 12 */
+      { COMB_W(0x075e7e85, 0x5f889ddc), COMB_W(0x2501b925, 0x2c5fed4f), COMB_W(0xa1bbee14, 0xb35e0848), COMB_W(0x452bb4b4, 0x97a96d18) },
+      { COMB_W(0xc21f90b5, 0xe8114be2), COMB_W(0x8eeb6f53, 0x5cf7e877), COMB_W(0xb0f70585, 0x6e65090e), COMB_W(0x20f10d99, 0x7334e95e) }
+    },
+    { /* 13 */
+      { COMB_W(0x0febe6a7, 0x61dcb98d), COMB_W(0x3e304d9b, 0x4763b955), COMB_W(0x7cec5298, 0x77aa9fa4), COMB_W(0x6b588578, 0x488d0644) },
+      { COMB_W(0x688d8eaa, 0x5149f9f8), COMB_W(0x1fbbba06, 0xa496040a), COMB_W(0xa8251577, 0xa6d6b32b), COMB_W(0x34a594ca, 0xb1bcc511) }
+    },
+    { /* 14 */
+      { COMB_W(0x05dbad6b, 0x66e9ef97), COMB_W(0xf5694117, 0xf89e7998), COMB_W(0x10e32af3, 0xb1ee0ce0), COMB_W(0x6dc981fe, 0xd3a3306e) },
+      { COMB_W(0xab27bffc, 0x54f698be), COMB_W(0x73cfd46b, 0xfa58055a), COMB_W(0x746cfd14, 0x050817ce), COMB_W(0x09a96ef1, 0x81ca65eb) }
+    },
+    { /* 15 */
+      { COMB_W(0xfaedd1e0, 0xb4843e73), COMB_W(0x6103cdf9, 0x8cf2c1c4), COMB_W(0xa91b33a4, 0x039582e9), COMB_W(0x27964f33, 0x3dc7d0fd) },
+      { COMB_W(0xfb7de2f9, 0xc63cdf3e), COMB_W(0xaf1d93b0, 0x1f2e5abe), COMB_W(0x251c09be, 0x63b57272), COMB_W(0xe14a774b, 0xb3d96f7b) }
+    },
+    { /* 16 */
+      { COMB_W(0x28cf1ab9, 0x9076f57b), COMB_W(0x030b86e3, 0xcecac607), COMB_W(0xb927e350, 0x1cf2a53f), COMB_W(0x20e11856, 0x4880c79c) },
+      { COMB_W(0x8583bedb, 0xada7afe6), COMB_W(0x9fe0dc9b, 0x40e1b71e), COMB_W(0x31bdc3e3, 0xfb6de997), COMB_W(0xff67b352, 0xac437ef7) }
+    },
+    { /* 17 */
+      { COMB_W(0x89f27218, 0xfb3c4224), COMB_W(0xb6745654, 0xf00f3712), COMB_W(0x376c1201, 0x92043af6), COMB_W(0xe2574350, 0x52e9d7c3) },
+      { COMB_W(0xe07efb86, 0x32efea60), COMB_W(0x0a5c2536, 0xb0ccb27a), COMB_W(0xd39d820f, 0xa5dbe03d), COMB_W(0xe119a094, 0x6ff79fe8) }
+    },
+    { /* 18 */
+      { COMB_W(0x0aba428c, 0x330f7271), COMB_W(0x5df675e0, 0x53ff76d7), COMB_W(0x4b2e2f55, 0x56e23efe), COMB_W(0x906ba146, 0x36a01f6b) },
+      { COMB_W(0x8580c16c, 0x12ea9627), COMB_W(0x21a4d69f, 0xcac764c3), COMB_W(0x2417f1b9, 0x8d9395a1), COMB_W(0x5e2c9088, 0x3ee90881) }
+    },
+    { /* 19 */
+      { COMB_W(0x2b623f76, 0x2dab23f2), COMB_W(0x7f9f8ae0, 0x712f7b00), COMB_W(0xda6d7c5a, 0x84472dc5), COMB_W(0x2a27da80, 0x78bf1ad9) },
+      { COMB_W(0xfc6a1851, 0x32f480d5), COMB_W(0x288b4194, 0x7f5fc45a), COMB_W(0xf60e622d, 0x30286796), COMB_W(0xac73a7a6, 0xd1f17fcb) }
+    },
+    { /* 20 */
+      { COMB_W(0x2c64b4ea, 0x6e4d8ce2), COMB_W(0xc107ebbe, 0x64e166b8), COMB_W(0x0a5fe788, 0x827054ea), COMB_W(0x68824742, 0xf13e7f8d) },
+      { COMB_W(0x621ae579, 0x161a6078), COMB_W(0xd476e9f9, 0xf5fd9015), COMB_W(0x32158283, 0xe55f6c43), COMB_W(0xc7fa95d0, 0xc5312500) }
+    },
+    { /* 21 */
+      { COMB_W(0x517028b1, 0x2c305932), COMB_W(0x3333b6b5, 0x9c3fa472), COMB_W(0x056860eb, 0x02aaed9c), COMB_W(0x440d563a, 0xd6fee766) },
+      { COMB_W(0xfd203b51, 0xf725bf50), COMB_W(0xffd44c01, 0xb761bfa3), COMB_W(0xe6c36471, 0x235aa285), COMB_W(0xa48de79f, 0x99253ebe) }
+    },
+    { /* 22 */
+      { COMB_W(0xa1aafeb3, 0x718c48e1), COMB_W(0xff66e373, 0xb1e94de1), COMB_W(0xa0f31b71, 0x5090768b), COMB_W(0xf98e9d7c, 0x1b683fe1) },
+      { COMB_W(0x41be4ddc, 0x6473e191), COMB_W(0xe5edfd36, 0x2405ffed), COMB_W(0xdb6dbfd7, 0xfd0fe1c7), COMB_W(0x517536b9, 0xa96a557d) }
+    },
+    { /* 23 */
+      { COMB_W(0x42e4078b, 0x2cc9e480), COMB_W(0x9a59d0e9, 0x9777e83a), COMB_W(0xfd17ea1f, 0x8ec01bd3), COMB_W(0x6e666d38, 0x4070e856) },
+      { COMB_W(0x5e9c7e5e, 0x067f9ac2), COMB_W(0x7a65d996, 0xe85786b4), COMB_W(0xe6bf24ef, 0x40e2845d), COMB_W(0x36d015ee, 0xaed2d5cc) }
+    },
+    { /* 24 */
+      { COMB_W(0x72e69fe7, 0x5086da54), COMB_W(0x1592c516, 0xd45fe36c), COMB_W(0x70b6b8e7, 0x7e5d42be), COMB_W(0x331d2ed2, 0x49b50bc1) },
+      { COMB_W(0x4334069e, 0x5d710a4b), COMB_W(0x00ac605e, 0xcf814646), COMB_W(0x15fcc495, 0xbb9ec7a6), COMB_W(0x5cafafc2, 0x302ad7d1) }
+    },
+    { /* 25 */
+      { COMB_W(0xf4a8bf16, 0x289ad07e), COMB_W(0xa7727bcc, 0xb939a563), COMB_W(0x75c3f17a, 0xaf6685eb), COMB_W(0x48da2eeb, 0xaebf4a43) },
+      { COMB_W(0xb8fd4037, 0x6444a6af), COMB_W(0x4fab5341, 0xbdb5b2a0), COMB_W(0x01da3942, 0x97b640e5), COMB_W(0xa38be0db, 0x3a1a43aa) }
+    },
+    { /* 26 */
+      { COMB_W(0x4a440600, 0x40c3d2fe), COMB_W(0xaf702015, 0x2507882d), COMB_W(0xb37aa0ba, 0x68d1c0ea), COMB_W(0xcf0e68bf, 0x694f8d55) },
+      { COMB_W(0xe585212f, 0xa8098c25), COMB_W(0x0572259d, 0x6bc68b05), COMB_W(0x70def939, 0xa1634ea8), COMB_W(0xfa3d1801, 0x9d74fbad) }
+    },
+    { /* 27 */
+      { COMB_W(0x935fa1b3, 0x98fc3abd), COMB_W(0x2238c5db, 0x07b7befd), COMB_W(0x3ac1b8d7, 0x1ad91683), COMB_W(0x6cc0954d, 0x332571a7) },
+      { COMB_W(0x4c0abcc1, 0x1011afba), COMB_W(0xf1fbd6af, 0xb2e6b457), COMB_W(0x37a69fe0, 0x94401fb3), COMB_W(0x2672f7fd, 0x0d5066d9) }
+    },
+    { /* 28 */
+      { COMB_W(0x3f0d1678, 0x2e1e4d35), COMB_W(0x15d4352e, 0x13c0f319), COMB_W(0x6b640ecb, 0x781dd329), COMB_W(0x632b5819, 0x41f7e441) },
+      { COMB_W(0xf7a57301, 0x27621011), COMB_W(0x83546b32, 0x0b4dd5e4), COMB_W(0x360f37aa, 0xec5d283a), COMB_W(0xd93e12fe, 0xe55488f3) }
+    },
+    { /* 29 */
+      { COMB_W(0x54c0592b, 0x7b7f26da), COMB_W(0x3ed55086, 0x2933d5bb), COMB_W(0x7ebe1e39, 0x0556cf3e), COMB_W(0xb2bc2e85, 0xea620c17) },
+      { COMB_W(0xe992d15d, 0x53a47444), COMB_W(0x75ada7fd, 0x4e87ff86), COMB_W(0x17d6b5e0, 0x8d26fae9), COMB_W(0x9906e39e, 0x5ab0e23c) }
+    },
+    { /* 30 */
+      { COMB_W(0x1761086d, 0x3a367016), COMB_W(0x8f359fab, 0x9a84dffe), COMB_W(0xa1cb0562, 0xe9d24674), COMB_W(0x0cb3328d, 0xe19e5248) },
+      { COMB_W(0xc43b0f95, 0x3dcb859c), COMB_W(0xa97c0c9b, 0x54c7ae27), COMB_W(0xb820c4ca, 0x541722c2), COMB_W(0xea5a1a84, 0x51fd122a) }
+    },
+    { /* 31 */
+      { COMB_W(0xa6f1b4e8, 0x5bb281a7), COMB_W(0x4203371e, 0x4ea2cc6d), COMB_W(0xd9fdac16, 0xcd9115f5), COMB_W(0xeee2bcc3, 0x98215948) },
+      { COMB_W(0x86557543, 0x4bc369a3), COMB_W(0x5197b25f, 0xb44faac1), COMB_W(0x53b90f61, 0x1019e95e), COMB_W(0xece21ec7, 0xe4bfe451) }
+    },
+    { /* 32 */
+      { COMB_W(0xbcff6026, 0x7e460d62), COMB_W(0xa26e2a1e, 0x94139936), COMB_W(0xa1697678, 0xf8b8c55b), COMB_W(0x463d8e29, 0xe481aacd) },
+      { COMB_W(0x22665088, 0x8c11217f), COMB_W(0x8f9eac14, 0xda469b0a), COMB_W(0xf1fd6c67, 0x24f85296), COMB_W(0x400f734b, 0x7ae2a66e) }
+    },
+    { /* 33 */
+      { COMB_W(0x3afe9e3f, 0xcc6a0a14), COMB_W(0xc7b4a8ab, 0x05c3806d), COMB_W(0xae7fd484, 0x90b4a4de), COMB_W(0x4b7df0e6, 0xffbdaa8f) },
+      { COMB_W(0xa7f97fc4, 0xf69c7b84), COMB_W(0xabf4b1b6, 0x3b9f6811), COMB_W(0x37cbdce9, 0xed2e8ec2), COMB_W(0xcdad5bef, 0xea8f9c56) }
+    },
+    { /* 34 */
+      { COMB_W(0x7c3d6a09, 0x1cb9da5d), COMB_W(0x475897cd, 0x2f130597), COMB_W(0xb4107444, 0x0fb397aa), COMB_W(0x3a58e59d, 0x702fe18c) },
+      { COMB_W(0xcc5f0b18, 0xb050529d), COMB_W(0xbff1d9a7, 0x8f909240), COMB_W(0xc7daa841, 0xc6de7f0f), COMB_W(0x52dec96d, 0xa5871da3) }
+    },
+    { /* 35 */
+      { COMB_W(0xb6a4fe60, 0x8955a2f0), COMB_W(0xfb9a60b5, 0x38594f4b), COMB_W(0x4a544108, 0x3b92fa7b), COMB_W(0x19e7dafa, 0x4221f563) },
+      { COMB_W(0xd5a20c82, 0xb41c4249), COMB_W(0x65b78d7c, 0xfa4a1113), COMB_W(0xf75fd07c, 0xd6cbfc32), COMB_W(0xfc085f6b, 0x08680ed5) }
+    },
+    { /* 36 */
+      { COMB_W(0x43bdd47d, 0xd4e99c0f), COMB_W(0xd1a4bb01, 0xc1956175), COMB_W(0x400736c8, 0x615664b3), COMB_W(0x386842d0, 0x47780944) },
+      { COMB_W(0xe53bb7b0, 0x834395a7), COMB_W(0xeea6dcb9, 0x07617c11), COMB_W(0xb2f13821, 0xe7a1de3a), COMB_W(0xe94f3868, 0x6091f533) }
+    },
+    { /* 37 */
+      { COMB_W(0x43ae9541, 0x1ca9d370), COMB_W(0xb0d66c41, 0xe89ac77d), COMB_W(0x717b89a0, 0x0bc495a5), COMB_W(0x85413f86, 0x6154e803) },
+      { COMB_W(0x1591b47e, 0x0e35669f), COMB_W(0x94df1fab, 0x52f08179), COMB_W(0x7f4af14c, 0x7361cec2), COMB_W(0xf0745484, 0x4fea0bdb) }
+    },
+    { /* 38 */
+      { COMB_W(0x2b23b952, 0x0b827310), COMB_W(0xd4a55b7d, 0xf95cd13d), COMB_W(0xcba38c5a, 0x13161578), COMB_W(0xe4828f83, 0x86807d3f) },
+      { COMB_W(0x58bb5797, 0xfd10815e), COMB_W(0x7f58a315, 0xe31fed8c), COMB_W(0x50bc25b4, 0x24274cbb), COMB_W(0x0ea0264b, 0xae5ba177) }
+    },
+    { /* 39 */
+      { COMB_W(0x591dafac, 0x8aa6dc5c), COMB_W(0xce9a31bf, 0xf4bad064), COMB_W(0x11bbe97d, 0xd12458d4), COMB_W(0x37bc9dc9, 0xe27b6c8d) },
+      { COMB_W(0x9a2f5709, 0xcf61a032), COMB_W(0x23d04146, 0x6faa2db9), COMB_W(0x209468f5, 0xd65fb947), COMB_W(0x343529fc, 0xf258b06a) }
+    },
+    { /* 40 */
+      { COMB_W(0x396aa9a4, 0x89f6afca), COMB_W(0x6d321501, 0x3d60ba90), COMB_W(0x2722bd08, 0x5b755fad), COMB_W(0x4ac4a812, 0x4446b9b7) },
+      { COMB_W(0x8383f9fa, 0xdbd52466), COMB_W(0x32b47ee8, 0x75bcb01a), COMB_W(0xc0fb9c7f, 0x1a3670aa), COMB_W(0x2627f45f, 0xf6099fe4) }
+    },
+    { /* 41 */
+      { COMB_W(0xf92c87ef, 0x2bb9e841), COMB_W(0x9cb33704, 0xd64726d5), COMB_W(0xdad6e20f, 0xccec02c9), COMB_W(0x8d2167c7, 0xf4477b08) },
+      { COMB_W(0xac31098a, 0xacff115c), COMB_W(0xcb065ff3, 0x67f03593), COMB_W(0xbe0bc7f7, 0xaee56e05), COMB_W(0x60385bec, 0xc6c2d55f) }
+    },
+    { /* 42 */
+      { COMB_W(0x45251b27, 0x0817239b), COMB_W(0x3232a66d, 0x4bb1aadd), COMB_W(0xf74494ec, 0x16bb8065), COMB_W(0x3e34ff4a, 0xf2c18d73) },
+      { COMB_W(0xc981a676, 0xe5bce92d), COMB_W(0xc1c9361d, 0xde87f5e4), COMB_W(0x0bdf00cb, 0xbb375783), COMB_W(0x5ede00ef, 0x599d2c92) }
+    },
+    { /* 43 */
+      { COMB_W(0xc54334c7, 0x1968837d), COMB_W(0x599d0b70, 0x4ad5b3f5), COMB_W(0xeeb110a4, 0xf6a5cf33), COMB_W(0xa13a20e5, 0x5b3853e5) },
+      { COMB_W(0xcbfcc8a3, 0xbb5c1643), COMB_W(0xe5e41d96, 0xbc6f7f9e), COMB_W(0x5937211c, 0xd0a8a3dd), COMB_W(0x1e46d90b, 0x014dce39) }
+    },
+    { /* 44 */
+      { COMB_W(0x22dae961, 0x67a0e126), COMB_W(0x0a8f9c82, 0xf8811e88), COMB_W(0x9813b34c, 0x04f60c9f), COMB_W(0x0ba052d4, 0x4f4268f7) },
+      { COMB_W(0x4038489e, 0x26ac46a5), COMB_W(0x4c3d9553, 0x9fbe377c), COMB_W(0xfc4126a2, 0x7ebda484), COMB_W(0xb5c982ef, 0xdfb6beed) }
+    },
+    { /* 45 */
+      { COMB_W(0x7cff55b0, 0x8e3484bd), COMB_W(0xfd2d31f0, 0x57ff75c5), COMB_W(0xa954d006, 0x1e334155), COMB_W(0xc98cf6fd, 0xa07a7336) },
+      { COMB_W(0xd2b1f275, 0x32730e47), COMB_W(0x897a1d0b, 0x7d158171), COMB_W(0xd9f38bb5, 0xadde632b), COMB_W(0xec85d101, 0x7dc59302) }
+    },
+    { /* 46 */
+      { COMB_W(0xdeb17f9b, 0xc7f1c2f4), COMB_W(0xbaf618b3, 0xe0d0cbea), COMB_W(0x0e8806de, 0x052edc1c), COMB_W(0x499de491, 0x2dfb89b8) },
+      { COMB_W(0x56ca58cf, 0xc88e3da8), COMB_W(0x90ff4c26, 0xc4a8e553), COMB_W(0x9c35dd9d, 0x1833f340), COMB_W(0x163c2304, 0x88ebe56d) }
+    },
+    { /* 47 */
+      { COMB_W(0xdb8fc40b, 0x9867250c), COMB_W(0x47d0db5e, 0xc3af2633), COMB_W(0x55e08c28, 0x8d35bf7e), COMB_W(0x6cddb108, 0x4f679ee0) },
+      { COMB_W(0x2b64c7d9, 0x717f84d4), COMB_W(0xfa58ee19, 0x8cdf3fc9), COMB_W(0x589015bc, 0x730f5e84), COMB_W(0xeda62a3e, 0xc25849fc) }
+    },
+    { /* 48 */
+      { COMB_W(0x039fda7d, 0x7bf098eb), COMB_W(0x520183da, 0xa6cb08e6), COMB_W(0x7cccadef, 0xa25df586), COMB_W(0x746c1d33, 0xef4dfa3b) },
+      { COMB_W(0xf7000d20, 0x2e81a55a), COMB_W(0xd23a3a30, 0x78ec1951), COMB_W(0x50b97aa6, 0x792dcc9e), COMB_W(0x145d9e5b, 0x04caf459) }
+    },
+    { /* 49 */
+      { COMB_W(0x4ff0cf74, 0x1da061d6), COMB_W(0x8d673bd7, 0xb17fc6c7), COMB_W(0x2560197f, 0x9f164a36), COMB_W(0x7b842b1e, 0x8c9569cb) },
+      { COMB_W(0x1a498c46, 0x83f8a201), COMB_W(0xd704f70e, 0x05f8b506), COMB_W(0x9ee2af38, 0xb531c722), COMB_W(0x7fdebcd6, 0xecc1b659) }
+    },
+    { /* 50 */
+      { COMB_W(0x5e9186d9, 0xbaf977d6), COMB_W(0xb5d6ca04, 0xe61a7a72), COMB_W(0x5ab04895, 0xe76793bb), COMB_W(0xb1fc93bf, 0x6054eb05) },
+      { COMB_W(0x9776c511, 0x2325f685), COMB_W(0x206e155a, 0x50254159), COMB_W(0x4c014eb6, 0xbccbd8cc), COMB_W(0xba7d3be4, 0xece9b504) }
+    },
+    { /* 51 */
+      { COMB_W(0xa1a95b9e, 0x24ad1c6b), COMB_W(0x769a17b6, 0x695685a9), COMB_W(0x440e7874, 0x7e800b74), COMB_W(0x495395f7, 0xcb053a21) },
+      { COMB_W(0xb3e98b3c, 0x7776e9e5), COMB_W(0xc3f5b7d0, 0x8758f41c), COMB_W(0x78662ba8, 0x0c374f0a), COMB_W(0x6dc2b305, 0x84509bd4) }
+    },
+    { /* 52 */
+      { COMB_W(0xbd666d18, 0xae2a3707), COMB_W(0x4c82f4c0, 0x1d3afc93), COMB_W(0xaec81bf4, 0x3b57b04a), COMB_W(0x7c920f5f, 0x3165d719) },
+      { COMB_W(0x7d985b43, 0x01479731), COMB_W(0x6ab6e31a, 0xa0b24e76), COMB_W(0x52f66f0d, 0x66be4abe), COMB_W(0x10a1b8e5, 0xcd6d7c04) }
+    },
+    { /* 53 */
+      { COMB_W(0x610be7f4, 0xeb2d2f40), COMB_W(0x8e068316, 0x36b8021f), COMB_W(0x1976a9c3, 0xad23e56d), COMB_W(0x23733327, 0xdcf6fc61) },
+      { COMB_W(0x244a97b0, 0x0ab2bb7e), COMB_W(0xc78210a7, 0xd0c6137c), COMB_W(0xb3478fdb, 0x90f77a47), COMB_W(0x8e564442, 0xafa09fff) }
+    },
+    { /* 54 */
+      { COMB_W(0xc5527a14, 0xca4f7933), COMB_W(0x6ac78941, 0xc21030ff), COMB_W(0x047a367c, 0xa0c6b148), COMB_W(0xceb603ba, 0x6ca405b0) },
+      { COMB_W(0xb46c21a8, 0x4022c1c6), COMB_W(0x4f8127d9, 0x91871543), COMB_W(0x7eb6f74f, 0x14f10f7d), COMB_W(0x68f342d9, 0xea278f0b) }
+    },
+    { /* 55 */
+      { COMB_W(0x63152422, 0xa4cab0ce), COMB_W(0x90a9a061, 0x0d726ec5), COMB_W(0x0fd00639, 0x4eaa638f), COMB_W(0x105eaf16, 0xfb3226e2) },
+      { COMB_W(0x7a59f5f9, 0x6eebafa3), COMB_W(0xc849d05d, 0xae7857cc), COMB_W(0x12316e85, 0xf7242f03), COMB_W(0x8c1fe968, 0x53d45bd9) }
+    },
+    { /* 56 */
+      { COMB_W(0x412cdbe5, 0x70fdeb85), COMB_W(0x5795bf0f, 0x598b3403), COMB_W(0x39328308, 0x9ac58e59), COMB_W(0xe117c3a1, 0xc636b68f) },
+      { COMB_W(0xdb1aefa2, 0x6065c5dc), COMB_W(0x735452fe, 0x9de46443), COMB_W(0x754fde0c, 0x11edaed7), COMB_W(0x00c3d7dc, 0xcbb7ff03) }
+    },
+    { /* 57 */
+      { COMB_W(0x8ad0d727, 0xbd443fb3), COMB_W(0x329ea61c, 0x35cce30d), COMB_W(0x0060630c, 0x9940baee), COMB_W(0x2fdef94c, 0xa9d9d88d) },
+      { COMB_W(0x8313a383, 0x3ff0da65), COMB_W(0x661f34a9, 0x45f08b0c), COMB_W(0x20bc0190, 0x586556a4), COMB_W(0x324cb2f7, 0x47b6e8d5) }
+    },
+    { /* 58 */
+      { COMB_W(0x768c033c, 0x68afb374), COMB_W(0x932d050c, 0xbd085f23), COMB_W(0x46dc6e9f, 0x47e32d1a), COMB_W(0xff02eaeb, 0x3b721af5) },
+      { COMB_W(0x62206e1e, 0x7ca9987d), COMB_W(0xc46d6e3a, 0x7648c993), COMB_W(0x2617a59d, 0x4e474e07), COMB_W(0x4a736553, 0x8f042c77) }
+    },
+    { /* 59 */
+      { COMB_W(0x88d01a2a, 0xd110f0b6), COMB_W(0x446f9c1d, 0x3925d29d), COMB_W(0x642e357e, 0xb4836f05), COMB_W(0x515873e2, 0x44b7f766) },
+      { COMB_W(0x858a591f, 0x3d7c5a95), COMB_W(0x24b1bb99, 0xa81079f4), COMB_W(0x462fb2bf, 0x9de80b15), COMB_W(0xae98bc79, 0xe9ce942d) }
+    },
+    { /* 60 */
+      { COMB_W(0x821a4707, 0x96280f86), COMB_W(0x094fe652, 0x033a680a), COMB_W(0xfef642f3, 0xf6791c60), COMB_W(0x0e02a0c5, 0x30f16715) },
+      { COMB_W(0x8038e8be, 0x09941b73), COMB_W(0x705c7be1, 0xbb34f3c1), COMB_W(0x3bcd9342, 0xe36792e1), COMB_W(0x5db7cf76, 0x9cb4118f) }
+    },
+    { /* 61 */
+      { COMB_W(0x85de00e2, 0xb9384462), COMB_W(0x51a184ff, 0xd919460a), COMB_W(0x1e01746e, 0xc9792bb2), COMB_W(0x91bc069e, 0x3ee7ecce) },
+      { COMB_W(0x73f0b3ed, 0xa2ff67d1), COMB_W(0x6b75eae5, 0x753ec1b8), COMB_W(0x85ba813f, 0x6309c5f7), COMB_W(0x804d655c, 0xfde32dc8) }
+    },
+    { /* 62 */
+      { COMB_W(0x8c174321, 0x25621ac4), COMB_W(0x9dbf0463, 0x88a5c2f4), COMB_W(0x9255e62e, 0x65d92302), COMB_W(0x27445c1d, 0x38430ea8) },
+      { COMB_W(0xcfd74b31, 0xd1bcee31), COMB_W(0x154f20f9, 0xfde9a4cb), COMB_W(0xf0fb0f2a, 0x71b04e95), COMB_W(0xaf34fd3d, 0x8c51159f) }
+    },
+    { /* 63 */
+      { COMB_W(0xf6d116a5, 0xa83b71ad), COMB_W(0xc78dd6f7, 0xe6493465), COMB_W(0x05f23b10, 0xd04c94ea), COMB_W(0x3e9011da, 0xdba484af) },
+      { COMB_W(0xa146ad0f, 0xc017e2ff), COMB_W(0xfcb306ab, 0x1aba77cd), COMB_W(0x88361564, 0x47cdc158), COMB_W(0xc5742822, 0x000b3cf5) }
+    }
+  },
+  { /* block 3 */
+    { /* 1 */
+      { COMB_W(0x919b1597, 0xb43c7e8d), COMB_W(0x08533abe, 0xef2160f4), COMB_W(0x979280de, 0x26da6cde), COMB_W(0x92f9a6f9, 0x3fa37761) },
+      { COMB_W(0x77460555, 0x52bf1285), COMB_W(0x7309284e, 0xcea31289), COMB_W(0xed41d3a6, 0xf5e542df), COMB_W(0xbf618d71, 0x5147afe8) }
+    },
+    { /* 2 */
+      { COMB_W(0xf642e95b, 0x4f491155), COMB_W(0x28b1eb93, 0xfff3c118), COMB_W(0xfd236395, 0x85d56f8d), COMB_W(0x419a4f03, 0xae7617cc) },
+      { COMB_W(0x4b91ba6a, 0xd489bbc7), COMB_W(0xc7ab4a22, 0x074c6889), COMB_W(0x2e334b14, 0x84804545), COMB_W(0x237c2d34, 0x3a6e835b) }
+    },
+    { /* 3 */
+      { COMB_W(0x39320a4a, 0xb28b693e), COMB_W(0x94c8235a, 0x991fc0f7), COMB_W(0xb3914e02, 0xbfb34a7f), COMB_W(0x9583711d, 0x04394aa4) },
+      { COMB_W(0x9016f8a7, 0xe55c8159), COMB_W(0x8e269557, 0x9240f861), COMB_W(0x6f39dd6c, 0x4d3dde55), COMB_W(0x94172b41, 0x7f3342b9) }
+    },
+    { /* 4 */
+      { COMB_W(0xac24e643, 0x6e12e1df), COMB_W(0xd8a7fd0b, 0x7d761d04), COMB_W(0x4134bf13, 0xb346027c), COMB_W(0xd0e09196, 0x88e932b6) },
+      { COMB_W(0x6a6544db, 0x9fd28fbe), COMB_W(0x544cc4bd, 0x9846b8df), COMB_W(0xb4eb60b6, 0x91dbf867), COMB_W(0x069c9a59, 0xfe7d1452) }
+    },
+    { /* 5 */
+      { COMB_W(0x3974f861, 0x12af779f), COMB_W(0x69372b59, 0xbcdd8292), COMB_W(0x37555f21, 0x4d88b98b), COMB_W(0x48107929, 0x0f957cda) },
+      { COMB_W(0xd5f7e618, 0x7a0cdecc), COMB_W(0x3a1e898c, 0x84addf51), COMB_W(0x6f3af226, 0x8cfd5420), COMB_W(0x9e671bc5, 0xbcc2b682) }
+    },
+    { /* 6 */
+      { COMB_W(0x7a8402b9, 0xf044048a), COMB_W(0xe67be2cf, 0x4f9dc363), COMB_W(0x360e5f07, 0x7158a07f), COMB_W(0xb15a826c, 0xae320bf3) },
+      { COMB_W(0x24d18ef0, 0x61801f06), COMB_W(0x9f35503e, 0x96968e25), COMB_W(0xfa857ed5, 0x59bf8bc8), COMB_W(0x12da4395, 0x62879fc8) }
+    },
+    { /* 7 */
+      { COMB_W(0x0986ea43, 0x9403a2f3), COMB_W(0x3ceff307, 0x218e66f2), COMB_W(0x3fc25f05, 0xa866b9dc), COMB_W(0xd9ad9196, 0x1e24d87c) },
+      { COMB_W(0x6ae2a529, 0xf244b23f), COMB_W(0xaf9df3f6, 0x8ee6e707), COMB_W(0x5b012444, 0x493f792c), COMB_W(0xaef7c21c, 0x9357769c) }
+    },
+    { /* 8 */
+      { COMB_W(0x1617acdc, 0xdbc10ba4), COMB_W(0xbc7c0ed1, 0x7ff78b36), COMB_W(0x6a3efdd5, 0xad2652c1), COMB_W(0x948f395d, 0x3e845445) },
+      { COMB_W(0x1a6b40ca, 0x6da2be0f), COMB_W(0x5a63d297, 0xffd0987c), COMB_W(0x72a41300, 0xa1b5a9ef), COMB_W(0x98ba0006, 0xd11ae9b5) }
+    },
+    { /* 9 */
+      { COMB_W(0x0e09b322, 0xd3ea7c16), COMB_W(0x5f9859e8, 0x5570b53a), COMB_W(0x38f4efd4, 0x7c01d03b), COMB_W(0x991cdab9, 0x99124a0b) },
+      { COMB_W(0x7e6090db, 0xbf8ec086), COMB_W(0x1b3669fb, 0x1cb05868), COMB_W(0x33dc19fd, 0x6175b299), COMB_W(0x716c342c, 0x1368153f) }
+    },
+    { /* 10 */
+      { COMB_W(0x5098c464, 0xf238403a), COMB_W(0x65f691c7, 0xe537f159), COMB_W(0xcc10d587, 0x3b3f9f30), COMB_W(0xe8265b46, 0x7432124f) },
+      { COMB_W(0x2b31e705, 0x95b8be7f), COMB_W(0xf4b6d503, 0x67656469), COMB_W(0x4d9e3d6b, 0x137aeed1), COMB_W(0x6b33115f, 0x22918c10) }
+    },
+    { /* 11 */
+      { COMB_W(0xffe30b6a, 0x710795a8), COMB_W(0x800c8e97, 0xe55c9c49), COMB_W(0x49a891a0, 0x82928194), COMB_W(0x7a625e53, 0x3e74d835) },
+      { COMB_W(0xfceede2d, 0x3d1c71aa), COMB_W(0x66d81a46, 0x72ab5609), COMB_W(0x3ca59fcb, 0x9a9d00d9), COMB_W(0x2fd2468a, 0xebee56cb) }
+    },
+    { /* 12 */
+      { COMB_W(0xb21441da, 0xbbdbd58f), COMB_W(0x3093660e, 0x67719d65), COMB_W(0x90feaa6f, 0xb104faa1), COMB_W(0x57062f46, 0xe2b162b6) },
+      { COMB_W(0x4f122ed6, 0x999f3bef), COMB_W(0x0fb76570, 0x3c497834), COMB_W(0x1418e24e, 0x6528dbae), COMB_W(0x68be886b, 0x73fb9a92) }
+    },
+    { /* 13 */
+      { COMB_W(0x4e81f0af, 0x1a4cc384), COMB_W(0x1bb80a24, 0x09004055), COMB_W(0xd3b2687c, 0x7cdb8b97), COMB_W(0xacae1635, 0xcac5fee4) },
+      { COMB_W(0xc70abbcc, 0xf3836a66), COMB_W(0x72178930, 0xca9ba59a), COMB_W(0xf1716b44, 0x487e5e66), COMB_W(0x493b1d15, 0xd46875fb) }
+    },
+    { /* 14 */
+      { COMB_W(0x6e3336d1, 0x8cf62310), COMB_W(0xabad62b0, 0xecaf1294), COMB_W(0x5506acd1, 0x9101387f), COMB_W(0x07d1728a, 0x85fb2a0b) },
+      { COMB_W(0x8d7115e0, 0x7a9bfd81), COMB_W(0xea6a1e7f, 0x6f507a1f), COMB_W(0xc0b28bed, 0xeea19013), COMB_W(0x8b28a90c, 0x80574299) }
+    },
+    { /* 15 */
+      { COMB_W(0x20bdeb15, 0xa2a87ca7), COMB_W(0xd4f5c6f4, 0x78ff386e), COMB_W(0x66934e61, 0x1de53ee3), COMB_W(0xb044cf60, 0x207cbec0) },
+      { COMB_W(0x4226cd32, 0x1896cf1b), COMB_W(0xb56aeb70, 0xcdd19e66), COMB_W(0x6a737b6e, 0xd2b54ac7), COMB_W(0x13cfdb4d, 0xfb478432) }
+    },
+    { /* 16 */
+      { COMB_W(0x1e0cc372, 0xdd962abc), COMB_W(0x1ebb7d20, 0x8e87bdcc), COMB_W(0xcc7a3ec5, 0x8a642c87), COMB_W(0x0a5a4878, 0xf4cc4453) },
+      { COMB_W(0xe85daabc, 0x9e2cc3fa), COMB_W(0x5832a64c, 0x8e50a9fa), COMB_W(0x4d72b14d, 0xf2903017), COMB_W(0xf7148b22, 0x88b0dc57) }
+    },
+    { /* 17 */
+      { COMB_W(0x96196077, 0x254363c4), COMB_W(0x9e3ef7b7, 0x588b55bb), COMB_W(0x79c81407, 0x1870be94), COMB_W(0xf458a936, 0xc200b83b) },
+      { COMB_W(0x51de9560, 0x96037fbf), COMB_W(0x8d850b4c, 0x601b90b2), COMB_W(0x2c511fcd, 0x75cee1bb), COMB_W(0xc6e70b45, 0xf5ca4127) }
+    },
+    { /* 18 */
+      { COMB_W(0xde9954dc, 0x72d9158d), COMB_W(0xf48eae43, 0xa5969ff8), COMB_W(0xeaa160b1, 0x86d9c09a), COMB_W(0x743cc032, 0x1942d62f) },
+      { COMB_W(0x82fdcae3, 0x0587fb21), COMB_W(0x00e90b13, 0x3a406cd9), COMB_W(0x71764ecb, 0x63631be4), COMB_W(0x204f025d, 0x394a9f99) }
+    },
+    { /* 19 */
+      { COMB_W(0x2c4f44ab, 0x1f4f7039), COMB_W(0x8f7523fd, 0x6911cb42), COMB_W(0x734ea64a, 0xa93142cb), COMB_W(0xf3f4abc1, 0x38e25a5f) },
+      { COMB_W(0x09ada55f, 0x4d3a0e7d), COMB_W(0x1b48c0b2, 0x7ed85c46), COMB_W(0x9a653520, 0xbf0b8948), COMB_W(0xf0443b7b, 0xab529576) }
+    },
+    { /* 20 */
+      { COMB_W(0x4433966b, 0xeac12722), COMB_W(0x580f2ebb, 0xd3784dc7), COMB_W(0x9214b7e0, 0xda9fff53), COMB_W(0x77df2475, 0x09226ddf) },
+      { COMB_W(0xe98319ff, 0xe30b584a), COMB_W(0x2ef17d95, 0x697f71ed), COMB_W(0xb7cd8f1d, 0x107e2313), COMB_W(0x1f05bcf6, 0x4bbe3431) }
+    },
+    { /* 21 */
+      { COMB_W(0xf67c91cc, 0x2268bd6b), COMB_W(0xb4e37a48, 0x66fe9e6a), COMB_W(0x0d94adef, 0x77cc30e2), COMB_W(0x368e0cd9, 0x22ee355a) },
+      { COMB_W(0x1f0a9b3f, 0x80baae61), COMB_W(0x0e77da70, 0xdc1ae342), COMB_W(0x4338dafd, 0x7a5e3c66), COMB_W(0x5b0233a3, 0x3c76ab0c) }
+    },
+    { /* 22 */
+      { COMB_W(0x6154ea13, 0xaa8f53e9), COMB_W(0x78b37ef5, 0xe5225549), COMB_W(0x165f77b5, 0xff660a69), COMB_W(0xc99a7d97, 0x4c0beffd) },
+      { COMB_W(0x81befb78, 0x0e2f3dc2), COMB_W(0x07e70835, 0xcfc73913), COMB_W(0xd1e8f49f, 0xc5ef93fe), COMB_W(0xb75603ac, 0xf307738f) }
+    },
+    { /* 23 */
+      { COMB_W(0x3deaa642, 0x11cd11ac), COMB_W(0x497ee1c2, 0x622f88bc), COMB_W(0x3a7edb32, 0x41da0774), COMB_W(0x9c4f3b6e, 0x199d515d) },
+      { COMB_W(0xd1124267, 0x3d329026), COMB_W(0xa3d279aa, 0x4279e1fa), COMB_W(0xb79b9cfb, 0xa37447b3), COMB_W(0xba28062d, 0xd514dc88) }
+    },
+    { /* 24 */
+      { COMB_W(0xfab83212, 0x5385bd62), COMB_W(0x6ea0648c, 0x15245db7), COMB_W(0x65d70f9a, 0x2a9477fb), COMB_W(0x13d15fb8, 0xa31807ee) },
+      { COMB_W(0x74c3fa1b, 0xa0d8a442), COMB_W(0xd5f17e65, 0x2aef3bb8), COMB_W(0x89f84e2c, 0xc1b048c0), COMB_W(0xc7929d40, 0xd77bd793) }
+    },
+    { /* 25 */
+      { COMB_W(0x983a6035, 0xcf85a2a6), COMB_W(0x999122de, 0xc084ea30), COMB_W(0x93ffb0a5, 0x03489ff9), COMB_W(0xeada5f95, 0xf5d44b4f) },
+      { COMB_W(0xf81112af, 0x58a5542d), COMB_W(0xe5d01524, 0xdd1ef4a2), COMB_W(0x482e5dce, 0x7d0f841c), COMB_W(0x749e6dbe, 0xe250e112) }
+    },
+    { /* 26 */
+      { COMB_W(0x16c2398d, 0x3f73d68f), COMB_W(0x3372e573, 0xca22830a), COMB_W(0xf63b6ead, 0xec08fa1f), COMB_W(0xfc3e1694, 0xe144d694) },
+      { COMB_W(0x1be3ad2a, 0x3efe015b), COMB_W(0x7ad1cae4, 0x982135da), COMB_W(0xf540497c, 0x0a7cd3ee), COMB_W(0x17323efc, 0x44302590) }
+    },
+    { /* 27 */
+      { COMB_W(0x45a0f274, 0x3899343c), COMB_W(0x483b0a34, 0x6ffbd469), COMB_W(0x9d1b91e6, 0x4f39ea14), COMB_W(0x3226580f, 0xcf0b040f) },
+      { COMB_W(0x73760553, 0x0496ce97), COMB_W(0xa6469cd5, 0x2f7aa272), COMB_W(0x8e90a606, 0xb28f819e), COMB_W(0x8b48bbc7, 0x50b7ce30) }
+    },
+    { /* 28 */
+      { COMB_W(0x63021ed8, 0xf4b845f6), COMB_W(0x63e6492a, 0x0bd0d5ef), COMB_W(0x6bdb6fd7, 0xfa31d896), COMB_W(0x0b975549, 0x6f088bdd) },
+      { COMB_W(0x74175ef1, 0x3fae7ec4), COMB_W(0xce45bd54, 0xf236af2f), COMB_W(0x23c4d5a3, 0xa9e6c86a), COMB_W(0x4d8c6b12, 0x9c5ded46) }
+    },
+    { /* 29 */
+      { COMB_W(0xec4ce968, 0xd87d1eff), COMB_W(0x68607371, 0x549445bb), COMB_W(0x09e49679, 0x3bce37c6), COMB_W(0x4bf1d965, 0xa23340a6) },
+      { COMB_W(0xe64f66e3, 0x1df21848), COMB_W(0xc6bc1d13, 0xfd0de49b), COMB_W(0x5ebb4545, 0x732bfcf7), COMB_W(0xf6d70dd5, 0x9c10e9e9) }
+    },
+    { /* 30 */
+      { COMB_W(0x16337a0a, 0x1688b944), COMB_W(0xd1288b74, 0xffdc7d49), COMB_W(0x1f748003, 0x760dff2d), COMB_W(0xc3c5308e, 0x0d942759) },
+      { COMB_W(0x95b223c8, 0x00cba9c0), COMB_W(0xf2aee6dd, 0x42ec1820), COMB_W(0xb1a9b9bc, 0x56120ec3), COMB_W(0xcf655c85, 0x688f1aa7) }
+    },
+    { /* 31 */
+      { COMB_W(0xe447ee58, 0x9a7701cc), COMB_W(0x522c7ac8, 0xd24880e6), COMB_W(0x9fdb46bf, 0x039d3037), COMB_W(0x89931b2b, 0x33cb754c) },
+      { COMB_W(0x9cf49fca, 0x012a350c), COMB_W(0xde2e540b, 0x8e4ba8dd), COMB_W(0xf796d770, 0xe4e9afac), COMB_W(0x823a27f2, 0x49c06f34) }
+    },
+    { /* 32 */
+      { COMB_W(0x58627e5e, 0x8b47e27b), COMB_W(0x3bf2d82d, 0x8d98b368), COMB_W(0xbe2df29f, 0x6cea3b79), COMB_W(0x6054b222, 0x5e75b6a4) },
+      { COMB_W(0x001829e7, 0x64ae4b62), COMB_W(0x1d789cf5, 0xafad1987), COMB_W(0xb0760cd1, 0xf574e0f8), COMB_W(0x6e7106f3, 0xb190d8ed) }
+    },
+    { /* 33 */
+      { COMB_W(0x91636224, 0x28328db0), COMB_W(0x2c346ced, 0xe3a96096), COMB_W(0xd72942ec, 0xec1e1e94), COMB_W(0x9a3cdca5, 0xbad71b37) },
+      { COMB_W(0x292dcfaf, 0xfc72ac8b), COMB_W(0x707b5547, 0x5778693c), COMB_W(0x14973799, 0x2ef03663), COMB_W(0x5d980718, 0xc6d96728) }
+    },
+    { /* 34 */
+      { COMB_W(0xd49df269, 0x344a41fa), COMB_W(0x030a666e, 0x0d5942b0), COMB_W(0x616c44c9, 0x42c1276e), COMB_W(0xbc63752e, 0x5910aadc) },
+      { COMB_W(0xe57f965a, 0x7bdeb6ab), COMB_W(0x4d54b0a3, 0xb0e5ecb8), COMB_W(0xbf8283e3, 0x2d7cd406), COMB_W(0x46f1f328, 0xb4fac2ec) }
+    },
+    { /* 35 */
+      { COMB_W(0x4e31e586, 0x80cf4f71), COMB_W(0x60faa8ec, 0xd4e6fa69), COMB_W(0x9c848d1d, 0x379db63a), COMB_W(0x56e520fb, 0x65b5d196) },
+      { COMB_W(0x0d98b605, 0x46d9a0d6), COMB_W(0x5ae24b1f, 0xfed597c5), COMB_W(0x9841cf60, 0xc37b1d89), COMB_W(0x4cd255a4, 0x52457fbe) }
+    },
+    { /* 36 */
+      { COMB_W(0x78e14c31, 0x5fd3732b), COMB_W(0xc0566869, 0x573d851f), COMB_W(0x61abaf07, 0x1f71c8c6), COMB_W(0x2cfcb787, 0x7dd04ef0) },
+      { COMB_W(0xf45c1627, 0x0836d4d5), COMB_W(0x550e26e0, 0x0fbde34d), COMB_W(0x7fbd8439, 0x97e5388a), COMB_W(0xf59abbaa, 0xd4bf68df) }
+    },
+    { /* 37 */
+      { COMB_W(0x8300a2d0, 0x49e52658), COMB_W(0x7e1bb1dc, 0xb31c917c), COMB_W(0x826ab0fa, 0x8b4820c9), COMB_W(0xb1015a05, 0x965fd7d4) },
+      { COMB_W(0xf05f8e89, 0x589906f8), COMB_W(0x5556ff8e, 0xf842c9d0), COMB_W(0x76294afc, 0x979909a2), COMB_W(0x0369c85c, 0xca1251df) }
+    },
+    { /* 38 */
+      { COMB_W(0xed15013a, 0xc26ee166), COMB_W(0x60259a14, 0xf8f85b3b), COMB_W(0x9ef905c2, 0x0ea3ac8c), COMB_W(0x38f7568b, 0xb3c86d64) },
+      { COMB_W(0x1130ba16, 0x0312ce0d), COMB_W(0xcb776dc5, 0x9034476c), COMB_W(0x679918eb, 0x1f319629), COMB_W(0xad5a8168, 0xd4b0646f) }
+    },
+    { /* 39 */
+      { COMB_W(0x256ffd98, 0x9fb6ec23), COMB_W(0x942c2c6a, 0x8f1be926), COMB_W(0x13f16852, 0xb822093d), COMB_W(0x3f97c0a2, 0x0f33b801) },
+      { COMB_W(0xa0bca744, 0x5604a1c5), COMB_W(0xf754d26c, 0xdd9f3cbf), COMB_W(0x831f6975, 0xdaaa011e), COMB_W(0x095b38f3, 0x1abfb228) }
+    },
+    { /* 40 */
+      { COMB_W(0xbba8910d, 0x9c9ee3ff), COMB_W(0xe8e46d34, 0xd61f70c2), COMB_W(0x9985de74, 0x267575b2), COMB_W(0x35993acb, 0x91361048) },
+      { COMB_W(0x488ddc2e, 0xa3fa43f6), COMB_W(0x8e9d7a0f, 0x77b564b6), COMB_W(0x6eccdfca, 0x2b15d198), COMB_W(0x2950803d, 0x4c2e8530) }
+    },
+    { /* 41 */
+      { COMB_W(0xa3db55da, 0xedb6ca4f), COMB_W(0x10abf5d6, 0x2d29e2af), COMB_W(0x7bb898f1, 0xde6ad319), COMB_W(0x9089c339, 0x1ea8b3f7) },
+      { COMB_W(0x1038b60f, 0x7e5c818f), COMB_W(0x86581960, 0x50eeacac), COMB_W(0x3108f9bf, 0xd5875eb8), COMB_W(0x5b8b5a3a, 0xe2133821) }
+    },
+    { /* 42 */
+      { COMB_W(0x0ec52056, 0xb802f887), COMB_W(0xbfa76f4d, 0x1e7287b7), COMB_W(0x0576e2ae, 0xa82c5b3e), COMB_W(0x47e0978b, 0xc0b3a7e8) },
+      { COMB_W(0xf26d93a4, 0xa14ab6d9), COMB_W(0x8b87c04e, 0x437c21d7), COMB_W(0x403e5328, 0xc53a4ffb), COMB_W(0x5eacdc07, 0x7364b646) }
+    },
+    { /* 43 */
+      { COMB_W(0x9ee08688, 0x10a0b602), COMB_W(0x2ba0e7ea, 0xbb3c4d84), COMB_W(0x6feca3b1, 0x7c241e15), COMB_W(0x434aa69d, 0x0a0a54d9) },
+      { COMB_W(0x42aed8b2, 0x32f1d6d5), COMB_W(0xdca8cec4, 0x805d8e48), COMB_W(0x5dbac484, 0xd96b2069), COMB_W(0xb9bbc693, 0x1ed6563a) }
+    },
+    { /* 44 */
+      { COMB_W(0x835b7ef6, 0xa1df3b7e), COMB_W(0x9dbf4617, 0x3a448699), COMB_W(0x0af307f9, 0x10c49252), COMB_W(0xb791a094, 0x27023544) },
+      { COMB_W(0x937251a9, 0xe1890381), COMB_W(0x4a832a96, 0xca6b1774), COMB_W(0x58fed20b, 0xae343a7b), COMB_W(0x8425862e, 0x3752f885) }
+    },
+    { /* 45 */
+      { COMB_W(0xacb71bfc, 0xde592dce), COMB_W(0x9f7eeee3, 0x3d086120), COMB_W(0xc90aa9cd, 0xf68a0989), COMB_W(0x2e696aa9, 0x6639715c) },
+      { COMB_W(0x24a2bf38, 0x9dafe2da), COMB_W(0x07b4d951, 0x7425749c), COMB_W(0xec518c76, 0xd32050fb), COMB_W(0x7e4cd8a4, 0x5f5aa509) }
+    },
+    { /* 46 */
+      { COMB_W(0xadb99c2c, 0xe20aa68e), COMB_W(0xd58990fa, 0xe83553e1), COMB_W(0x2e7d0119, 0xdf4df1cd), COMB_W(0x5c56434c, 0x2c5496a3) },
+      { COMB_W(0x81a46c3f, 0xe1d42d03), COMB_W(0xe6f00b94, 0x339f40b8), COMB_W(0x1e23bbdb, 0x4d13e7a2), COMB_W(0xa5e07021, 0x5326e4d6) }
+    },
+    { /* 47 */
+      { COMB_W(0xa9b4e47c, 0x6390d55e), COMB_W(0xd8f62cbe, 0x9b184709), COMB_W(0xa2c0e99e, 0x122ad162), COMB_W(0x221146d6, 0x9f82298b) },
+      { COMB_W(0xac8d8340, 0x00790663), COMB_W(0xddfe113a, 0x893260dc), COMB_W(0x3969c161, 0x70003990), COMB_W(0x3fd81100, 0xb1dc9790) }
+    },
+    { /* 48 */
+      { COMB_W(0xaa052f90, 0x69be2965), COMB_W(0x75383fae, 0xe766ec51), COMB_W(0xef54dcf8, 0x070bbfe5), COMB_W(0x40f9315a, 0x684a5708) },
+      { COMB_W(0x865a2630, 0x94d9953e), COMB_W(0x4cd82b74, 0x3ce3eb96), COMB_W(0x7a8c9ea4, 0x256e93f5), COMB_W(0xbcf1523e, 0xcd88e466) }
+    },
+    { /* 49 */
+      { COMB_W(0xcc7d8e99, 0x5ef8a61d), COMB_W(0x6f437dea, 0xfe6bfe0c), COMB_W(0xd473e0a2, 0xfa4ac6ee), COMB_W(0x80d4e540, 0xebd9f130) },
+      { COMB_W(0x5f98f206, 0xb5c325ab), COMB_W(0xe8dd440c, 0xdced18be), COMB_W(0xff3a0225, 0xacd2022b), COMB_W(0x1647a8ab, 0xaa003f6f) }
+    },
+    { /* 50 */
+      { COMB_W(0x9dd30224, 0x313834a6), COMB_W(0x379c4e5a, 0xb44f34c4), COMB_W(0x3203e67b, 0x8cca8405), COMB_W(0x91bb5645, 0x6ceeab40) },
+      { COMB_W(0xfab8ba59, 0x989a575e), COMB_W(0x439b3695, 0x8a2b6224), COMB_W(0xdf89a88f, 0xff4c2db5), COMB_W(0x709b04fc, 0x286112e8) }
+    },
+    { /* 51 */
+      { COMB_W(0x995997c2, 0x450fb698), COMB_W(0x9a43ab05, 0x7c2d843f), COMB_W(0xb8c62655, 0x1c606e21), COMB_W(0xe4a71138, 0x63aeb7bd) },
+      { COMB_W(0xa2d528c6, 0x89d0aca7), COMB_W(0xf10b0152, 0xfb2bade9), COMB_W(0x1fa05c76, 0x748efd64), COMB_W(0x19bdf305, 0xd24fd6b5) }
+    },
+    { /* 52 */
+      { COMB_W(0xa2f2af25, 0x79ac0bb4), COMB_W(0x463cfd61, 0xd2a57fff), COMB_W(0x96060837, 0xe16cd24a), COMB_W(0xa273c6ed, 0x81428d19) },
+      { COMB_W(0x36eb13ae, 0x2150e49c), COMB_W(0xb879fac9, 0x1f2e2ca2), COMB_W(0xadfff9ef, 0x5665ce44), COMB_W(0x99f3be7b, 0x8504f90d) }
+    },
+    { /* 53 */
+      { COMB_W(0x1630d56c, 0x0eec2839), COMB_W(0x007b0ce5, 0xf956ec63), COMB_W(0x8bdec419, 0x6049473d), COMB_W(0x6f8b1c18, 0x11ef77ec) },
+      { COMB_W(0xdea7f483, 0x3ba2e8c3), COMB_W(0xfe63d0e3, 0x1f3fe8eb), COMB_W(0x4da87c2d, 0x500e75f2), COMB_W(0xed4d7591, 0x7273fcac) }
+    },
+    { /* 54 */
+      { COMB_W(0xb1a7af54, 0xdb28f8ba), COMB_W(0x8975ab1d, 0x12cb9daf), COMB_W(0x73449cdd, 0xb918eeec), COMB_W(0xb01d5f02, 0xb6e212f2) },
+      { COMB_W(0x909920e5, 0x3b6345ac), COMB_W(0x5a115551, 0xbefce5c0), COMB_W(0xbbaa1116, 0x9c768b13), COMB_W(0x1fa85ff0, 0xae34925f) }
+    },
+    { /* 55 */
+      { COMB_W(0x71ba3255, 0xeae3d4b6), COMB_W(0xce2cc7ec, 0x50e88532), COMB_W(0xefcefc85, 0x989bb224), COMB_W(0xfc513460, 0xdd823a5b) },
+      { COMB_W(0x2d8b5bb9, 0x1abd3588), COMB_W(0xcf58c98b, 0x92a59050), COMB_W(0x8bf08f89, 0x07f2ec97), COMB_W(0x7133c332, 0x2bd3ecd4) }
+    },
+    { /* 56 */
+      { COMB_W(0xcfd170b6, 0x31bcc122), COMB_W(0xd277f621, 0x7cf49515), COMB_W(0x20c037c1, 0xd1c9507a), COMB_W(0x9c4bc627, 0x2ab782c9) },
+      { COMB_W(0xef797779, 0x98f4d4e7), COMB_W(0xab31e0dd, 0xd43a2556), COMB_W(0x539a9f72, 0x0bbed7f0), COMB_W(0x229ff16c, 0xa27a6830) }
+    },
+    { /* 57 */
+      { COMB_W(0x52db2c60, 0xab116992), COMB_W(0x6a31ee70, 0x33134d62), COMB_W(0x2d8a66e4, 0x298c6fa0), COMB_W(0x10544e6c, 0x98592f0b) },
+      { COMB_W(0x7de6dce8, 0x22ecb486), COMB_W(0xa513928e, 0x795ab6e8), COMB_W(0x6635b60b, 0x4a8cf82b), COMB_W(0xce62b154, 0x62836b18) }
+    },
+    { /* 58 */
+      { COMB_W(0xbefb9188, 0xf5512f7c), COMB_W(0x45a3bf7a, 0xa50c3760), COMB_W(0x50c59cac, 0x848d9ca3), COMB_W(0x74f4bbec, 0xcfd5c1ed) },
+      { COMB_W(0xb59ffcce, 0x52a65d3b), COMB_W(0x4e4c610c, 0x6b03e0cf), COMB_W(0x3504886d, 0xc43a4e24), COMB_W(0x2603f410, 0x7154e82c) }
+    },
+    { /* 59 */
+      { COMB_W(0xba224d7f, 0xd424a7cd), COMB_W(0xbb235f7e, 0xcf696096), COMB_W(0x5ae74e32, 0x04643fcc), COMB_W(0xff80cfd7, 0xccc3c3ba) },
+      { COMB_W(0x6530afd4, 0xeb9bd569), COMB_W(0x279c1b1f, 0xace48259), COMB_W(0x86c1283c, 0x4d680b4a), COMB_W(0xefd9688c, 0x980a60c1) }
+    },
+    { /* 60 */
+      { COMB_W(0xec020294, 0x73e7fb21), COMB_W(0x5c5e55b3, 0xf0906c24), COMB_W(0xd36dd60c, 0xd567d7cb), COMB_W(0x3d67061f, 0x2fe278cb) },
+      { COMB_W(0xa4a1c1bf, 0xb59f7446), COMB_W(0x434f4d29, 0x11f7c50d), COMB_W(0x31c771ae, 0xf2995953), COMB_W(0xbe0eabba, 0x228e12c0) }
+    },
+    { /* 61 */
+      { COMB_W(0x75220fea, 0x73403e9c), COMB_W(0x62b6db44, 0x4eaa0f15), COMB_W(0x8cc6f25e, 0xcc23d02d), COMB_W(0xc19a43dd, 0x58962a61) },
+      { COMB_W(0x3f6fcc0e, 0x92fb59a0), COMB_W(0xe4622757, 0xba903d7b), COMB_W(0xe04dd18b, 0x5ee3102c), COMB_W(0x854a22b7, 0x2b0791c9) }
+    },
+    { /* 62 */
+      { COMB_W(0x69a71776, 0xea1602df), COMB_W(0xca8958ce, 0x7c31ba95), COMB_W(0xf9c72e65, 0x068691fb), COMB_W(0x943e33f6, 0x60a0cded) },
+      { COMB_W(0x6dc709ce, 0x0595fbe6), COMB_W(0xccb0185d, 0x6364ac19), COMB_W(0x2dabac53, 0xc337f7ff), COMB_W(0x9e7f6405, 0xd56533ff) }
+    },
+    { /* 63 */
+      { COMB_W(0x5cacb681, 0x6f2f9891), COMB_W(0x5ef016a0, 0xc35eef36), COMB_W(0xd1065656, 0xafb4b5f6), COMB_W(0x6f7fc3b6, 0x51b4b77d) },
+      { COMB_W(0xdc618b76, 0x059ece36), COMB_W(0xfd0c418d, 0x9f3fca40), COMB_W(0xa80fc89d, 0xc6ec0754), COMB_W(0x960997d1, 0x3304edfd) }
+    }
+  }
+};
+
+#undef COMB_W
+#undef COMB_ROM
+
+#endif /* __SECP256R1_COMB_H__ */
@@ -20,6 +20,7 @@
 //#include <stdlib.h>
 //#include <memory.h>
 #include "sha256.h"
+#include "sha256_hw.h"
 
 /****************************** MACROS ******************************/
 #define ROTLEFT(a,b) (((a) << (b)) | ((a) >> (32-(b))))
@@ -33,7 +34,7 @@
 #define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
 
 /**************************** VARIABLES *****************************/
-static const WORD k[64] = {
+const WORD sha256_k[64] = {
 	0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
 	0xd807aa98,0x12835b01,0x243185be,0x550c7dc3,0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174,
 	0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc,0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da,
@@ -59,17 +60,35 @@ Sha256::Sha256() {
 }
 
 void Sha256::update(const BYTE data[], size_t len) {
-    WORD i;
+    size_t n;
+
+    // Top up a partly filled block first.
+    if (this->datalen > 0) {
+	n = 64 - this->datalen;
+	if (n > len)
+	    n = len;
+	memcpy(this->data + this->datalen, data, n);
+	this->datalen += n;
+	data += n;
+	len -= n;
+	if (this->datalen < 64)
+	    return;
+	this->transform();
+	this->bitlen += 512;
+	this->datalen = 0;
+    }
 
-    for (i = 0; i < len; ++i) {
-	this->data[this->datalen] = data[i];
-	this->datalen++;
-	if (this->datalen == 64) {
-	    this->transform();
-	    this->bitlen += 512;
-	    this->datalen = 0;
-	}
+    // Whole blocks are hashed straight from the caller's buffer.
+    n = len / 64;
+    if (n > 0) {
+	sha256_transform(this->state, data, n);
+	this->bitlen += (unsigned long long)n * 512;
+	data += n * 64;
+	len -= n * 64;
     }
+
+    memcpy(this->data, data, len);
+    this->datalen = len;
 }
 
 void Sha256::final(BYTE hash[]) {
@@ -78,17 +97,13 @@ void Sha256::final(BYTE hash[]) {
     i = this->datalen;
 
     // Pad whatever data is left in the buffer.
-    if (this->datalen < 56) {
-	this->data[i++] = 0x80;
-	while (i < 56) //@@@ optimize with memset
-	    this->data[i++] = 0x00;
-    } else {
-	this->data[i++] = 0x80;
-	while (i < 64) //@@@ optimize with memset
-	    this->data[i++] = 0x00;
+    this->data[i++] = 0x80;
+    if (i > 56) {
+	memset(this->data + i, 0, 64 - i);
 	this->transform();
-	memset(this->data, 0, 56);
+	i = 0;
     }
+    memset(this->data + i, 0, 56 - i);
 
     // Append to the padding the total message's length in bits and transform.
     this->bitlen += this->datalen * 8;
@@ -116,42 +131,69 @@ void Sha256::final(BYTE hash[]) {
     }
 }
 
+void Sha256::hash(const BYTE in[], size_t len, BYTE out[]) {
+    Sha256 sha;
+
+    sha.update(in, len);
+    sha.final(out);
+}
+
+void Sha256::exportMidstate(Sha256Midstate &midstate) const {
+    memcpy(midstate.state, this->state, sizeof(this->state));
+    midstate.bitlen = this->bitlen;
+    midstate.datalen = this->datalen;
+    memcpy(midstate.data, this->data, this->datalen);
+}
+
+void Sha256::importMidstate(const Sha256Midstate &midstate) {
+    memcpy(this->state, midstate.state, sizeof(this->state));
+    this->bitlen = midstate.bitlen;
+    this->datalen = midstate.datalen;
+    memcpy(this->data, midstate.data, midstate.datalen);
+}
+
 void Sha256::transform() {
+    sha256_transform(this->state, this->data, 1);
+}
+
+void sha256_transform_portable(WORD state[8], const BYTE data[], size_t blocks) {
     WORD a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
 
-    for (i = 0, j = 0; i < 16; ++i, j += 4)
-	m[i] = (this->data[j] << 24) | (this->data[j + 1] << 16) | (this->data[j + 2] << 8) | (this->data[j + 3]);
-    for ( ; i < 64; ++i)
-	m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
-
-    a = this->state[0];
-    b = this->state[1];
-    c = this->state[2];
-    d = this->state[3];
-    e = this->state[4];
-    f = this->state[5];
-    g = this->state[6];
-    h = this->state[7];
-
-    for (i = 0; i < 64; ++i) {
-	t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-	t2 = EP0(a) + MAJ(a,b,c);
-	h = g;
-	g = f;
-	f = e;
-	e = d + t1;
-	d = c;
-	c = b;
-	b = a;
-	a = t1 + t2;
-    }
+    for ( ; blocks > 0; --blocks, data += 64) {
+	for (i = 0, j = 0; i < 16; ++i, j += 4)
+	    m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
+	for ( ; i < 64; ++i)
+	    m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+
+	a = state[0];
+	b = state[1];
+	c = state[2];
+	d = state[3];
+	e = state[4];
+	f = state[5];
+	g = state[6];
+	h = state[7];
+
+	for (i = 0; i < 64; ++i) {
+	    t1 = h + EP1(e) + CH(e,f,g) + sha256_k[i] + m[i];
+	    t2 = EP0(a) + MAJ(a,b,c);
+	    h = g;
+	    g = f;
+	    f = e;
+	    e = d + t1;
+	    d = c;
+	    c = b;
+	    b = a;
+	    a = t1 + t2;
+	}
 
-    this->state[0] += a;
-    this->state[1] += b;
-    this->state[2] += c;
-    this->state[3] += d;
-    this->state[4] += e;
-    this->state[5] += f;
-    this->state[6] += g;
-    this->state[7] += h;
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+	state[4] += e;
+	state[5] += f;
+	state[6] += g;
+	state[7] += h;
+    }
 }
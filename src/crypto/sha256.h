@@ -16,16 +16,36 @@
 
 /****************************** MACROS ******************************/
 #define SHA256_BLOCK_SIZE 32            // SHA256 outputs a 32 byte digest
+#ifndef SHA256_DIGEST_LENGTH
+#define SHA256_DIGEST_LENGTH 32         // the same, under the name ecdsa.h uses
+#endif
 
 /**************************** DATA TYPES ****************************/
 typedef unsigned char BYTE;             // 8-bit byte
 typedef unsigned int  WORD;             // 32-bit word, change to "long" for 16-bit machines
 
+// Everything a Sha256 needs to resume: the chaining words, the bits they
+// cover and the bytes still waiting for a full block. It holds no pointer
+// and can be copied or stored as is.
+struct Sha256Midstate {
+	WORD state[8];
+	unsigned long long bitlen;
+	WORD datalen;
+	BYTE data[64];
+};
+
 class Sha256 {
     public:
 	Sha256();
 	void update(const BYTE data[], size_t len);
 	void final(BYTE hash[]);
+	// Hashes len bytes of in into out[SHA256_DIGEST_LENGTH] in one call.
+	static void hash(const BYTE in[], size_t len, BYTE out[]);
+	// Saves the state after the bytes hashed so far, e.g. a constant
+	// prefix, so that importMidstate() can resume from it once per message
+	// instead of hashing the prefix again.
+	void exportMidstate(Sha256Midstate &midstate) const;
+	void importMidstate(const Sha256Midstate &midstate);
     private:
 	BYTE data[64];
 	WORD datalen;
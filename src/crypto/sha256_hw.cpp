@@ -0,0 +1,289 @@
+/**
+ * \file
+ * SHA-256 block transform backends, see sha256_hw.h.
+ */
+
+#include "sha256_hw.h"
+#if defined(ESP32) || !defined(ARDUINO)
+#include <pthread.h>
+/* threads may hash together, the backend is picked under a once guard */
+#define SHA256_SELECT_ONCE
+#endif
+
+typedef void (*sha256_transform_fn)(WORD state[8], const BYTE data[], size_t blocks);
+
+#if defined(SHA256_HW_SHANI)
+/*---------------------------------------------------------------------------*/
+/*
+ * SHA-NI keeps the state as two vectors ABEF and CDGH. SHA256RNDS2 runs
+ * two rounds on the low half of its message operand, which already holds
+ * w + k. The 16 quads of rounds are spelled out, the compiler keeps the
+ * loop otherwise and the four message vectors go through memory.
+ */
+#include <immintrin.h>
+#include <cpuid.h>
+
+#define SHA_TARGET __attribute__((target("sha,sse4.1,ssse3")))
+
+/* w[4i..4i+3] */
+#define SHANI_LOAD(m, i)                                                    \
+  m = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * (i))), swap)
+
+/* m0 = w[4i..4i+3] from m0..m3 = w[4i-16..4i-1] */
+#define SHANI_SCHED(m0, m1, m2, m3)                                         \
+  m0 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(m0, m1),     \
+                                          _mm_alignr_epi8(m3, m2, 4)), m3)
+
+/* rounds 4i..4i+3 */
+#define SHANI_QUAD(m, i)                                                    \
+  t = _mm_add_epi32(m, _mm_loadu_si128((const __m128i *)&sha256_k[4 * (i)])); \
+  state1 = _mm_sha256rnds2_epu32(state1, state0, t);                        \
+  state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(t, 0x0e))
+
+static SHA_TARGET void
+sha256_transform_shani(WORD state[8], const BYTE data[], size_t blocks)
+{
+  const __m128i swap = _mm_set_epi64x(0x0c0d0e0f08090a0bll, 0x0405060700010203ll);
+  __m128i state0, state1, abef, cdgh, m0, m1, m2, m3, t;
+
+  /* DCBA, HGFE to ABEF, CDGH */
+  t = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xb1);
+  state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1b);
+  state0 = _mm_alignr_epi8(t, state1, 8);
+  state1 = _mm_blend_epi16(state1, t, 0xf0);
+
+  for( ; blocks > 0; blocks--, data += 64) {
+    abef = state0;
+    cdgh = state1;
+
+    SHANI_LOAD(m0, 0); SHANI_QUAD(m0, 0);
+    SHANI_LOAD(m1, 1); SHANI_QUAD(m1, 1);
+    SHANI_LOAD(m2, 2); SHANI_QUAD(m2, 2);
+    SHANI_LOAD(m3, 3); SHANI_QUAD(m3, 3);
+    SHANI_SCHED(m0, m1, m2, m3); SHANI_QUAD(m0, 4);
+    SHANI_SCHED(m1, m2, m3, m0); SHANI_QUAD(m1, 5);
+    SHANI_SCHED(m2, m3, m0, m1); SHANI_QUAD(m2, 6);
+    SHANI_SCHED(m3, m0, m1, m2); SHANI_QUAD(m3, 7);
+    SHANI_SCHED(m0, m1, m2, m3); SHANI_QUAD(m0, 8);
+    SHANI_SCHED(m1, m2, m3, m0); SHANI_QUAD(m1, 9);
+    SHANI_SCHED(m2, m3, m0, m1); SHANI_QUAD(m2, 10);
+    SHANI_SCHED(m3, m0, m1, m2); SHANI_QUAD(m3, 11);
+    SHANI_SCHED(m0, m1, m2, m3); SHANI_QUAD(m0, 12);
+    SHANI_SCHED(m1, m2, m3, m0); SHANI_QUAD(m1, 13);
+    SHANI_SCHED(m2, m3, m0, m1); SHANI_QUAD(m2, 14);
+    SHANI_SCHED(m3, m0, m1, m2); SHANI_QUAD(m3, 15);
+
+    state0 = _mm_add_epi32(state0, abef);
+    state1 = _mm_add_epi32(state1, cdgh);
+  }
+
+  /* ABEF, CDGH back to DCBA, HGFE */
+  t = _mm_shuffle_epi32(state0, 0x1b);
+  state1 = _mm_shuffle_epi32(state1, 0xb1);
+  _mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(t, state1, 0xf0));
+  _mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(state1, t, 8));
+}
+/*---------------------------------------------------------------------------*/
+static int
+cpu_has_sha(void)
+{
+  unsigned int eax, ebx, ecx, edx;
+
+  /* leaf 1: ECX bit 9 is SSSE3, bit 19 is SSE4.1 */
+  if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+     !(ecx & (1u << 9)) || !(ecx & (1u << 19))) {
+    return 0;
+  }
+  /* leaf 7: EBX bit 29 is SHA */
+  if(!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+    return 0;
+  }
+  return (ebx & (1u << 29)) != 0;
+}
+#endif /* SHA256_HW_SHANI */
+
+#if defined(SHA256_HW_ARMV8)
+/*---------------------------------------------------------------------------*/
+/*
+ * The ARMv8 instructions keep the state as ABCD and EFGH, SHA256H and
+ * SHA256H2 run four rounds on w + k and update one half each.
+ */
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#endif
+
+#if defined(__clang__)
+#define SHA_TARGET __attribute__((target("crypto")))
+#else
+#define SHA_TARGET __attribute__((target("+crypto")))
+#endif
+
+/* w[4i..4i+3] */
+#define ARMV8_LOAD(m, i)                                                    \
+  m = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16 * (i))))
+
+/* m0 = w[4i..4i+3] from m0..m3 = w[4i-16..4i-1] */
+#define ARMV8_SCHED(m0, m1, m2, m3)                                         \
+  m0 = vsha256su1q_u32(vsha256su0q_u32(m0, m1), m2, m3)
+
+/* rounds 4i..4i+3 */
+#define ARMV8_QUAD(m, i)                                                    \
+  t = vaddq_u32(m, vld1q_u32(&sha256_k[4 * (i)]));                          \
+  abcd = state0;                                                            \
+  state0 = vsha256hq_u32(state0, state1, t);                                \
+  state1 = vsha256h2q_u32(state1, abcd, t)
+
+static SHA_TARGET void
+sha256_transform_armv8(WORD state[8], const BYTE data[], size_t blocks)
+{
+  uint32x4_t state0, state1, abcd, abcd0, efgh0, m0, m1, m2, m3, t;
+
+  state0 = vld1q_u32(&state[0]);
+  state1 = vld1q_u32(&state[4]);
+
+  for( ; blocks > 0; blocks--, data += 64) {
+    abcd0 = state0;
+    efgh0 = state1;
+
+    ARMV8_LOAD(m0, 0); ARMV8_QUAD(m0, 0);
+    ARMV8_LOAD(m1, 1); ARMV8_QUAD(m1, 1);
+    ARMV8_LOAD(m2, 2); ARMV8_QUAD(m2, 2);
+    ARMV8_LOAD(m3, 3); ARMV8_QUAD(m3, 3);
+    ARMV8_SCHED(m0, m1, m2, m3); ARMV8_QUAD(m0, 4);
+    ARMV8_SCHED(m1, m2, m3, m0); ARMV8_QUAD(m1, 5);
+    ARMV8_SCHED(m2, m3, m0, m1); ARMV8_QUAD(m2, 6);
+    ARMV8_SCHED(m3, m0, m1, m2); ARMV8_QUAD(m3, 7);
+    ARMV8_SCHED(m0, m1, m2, m3); ARMV8_QUAD(m0, 8);
+    ARMV8_SCHED(m1, m2, m3, m0); ARMV8_QUAD(m1, 9);
+    ARMV8_SCHED(m2, m3, m0, m1); ARMV8_QUAD(m2, 10);
+    ARMV8_SCHED(m3, m0, m1, m2); ARMV8_QUAD(m3, 11);
+    ARMV8_SCHED(m0, m1, m2, m3); ARMV8_QUAD(m0, 12);
+    ARMV8_SCHED(m1, m2, m3, m0); ARMV8_QUAD(m1, 13);
+    ARMV8_SCHED(m2, m3, m0, m1); ARMV8_QUAD(m2, 14);
+    ARMV8_SCHED(m3, m0, m1, m2); ARMV8_QUAD(m3, 15);
+
+    state0 = vaddq_u32(state0, abcd0);
+    state1 = vaddq_u32(state1, efgh0);
+  }
+
+  vst1q_u32(&state[0], state0);
+  vst1q_u32(&state[4], state1);
+}
+/*---------------------------------------------------------------------------*/
+static int
+cpu_has_sha(void)
+{
+#if defined(__ARM_FEATURE_SHA2) || defined(__APPLE__)
+  return 1;
+#elif defined(__linux__) && defined(HWCAP_SHA2)
+  return (getauxval(AT_HWCAP) & HWCAP_SHA2) != 0;
+#else
+  return 0;
+#endif
+}
+#endif /* SHA256_HW_ARMV8 */
+
+#if defined(SHA256_HW_ESP32)
+/*---------------------------------------------------------------------------*/
+/*
+ * The peripheral is shared with mbedTLS, every call takes it, loads the
+ * state, hashes all the blocks in one DMA transfer and reads the state
+ * back. If the transfer fails the state is untouched and the portable loop
+ * runs instead. ESP-IDF keeps the digest state as the bytes of the digest,
+ * big endian, mbedTLS copies it straight to its output: the chaining words
+ * are byte swapped on the way in and on the way out.
+ */
+#include "sha/sha_dma.h"
+
+static void
+sha256_transform_esp32(WORD state[8], const BYTE data[], size_t blocks)
+{
+  uint32_t be[8];
+  int ret;
+  int i;
+
+  for(i = 0; i < 8; i++) {
+    be[i] = __builtin_bswap32(state[i]);
+  }
+
+  esp_sha_acquire_hardware();
+  esp_sha_write_digest_state(SHA2_256, be);
+  ret = esp_sha_dma(SHA2_256, data, blocks * 64, NULL, 0, false);
+  if(ret == 0) {
+    esp_sha_read_digest_state(SHA2_256, be);
+  }
+  esp_sha_release_hardware();
+  if(ret != 0) {
+    sha256_transform_portable(state, data, blocks);
+    return;
+  }
+
+  for(i = 0; i < 8; i++) {
+    state[i] = __builtin_bswap32(be[i]);
+  }
+}
+#endif /* SHA256_HW_ESP32 */
+/*---------------------------------------------------------------------------*/
+/*
+ * the selected backend, written by sha256_select only
+ */
+static sha256_transform_fn transform = NULL;
+static const char *backend_name = "portable";
+#ifdef SHA256_SELECT_ONCE
+static pthread_once_t select_once = PTHREAD_ONCE_INIT;
+#endif
+
+/*
+ * Picks the backend for the running CPU, run once on first use.
+ */
+static void
+sha256_select(void)
+{
+#if defined(SHA256_HW_SHANI)
+  if(cpu_has_sha()) {
+    backend_name = "sha-ni";
+    transform = sha256_transform_shani;
+    return;
+  }
+#elif defined(SHA256_HW_ARMV8)
+  if(cpu_has_sha()) {
+    backend_name = "armv8-ce";
+    transform = sha256_transform_armv8;
+    return;
+  }
+#elif defined(SHA256_HW_ESP32)
+  backend_name = "esp32-sha";
+  transform = sha256_transform_esp32;
+  return;
+#endif
+  backend_name = "portable";
+  transform = sha256_transform_portable;
+}
+/*---------------------------------------------------------------------------*/
+static inline void
+sha256_resolve(void)
+{
+#ifdef SHA256_SELECT_ONCE
+  pthread_once(&select_once, sha256_select);
+#else
+  if(transform == NULL) {
+    sha256_select();
+  }
+#endif
+}
+/*---------------------------------------------------------------------------*/
+void
+sha256_transform(WORD state[8], const BYTE data[], size_t blocks)
+{
+  sha256_resolve();
+  transform(state, data, blocks);
+}
+/*---------------------------------------------------------------------------*/
+const char *
+sha256_backend_name(void)
+{
+  sha256_resolve();
+  return backend_name;
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,69 @@
+/**
+ * \file
+ * SHA-256 block transform backends.
+ * Sha256 hands its 64-byte blocks to sha256_transform(), which resolves on
+ * first use to the best backend of the running CPU:
+ *  - x86-64 with the SHA extensions (SHA-NI): SHA256RNDS2, SHA256MSG1/2,
+ *  - ARM64 with the cryptographic extension: SHA256H/H2, SHA256SU0/1,
+ *  - ESP32 variants whose SHA peripheral can resume from a saved state
+ *    (S2, S3, C3 and later): the peripheral, through ESP-IDF, when the
+ *    build defines SHA256_HW_ESP32,
+ *  - otherwise the portable round loop of sha256.cpp.
+ * The first ESP32 cannot load a state into its SHA peripheral, a block
+ * transform cannot use it there and it keeps the portable loop.
+ *
+ * The ESP32 peripheral is opt-in until it has been checked on each chip:
+ * define SHA256_HW_ESP32 once examples/CryptoBenchmark.ino reports its
+ * known answers passing with it on the device. Define
+ * SHA256_NO_HW_TRANSFORM in the build to keep the portable loop
+ * everywhere.
+ */
+
+#ifndef SHA256_HW_H
+#define SHA256_HW_H
+
+#include "sha256.h"
+
+#if !defined(SHA256_NO_HW_TRANSFORM)
+#if defined(__x86_64__) && !defined(ARDUINO)
+#define SHA256_HW_SHANI
+#elif defined(__aarch64__) && !defined(ARDUINO)
+#define SHA256_HW_ARMV8
+#elif defined(ESP32) && defined(SHA256_HW_ESP32) && defined(__has_include)
+#if __has_include("soc/soc_caps.h")
+#include "soc/soc_caps.h"
+#endif
+#endif
+#endif /* SHA256_NO_HW_TRANSFORM */
+
+/* the opt-in only holds on a chip whose peripheral can resume */
+#if defined(SHA256_HW_ESP32) && (defined(SHA256_NO_HW_TRANSFORM) || !defined(ESP32) || \
+    !defined(SOC_SHA_SUPPORT_RESUME) || !defined(SOC_SHA_SUPPORT_DMA))
+#undef SHA256_HW_ESP32
+#endif
+
+/**
+ * Round constants, shared by the backends.
+ */
+extern const WORD sha256_k[64];
+
+/**
+ * \brief             Runs the compression function over blocks 64-byte
+ *                    blocks of data, state holds the eight chaining words
+ *                    in native order
+ */
+void sha256_transform(WORD state[8], const BYTE data[], size_t blocks);
+
+/**
+ * \brief             The portable compression function, same contract as
+ *                    sha256_transform()
+ */
+void sha256_transform_portable(WORD state[8], const BYTE data[], size_t blocks);
+
+/**
+ * \brief             Returns the name of the selected backend ("sha-ni",
+ *                    "armv8-ce", "esp32-sha" or "portable").
+ */
+const char *sha256_backend_name(void);
+
+#endif   // SHA256_HW_H
@@ -0,0 +1,422 @@
+/**
+ * \file
+ * Multi-buffer SHA-256, see sha256_x4.h.
+ */
+
+#include <stdint.h>
+
+#include "sha256_x4.h"
+#include "sha256_hw.h"
+#if defined(ESP32) || !defined(ARDUINO)
+#include <pthread.h>
+/* batch paths hash from several threads, the backend is picked under a once guard */
+#define SHA256_MB_SELECT_ONCE
+#endif
+
+#define MB_MAX_LANES 8
+
+/*
+ * A compression function over lanes messages: s[j * lanes + i] is word j
+ * of the state of lane i, w[j * lanes + i] word j of its block.
+ */
+typedef void (*sha256_mb_fn)(WORD *s, const WORD *w);
+
+#if defined(SHA256_MB_KERNELS)
+
+#define MB_EP0(a) (mb_ror(a, 2) ^ mb_ror(a, 13) ^ mb_ror(a, 22))
+#define MB_EP1(e) (mb_ror(e, 6) ^ mb_ror(e, 11) ^ mb_ror(e, 25))
+#define MB_SIG0(x) (mb_ror(x, 7) ^ mb_ror(x, 18) ^ mb_shr(x, 3))
+#define MB_SIG1(x) (mb_ror(x, 17) ^ mb_ror(x, 19) ^ mb_shr(x, 10))
+#define MB_CH(e, f, g) (mb_andnot(e, g) ^ (e & f))
+#define MB_MAJ(a, b, c) ((a & b) ^ (c & (a ^ b)))
+
+/*
+ * The rounds over a vector type V of LANES words. LOAD and SET read and
+ * broadcast words, mb_store, mb_ror, mb_shr and mb_andnot are overloaded
+ * for V and + ^ & are the compiler's vector operators. The 16 message
+ * words roll over w[].
+ */
+#define MB_COMPRESS(V, LANES, LOAD, SET)                                    \
+  V a, b, c, d, e, f, g, h, t1, t2, w[16];                                  \
+  int i;                                                                    \
+                                                                            \
+  a = LOAD(&s[0 * LANES]); b = LOAD(&s[1 * LANES]);                         \
+  c = LOAD(&s[2 * LANES]); d = LOAD(&s[3 * LANES]);                         \
+  e = LOAD(&s[4 * LANES]); f = LOAD(&s[5 * LANES]);                         \
+  g = LOAD(&s[6 * LANES]); h = LOAD(&s[7 * LANES]);                         \
+                                                                            \
+  for(i = 0; i < 64; i++) {                                                 \
+    if(i < 16) {                                                            \
+      w[i] = LOAD(&m[i * LANES]);                                           \
+    } else {                                                                \
+      w[i & 15] += MB_SIG1(w[(i - 2) & 15]) + w[(i - 7) & 15] +             \
+                   MB_SIG0(w[(i - 15) & 15]);                               \
+    }                                                                       \
+    t1 = h + MB_EP1(e) + MB_CH(e, f, g) + SET(sha256_k[i]) + w[i & 15];     \
+    t2 = MB_EP0(a) + MB_MAJ(a, b, c);                                       \
+    h = g; g = f; f = e; e = d + t1;                                        \
+    d = c; c = b; b = a; a = t1 + t2;                                       \
+  }                                                                         \
+                                                                            \
+  mb_store(&s[0 * LANES], a + LOAD(&s[0 * LANES]));                         \
+  mb_store(&s[1 * LANES], b + LOAD(&s[1 * LANES]));                         \
+  mb_store(&s[2 * LANES], c + LOAD(&s[2 * LANES]));                         \
+  mb_store(&s[3 * LANES], d + LOAD(&s[3 * LANES]));                         \
+  mb_store(&s[4 * LANES], e + LOAD(&s[4 * LANES]));                         \
+  mb_store(&s[5 * LANES], f + LOAD(&s[5 * LANES]));                         \
+  mb_store(&s[6 * LANES], g + LOAD(&s[6 * LANES]));                         \
+  mb_store(&s[7 * LANES], h + LOAD(&s[7 * LANES]))
+
+#if defined(__x86_64__)
+/*---------------------------------------------------------------------------*/
+/*
+ * SSE2 is part of x86-64, the 8-lane AVX2 function only runs once cpuid
+ * said so.
+ */
+#include <immintrin.h>
+#include <cpuid.h>
+
+#define MB4_TARGET
+#define MB8_TARGET __attribute__((target("avx2")))
+
+typedef uint32_t mb4_v __attribute__((vector_size(16)));
+typedef uint32_t mb8_v __attribute__((vector_size(32)));
+
+static inline mb4_v
+mb_load4(const WORD *p)
+{
+  return (mb4_v)_mm_loadu_si128((const __m128i *)p);
+}
+
+static inline void
+mb_store(WORD *p, mb4_v a)
+{
+  _mm_storeu_si128((__m128i *)p, (__m128i)a);
+}
+
+static inline mb4_v
+mb_set4(WORD c)
+{
+  return (mb4_v)_mm_set1_epi32((int)c);
+}
+
+static inline mb4_v
+mb_ror(mb4_v a, int n)
+{
+  return (mb4_v)_mm_or_si128(_mm_srli_epi32((__m128i)a, n),
+                             _mm_slli_epi32((__m128i)a, 32 - n));
+}
+
+static inline mb4_v
+mb_shr(mb4_v a, int n)
+{
+  return (mb4_v)_mm_srli_epi32((__m128i)a, n);
+}
+
+static inline mb4_v
+mb_andnot(mb4_v a, mb4_v b)
+{
+  return (mb4_v)_mm_andnot_si128((__m128i)a, (__m128i)b);
+}
+
+static inline MB8_TARGET mb8_v
+mb_load8(const WORD *p)
+{
+  return (mb8_v)_mm256_loadu_si256((const __m256i *)p);
+}
+
+static inline MB8_TARGET void
+mb_store(WORD *p, mb8_v a)
+{
+  _mm256_storeu_si256((__m256i *)p, (__m256i)a);
+}
+
+static inline MB8_TARGET mb8_v
+mb_set8(WORD c)
+{
+  return (mb8_v)_mm256_set1_epi32((int)c);
+}
+
+static inline MB8_TARGET mb8_v
+mb_ror(mb8_v a, int n)
+{
+  return (mb8_v)_mm256_or_si256(_mm256_srli_epi32((__m256i)a, n),
+                                _mm256_slli_epi32((__m256i)a, 32 - n));
+}
+
+static inline MB8_TARGET mb8_v
+mb_shr(mb8_v a, int n)
+{
+  return (mb8_v)_mm256_srli_epi32((__m256i)a, n);
+}
+
+static inline MB8_TARGET mb8_v
+mb_andnot(mb8_v a, mb8_v b)
+{
+  return (mb8_v)_mm256_andnot_si256((__m256i)a, (__m256i)b);
+}
+/*---------------------------------------------------------------------------*/
+static MB8_TARGET void
+sha256_compress_x8(WORD *s, const WORD *m)
+{
+  MB_COMPRESS(mb8_v, 8, mb_load8, mb_set8);
+}
+/*---------------------------------------------------------------------------*/
+static int
+cpu_has_avx2(void)
+{
+  unsigned int eax, ebx, ecx, edx, xcr0;
+
+  /* leaf 1: ECX bit 27 is OSXSAVE, bit 28 is AVX */
+  if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+     !(ecx & (1u << 27)) || !(ecx & (1u << 28))) {
+    return 0;
+  }
+  /* the OS saves the YMM registers */
+  __asm__ ("xgetbv" : "=a"(xcr0), "=d"(edx) : "c"(0));
+  if((xcr0 & 6) != 6) {
+    return 0;
+  }
+  /* leaf 7: EBX bit 5 is AVX2 */
+  if(!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+    return 0;
+  }
+  return (ebx & (1u << 5)) != 0;
+}
+#define MB4_NAME "sse2"
+
+#elif defined(__aarch64__)
+/*---------------------------------------------------------------------------*/
+#include <arm_neon.h>
+
+#define MB4_TARGET
+
+typedef uint32x4_t mb4_v;
+
+static inline mb4_v
+mb_load4(const WORD *p)
+{
+  return vld1q_u32(p);
+}
+
+static inline void
+mb_store(WORD *p, mb4_v a)
+{
+  vst1q_u32(p, a);
+}
+
+static inline mb4_v
+mb_set4(WORD c)
+{
+  return vdupq_n_u32(c);
+}
+
+#define mb_ror(a, n) vsriq_n_u32(vshlq_n_u32(a, 32 - (n)), a, n)
+#define mb_shr(a, n) vshrq_n_u32(a, n)
+
+static inline mb4_v
+mb_andnot(mb4_v a, mb4_v b)
+{
+  return vbicq_u32(b, a);
+}
+#define MB4_NAME "neon"
+#endif
+/*---------------------------------------------------------------------------*/
+static MB4_TARGET void
+sha256_compress_x4(WORD *s, const WORD *m)
+{
+  MB_COMPRESS(mb4_v, 4, mb_load4, mb_set4);
+}
+#endif /* SHA256_MB_KERNELS */
+/*---------------------------------------------------------------------------*/
+static const WORD sha256_iv[8] = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+  0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief             Hashes lanes messages with compress, lanes at most
+ *                    MB_MAX_LANES
+ *                    Every block of every lane is read as 16 big-endian
+ *                    words into the lane-interleaved w; the blocks past
+ *                    the whole ones come from a per-lane buffer with the
+ *                    padding, one or two blocks. A lane that is done keeps
+ *                    hashing its last block until the others are, its
+ *                    digest was taken when it got there.
+ */
+static void
+sha256_mb(const BYTE *const in[], const size_t len[], BYTE out[][SHA256_DIGEST_LENGTH],
+          int lanes, sha256_mb_fn compress)
+{
+  WORD s[8 * MB_MAX_LANES], w[16 * MB_MAX_LANES];
+  BYTE tail[MB_MAX_LANES][128];
+  size_t full[MB_MAX_LANES], blocks[MB_MAX_LANES], max = 0, n, k;
+  unsigned long long bits;
+  const BYTE *p;
+  int i, j;
+
+  for(i = 0; i < lanes; i++) {
+    full[i] = len[i] / 64;
+    n = len[i] % 64;
+    blocks[i] = full[i] + (n < 56 ? 1 : 2);
+    if(blocks[i] > max) {
+      max = blocks[i];
+    }
+
+    if(n > 0) {
+      memcpy(tail[i], in[i] + full[i] * 64, n);
+    }
+    tail[i][n] = 0x80;
+    k = (blocks[i] - full[i]) * 64;
+    memset(tail[i] + n + 1, 0, k - n - 9);
+    bits = (unsigned long long)len[i] * 8;
+    for(j = 1; j <= 8; j++) {
+      tail[i][k - j] = (BYTE)bits;
+      bits >>= 8;
+    }
+
+    for(j = 0; j < 8; j++) {
+      s[j * lanes + i] = sha256_iv[j];
+    }
+  }
+
+  for(k = 0; k < max; k++) {
+    for(i = 0; i < lanes; i++) {
+      n = k < blocks[i] ? k : blocks[i] - 1;
+      p = n < full[i] ? in[i] + n * 64 : tail[i] + (n - full[i]) * 64;
+      for(j = 0; j < 16; j++, p += 4) {
+        w[j * lanes + i] = ((WORD)p[0] << 24) | ((WORD)p[1] << 16) |
+                           ((WORD)p[2] << 8) | p[3];
+      }
+    }
+
+    compress(s, w);
+
+    for(i = 0; i < lanes; i++) {
+      if(k == blocks[i] - 1) {
+        for(j = 0; j < 8; j++) {
+          out[i][4 * j] = (BYTE)(s[j * lanes + i] >> 24);
+          out[i][4 * j + 1] = (BYTE)(s[j * lanes + i] >> 16);
+          out[i][4 * j + 2] = (BYTE)(s[j * lanes + i] >> 8);
+          out[i][4 * j + 3] = (BYTE)s[j * lanes + i];
+        }
+      }
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * the selected backend, written by sha256_mb_select only; NULL functions
+ * hash the messages one after the other
+ */
+static sha256_mb_fn mb_x4 = NULL;
+static sha256_mb_fn mb_x8 = NULL;
+static const char *mb_name = "serial";
+#ifdef SHA256_MB_SELECT_ONCE
+static pthread_once_t mb_once = PTHREAD_ONCE_INIT;
+#else
+static char mb_selected = 0;
+#endif
+
+/*
+ * Picks the backend for the running CPU, run once on first use.
+ */
+static void
+sha256_mb_select(void)
+{
+#if defined(SHA256_MB_KERNELS)
+  const char *single = sha256_backend_name();
+
+  if(strcmp(single, "sha-ni") != 0 && strcmp(single, "armv8-ce") != 0) {
+    mb_x4 = sha256_compress_x4;
+    mb_name = MB4_NAME;
+#if defined(__x86_64__)
+    if(cpu_has_avx2()) {
+      mb_x8 = sha256_compress_x8;
+      mb_name = "avx2";
+    }
+#endif
+  }
+#endif
+#ifndef SHA256_MB_SELECT_ONCE
+  mb_selected = 1;
+#endif
+}
+/*---------------------------------------------------------------------------*/
+static inline void
+sha256_mb_resolve(void)
+{
+#ifdef SHA256_MB_SELECT_ONCE
+  pthread_once(&mb_once, sha256_mb_select);
+#else
+  if(!mb_selected) {
+    sha256_mb_select();
+  }
+#endif
+}
+/*---------------------------------------------------------------------------*/
+void
+sha256_x4(const BYTE *const in[4], const size_t len[4], BYTE out[][SHA256_DIGEST_LENGTH])
+{
+  int i;
+
+  sha256_mb_resolve();
+  if(mb_x4 != NULL) {
+    sha256_mb(in, len, out, 4, mb_x4);
+    return;
+  }
+  for(i = 0; i < 4; i++) {
+    Sha256::hash(in[i], len[i], out[i]);
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+sha256_x8(const BYTE *const in[8], const size_t len[8], BYTE out[][SHA256_DIGEST_LENGTH])
+{
+  sha256_mb_resolve();
+  if(mb_x8 != NULL) {
+    sha256_mb(in, len, out, 8, mb_x8);
+    return;
+  }
+  sha256_x4(in, len, out);
+  sha256_x4(in + 4, len + 4, out + 4);
+}
+/*---------------------------------------------------------------------------*/
+const char *
+sha256_mb_backend_name(void)
+{
+  sha256_mb_resolve();
+  return mb_name;
+}
+/*---------------------------------------------------------------------------*/
+int
+sha256_mb_set_backend(const char *name)
+{
+  /* resolve first, the once guard would overwrite the choice later */
+  sha256_mb_resolve();
+
+  if(strcmp(name, "serial") == 0) {
+    mb_x4 = NULL;
+    mb_x8 = NULL;
+    mb_name = "serial";
+    return 1;
+  }
+#if defined(SHA256_MB_KERNELS)
+  if(strcmp(name, MB4_NAME) == 0) {
+    mb_x4 = sha256_compress_x4;
+    mb_x8 = NULL;
+    mb_name = MB4_NAME;
+    return 1;
+  }
+#if defined(__x86_64__)
+  if(strcmp(name, "avx2") == 0 && cpu_has_avx2()) {
+    mb_x4 = sha256_compress_x4;
+    mb_x8 = sha256_compress_x8;
+    mb_name = "avx2";
+    return 1;
+  }
+#endif
+#endif
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,58 @@
+/**
+ * \file
+ * Multi-buffer SHA-256: hashes 4 or 8 independent messages of any lengths
+ * at once, one message per vector lane. Each lane is padded on its own,
+ * a lane whose message is shorter keeps running until the longest one is
+ * done and its digest is taken after its last block.
+ *
+ * Backends, picked on first use:
+ *  - x86-64: SSE2 for 4 lanes, AVX2 (checked at run time) for 8,
+ *  - ARM64: NEON for 4 lanes, 8 lanes run as two groups of 4,
+ *  - otherwise, or with SHA256_NO_MB_KERNELS defined in the build: one
+ *    message after the other through Sha256.
+ * Where sha256_transform() has an instruction set backend (SHA-NI,
+ * ARMv8 CE), the messages also go one after the other through it: those
+ * instructions outrun the vector lanes, see tools/bench_sha.cpp.
+ *
+ * The digests are written as BYTE [][SHA256_DIGEST_LENGTH] arrays, one row
+ * per message.
+ */
+
+#ifndef SHA256_X4_H
+#define SHA256_X4_H
+
+#include "sha256.h"
+
+#if !defined(SHA256_NO_MB_KERNELS) && !defined(ARDUINO) && \
+    (defined(__x86_64__) || defined(__aarch64__))
+#define SHA256_MB_KERNELS
+#endif
+
+/**
+ * \brief             out[i] = SHA-256(in[i][0 .. len[i]-1]) for i < 4
+ */
+void sha256_x4(const BYTE *const in[4], const size_t len[4], BYTE out[][SHA256_DIGEST_LENGTH]);
+
+/**
+ * \brief             out[i] = SHA-256(in[i][0 .. len[i]-1]) for i < 8
+ */
+void sha256_x8(const BYTE *const in[8], const size_t len[8], BYTE out[][SHA256_DIGEST_LENGTH]);
+
+/**
+ * \brief             Returns the name of the selected backend ("avx2",
+ *                    "sse2", "neon", or "serial" when the messages are
+ *                    hashed one after the other).
+ */
+const char *sha256_mb_backend_name(void);
+
+/**
+ * \brief             Selects the backend named as sha256_mb_backend_name()
+ *                    names them, over the one picked on first use, so that
+ *                    tests reach the vector lanes on CPUs where they are
+ *                    not picked. Returns 1, or 0 and keeps the backend when
+ *                    the CPU cannot run the named one. Not to be called
+ *                    while other threads hash.
+ */
+int sha256_mb_set_backend(const char *name);
+
+#endif   // SHA256_X4_H
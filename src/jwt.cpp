@@ -13,88 +13,130 @@
  * limitations under the License.
  *****************************************************************************/
 
-#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "crypto/ecdsa.h"
 #include "crypto/nn.h"
 #include "crypto/sha256.h"
 #include "jwt.h"
 
-// base64_encode copied from https://github.com/ReneNyffenegger/cpp-base64
-static const String base64_chars =
-    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-    "abcdefghijklmnopqrstuvwxyz"
-    "0123456789+/";
-
-String base64_encode(const unsigned char *bytes_to_encode,
-                     unsigned int in_len) {
-  String ret;
-  int i = 0;
-  int j = 0;
-  unsigned char char_array_3[3];
-  unsigned char char_array_4[4];
-
-  while (in_len--) {
-    char_array_3[i++] = *(bytes_to_encode++);
-    if (i == 3) {
-      char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-      char_array_4[1] =
-          ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-      char_array_4[2] =
-          ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-      char_array_4[3] = char_array_3[2] & 0x3f;
-
-      for (i = 0; (i < 4); i++) {
-        ret += base64_chars[char_array_4[i]];
+// base64url (RFC 4648 section 5) without padding, written straight into a
+// caller's buffer. Bytes are taken three at a time; Flush() ends a run and
+// writes the last partial group. Output that does not fit is dropped and
+// leaves ok() false.
+class Base64UrlWriter {
+ public:
+  Base64UrlWriter(char *out, size_t cap)
+      : out_(out), cap_(cap), len_(0), group_(0), group_len_(0), ok_(true) {}
+
+  void Write(const unsigned char *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+      group_ = (group_ << 8) | data[i];
+      if (++group_len_ == 3) {
+        Put(kChars[(group_ >> 18) & 0x3f]);
+        Put(kChars[(group_ >> 12) & 0x3f]);
+        Put(kChars[(group_ >> 6) & 0x3f]);
+        Put(kChars[group_ & 0x3f]);
+        group_ = 0;
+        group_len_ = 0;
       }
-      i = 0;
     }
   }
 
-  if (i) {
-    for (j = i; j < 3; j++) {
-      char_array_3[j] = '\0';
-    }
+  void Write(const char *str) {
+    Write((const unsigned char *)str, strlen(str));
+  }
 
-    char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-    char_array_4[1] =
-        ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-    char_array_4[2] =
-        ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-    char_array_4[3] = char_array_3[2] & 0x3f;
+  // Writes x in decimal.
+  void WriteDecimal(long long int x) {
+    unsigned char digits[20];
+    unsigned long long int u = x < 0 ? 0ull - (unsigned long long int)x : x;
+    size_t n = sizeof(digits);
+
+    do {
+      digits[--n] = '0' + u % 10;
+      u /= 10;
+    } while (u != 0);
+    if (x < 0) {
+      digits[--n] = '-';
+    }
+    Write(digits + n, sizeof(digits) - n);
+  }
 
-    for (j = 0; (j < i + 1); j++) {
-      ret += base64_chars[char_array_4[j]];
+  void Flush() {
+    if (group_len_ == 1) {
+      Put(kChars[(group_ >> 2) & 0x3f]);
+      Put(kChars[(group_ << 4) & 0x3f]);
+    } else if (group_len_ == 2) {
+      Put(kChars[(group_ >> 10) & 0x3f]);
+      Put(kChars[(group_ >> 4) & 0x3f]);
+      Put(kChars[(group_ << 2) & 0x3f]);
     }
+    group_ = 0;
+    group_len_ = 0;
+  }
 
-    while ((i++ < 3)) {
-      ret += '=';
+  // Writes c as is, between the encoded parts.
+  void Put(char c) {
+    if (len_ < cap_) {
+      out_[len_++] = c;
+    } else {
+      ok_ = false;
     }
   }
 
-  return ret;
-}
+  size_t length() const { return len_; }
+  bool ok() const { return ok_; }
 
-String base64_encode(String str) {
-  return base64_encode((const unsigned char *)str.c_str(), str.length());
-}
+ private:
+  static const char kChars[];
 
-// Get's sha256 of str.
-String get_sha(const String& str) {
-  Sha256 sha256Instance;
+  char *out_;
+  size_t cap_;
+  size_t len_;
+  uint32_t group_;
+  int group_len_;
+  bool ok_;
+};
 
-  sha256Instance.update((const unsigned char *)str.c_str(), str.length());
+const char Base64UrlWriter::kChars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz"
+    "0123456789-_";
+
+size_t CreateJwtInto(char *out, size_t cap, const char *project_id,
+                     long long int time, ecdsa_sign_ctx_t *sign_ctx,
+                     int jwt_exp_secs) {
+  Base64UrlWriter writer(out, cap);
+
+  writer.Write("{\"alg\":\"ES256\",\"typ\":\"JWT\"}");
+  writer.Flush();
+  writer.Put('.');
+  writer.Write("{\"iat\":");
+  writer.WriteDecimal(time);
+  writer.Write(",\"exp\":");
+  writer.WriteDecimal(time + jwt_exp_secs);
+  writer.Write(",\"aud\":\"");
+  writer.Write(project_id);
+  writer.Write("\"}");
+  writer.Flush();
+  if (!writer.ok()) {
+    return 0;
+  }
 
+  // The signed part is hashed where it was written, in one update that
+  // takes whole blocks in place. Feeding Sha256 from the writer as it goes
+  // would hash the same bytes in many small updates, and they are still in
+  // cache here.
   unsigned char sha256[SHA256_DIGEST_LENGTH];
+  Sha256::hash((const unsigned char *)out, writer.length(), sha256);
 
-  sha256Instance.final(sha256);
-
-  return String((const char*)sha256);
-}
+  // Signing sha with ec key.
+  NN_DIGIT signature_r[NUMWORDS], signature_s[NUMWORDS];
+  ecdsa_sign_with_ctx(sha256, signature_r, signature_s, sign_ctx);
 
-// Get base64 signature string from the signature_r and signature_s ecdsa
-// signature.
-String MakeBase64Signature(NN_DIGIT *signature_r, NN_DIGIT *signature_s) {
   unsigned char signature[64];
   NN_Encode(signature, (NUMWORDS - 1) * NN_DIGIT_LEN, signature_r,
             (NN_UINT)(NUMWORDS - 1));
@@ -102,39 +144,38 @@ String MakeBase64Signature(NN_DIGIT *signature_r, NN_DIGIT *signature_s) {
             (NUMWORDS - 1) * NN_DIGIT_LEN, signature_s,
             (NN_UINT)(NUMWORDS - 1));
 
-  return base64_encode(signature, 64);
+  writer.Put('.');
+  writer.Write(signature, sizeof(signature));
+  writer.Flush();
+  writer.Put('\0');
+  if (!writer.ok()) {
+    return 0;
+  }
+  return writer.length() - 1;
 }
 
-// Convert an integer to a string.
-String int_to_string(long long int x) {
-  char buf[20];
-  snprintf(buf, 20, "%d", (int)x);
-  return String(buf);
+String CreateJwt(String project_id, long long int time,
+                 ecdsa_sign_ctx_t *sign_ctx, int lib_jwt_exp_secs) {
+  // Project ids have at most 30 characters, longer ones get a heap buffer.
+  char token[JWT_BUFFER_SIZE(30)];
+  size_t cap = JWT_BUFFER_SIZE(project_id.length());
+  char *out = cap <= sizeof(token) ? token : (char *)malloc(cap);
+  String jwt;
+
+  if (out != NULL && CreateJwtInto(out, cap, project_id.c_str(), time,
+                                   sign_ctx, lib_jwt_exp_secs) > 0) {
+    jwt = out;
+  }
+  if (out != token) {
+    free(out);
+  }
+  return jwt;
 }
 
 String CreateJwt(String project_id, long long int time, NN_DIGIT *priv_key, int lib_jwt_exp_secs) {
-  ecc_init();
-  // Making jwt token json
-  String header = "{\"alg\":\"ES256\",\"typ\":\"JWT\"}";
-  String payload = "{\"iat\":" + int_to_string(time) +
-                   ",\"exp\":" + int_to_string(time + lib_jwt_exp_secs) + ",\"aud\":\"" +
-                   project_id + "\"}";
-  String header_payload_base64 =
-      base64_encode(header) + "." + base64_encode(payload);
-
-  String sha256 = get_sha(header_payload_base64);
-
-  // Signing sha with ec key. Bellow is the ec private key.
-  point_t pub_key;
-  ecc_gen_pub_key(priv_key, &pub_key);
-
-  ecdsa_init(&pub_key);
-
-  NN_DIGIT signature_r[NUMWORDS], signature_s[NUMWORDS];
-  ecdsa_sign((uint8_t *)sha256.c_str(), signature_r, signature_s, priv_key);
-
-  return header_payload_base64 + "." +
-         MakeBase64Signature(signature_r, signature_s);
+  ecdsa_sign_ctx_t sign_ctx;
+  ecdsa_sign_ctx_init(&sign_ctx, priv_key);
+  return CreateJwt(project_id, time, &sign_ctx, lib_jwt_exp_secs);
 }
 
 String CreateJwt(String project_id, long long int time, NN_DIGIT *priv_key) {
@@ -18,8 +18,25 @@
 
 #include <Arduino.h>
 #include "crypto/nn.h"
+#include "crypto/ecdsa.h"
 
 String CreateJwt(String project_id, long long int time, NN_DIGIT* priv_key);
 String CreateJwt(String project_id, long long int time, NN_DIGIT* priv_key, int JWT_EXP_SECS);
+// Same as above with a signing context prepared once per private key by
+// ecdsa_sign_ctx_init, so minting a token only pays for the signature.
+String CreateJwt(String project_id, long long int time, ecdsa_sign_ctx_t* sign_ctx, int JWT_EXP_SECS);
+
+// Room a token for a project id of n characters takes in CreateJwtInto,
+// terminating NUL included: header, payload with two 20-character numbers
+// and signature, in base64url.
+#define JWT_BUFFER_SIZE(n) (125 + (4 * (64 + (n)) + 2) / 3)
+
+// Writes the token into out[cap] with a terminating NUL, without
+// allocating: header and payload are encoded into out as they are
+// produced, hashed there and signed with sign_ctx. Returns the length of
+// the token, or 0 if it does not fit in cap bytes.
+size_t CreateJwtInto(char* out, size_t cap, const char* project_id,
+                     long long int time, ecdsa_sign_ctx_t* sign_ctx,
+                     int JWT_EXP_SECS);
 
 #endif  // JWT_H_
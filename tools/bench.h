@@ -0,0 +1,93 @@
+/*
+ * Timing harness of the tools/bench_*.cpp programs, included by each of
+ * them: a monotonic clock, the cycle counter where the CPU has one the
+ * tools can read (x86-64: TSC), and best-of-RUNS timing of an expression.
+ * A tool defines RUNS before the include to take another count.
+ */
+
+#ifndef TOOLS_BENCH_H
+#define TOOLS_BENCH_H
+
+#include <stdio.h>
+#include <time.h>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#define HAVE_CYCLES 1
+#define cycles() __rdtsc()
+#else
+#define HAVE_CYCLES 0
+#define cycles() 0ull
+#endif
+
+#ifndef RUNS
+#define RUNS 7
+#endif
+
+/* keeps the compiler from merging or dropping the calls being timed */
+#define barrier() __asm__ __volatile__("" ::: "memory")
+
+/*
+ * Times n calls of expr, best of RUNS, into the doubles ns and cyc, per
+ * call
+ */
+#define TIME_BEST(n, expr, ns, cyc) do {                                    \
+    double run_t;                                                           \
+    unsigned long long run_c;                                               \
+    long run_i;                                                             \
+    int run;                                                                \
+    (ns) = (cyc) = 1e30;                                                    \
+    for(run = 0; run < RUNS; run++) {                                       \
+      run_t = now();                                                        \
+      run_c = cycles();                                                     \
+      for(run_i = 0; run_i < (n); run_i++) {                                \
+        expr;                                                               \
+        barrier();                                                          \
+      }                                                                     \
+      run_c = cycles() - run_c;                                             \
+      run_t = now() - run_t;                                                \
+      if(run_t * 1e9 / (n) < (ns)) {                                        \
+        (ns) = run_t * 1e9 / (n);                                           \
+      }                                                                     \
+      if((double)run_c / (n) < (cyc)) {                                     \
+        (cyc) = (double)run_c / (n);                                        \
+      }                                                                     \
+    }                                                                       \
+  } while(0)
+
+/*
+ * Times n calls of expr, best of RUNS, and reports them under label
+ */
+#define TIME(label, n, expr) do {                                           \
+    double time_ns, time_cyc;                                               \
+    TIME_BEST(n, expr, time_ns, time_cyc);                                  \
+    report(label, time_ns, time_cyc);                                       \
+  } while(0)
+
+/**
+ * \brief             Seconds on the monotonic clock
+ */
+static inline double
+now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/**
+ * \brief             Prints label with ns per call, and cycles per call
+ *                    where the CPU has a cycle counter
+ */
+static inline void
+report(const char *label, double ns, double cyc)
+{
+  if(HAVE_CYCLES) {
+    printf("%-22s %10.1f ns %10.0f cycles\n", label, ns, cyc);
+  } else {
+    printf("%-22s %10.1f ns\n", label, ns);
+  }
+}
+
+#endif /* TOOLS_BENCH_H */
@@ -0,0 +1,114 @@
+/*
+ * Per-primitive cost of the field arithmetic on one core of the host: the
+ * generic NN_* routines, which take the digit count at run time, against
+ * the fixed-width templates of nn_fixed.h that ecc.cpp uses, on 256-bit
+ * operands. Reports the best of several runs in ns per call, and cycles per
+ * call where the CPU has a cycle counter the tool can read (x86-64: TSC).
+ * The modular addition and subtraction cycle through pairs that overflow
+ * or borrow half of the time: the fixed versions select their result with
+ * masks, the generic ones branch, and a branch that always goes the same
+ * way would be predicted for free.
+ *
+ * Build from the repository root as tools/bench_field.cpp; add
+ * -DTHIRTYTWO_BIT_PROCESSOR for the 32-bit digits of the device:
+ *
+ *   g++ -O2 -Isrc -I<dir of Arduino.h> tools/bench_field.cpp src/crypto/[a-z]*.cpp \
+ *       -lpthread -o bench_field
+ *   ./bench_field [calls per run]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "crypto/ecc.h"
+#include "crypto/nn_fixed.h"
+
+#include "bench.h"
+
+#define PAIRS 256
+
+/*
+ * Reports the generic and the fixed-width timing of one primitive side by
+ * side
+ */
+static void
+report_pair(const char *label, double ns0, double cyc0, double ns1, double cyc1)
+{
+  if(HAVE_CYCLES) {
+    printf("%-8s %8.1f ns %7.0f cycles %8.1f ns %7.0f cycles   x%.2f\n",
+           label, ns0, cyc0, ns1, cyc1, ns0 / ns1);
+  } else {
+    printf("%-8s %8.1f ns %8.1f ns   x%.2f\n", label, ns0, ns1, ns0 / ns1);
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  long calls = argc > 1 ? atol(argv[1]) : 200000;
+  NN_DIGIT a[NUMWORDS], b[NUMWORDS], c[NUMWORDS], t[2 * NUMWORDS];
+  static NN_DIGIT bs[PAIRS][NUMWORDS], cs[PAIRS][NUMWORDS];
+  curve_params_t param;
+  NN_DIGIT *p;
+  double ns, cyc, ns0, cyc0;
+  int i, k;
+
+  ecc_init();
+  /* a copy, the NN_* functions take writable operands */
+  param = *ecc_get_param();
+  p = param.p;
+
+  /* operands below p, with carries on most digits */
+  for(i = 0; i < NUMWORDS; i++) {
+    b[i] = (NN_DIGIT)0x9e3779b97f4a7c15ull * (i + 1);
+    c[i] = (NN_DIGIT)0xc2b2ae3d27d4eb4full * (i + 3);
+  }
+  b[KEYDIGITS] = c[KEYDIGITS] = 0;
+  b[KEYDIGITS - 1] >>= 1;
+  c[KEYDIGITS - 1] >>= 1;
+
+  /* random below p: b + c >= p and b < c each on about half the pairs */
+  for(k = 0; k < PAIRS; k++) {
+    ecc_gen_private_key(bs[k]);
+    ecc_gen_private_key(cs[k]);
+  }
+
+  printf("%d-bit digits, %d digits    generic                    fixed\n",
+         (int)NN_DIGIT_BITS, KEYDIGITS);
+
+  TIME_BEST(calls, NN_Add(a, b, c, KEYDIGITS), ns, cyc);
+  ns0 = ns; cyc0 = cyc;
+  TIME_BEST(calls, NN_AddFixed<KEYDIGITS>(a, b, c), ns, cyc);
+  report_pair("add", ns0, cyc0, ns, cyc);
+
+  TIME_BEST(calls, NN_Sub(a, b, c, KEYDIGITS), ns, cyc);
+  ns0 = ns; cyc0 = cyc;
+  TIME_BEST(calls, NN_SubFixed<KEYDIGITS>(a, b, c), ns, cyc);
+  report_pair("sub", ns0, cyc0, ns, cyc);
+
+  TIME_BEST(calls, NN_Mult(t, b, c, KEYDIGITS), ns, cyc);
+  ns0 = ns; cyc0 = cyc;
+  TIME_BEST(calls, NN_MultFixed<KEYDIGITS>(t, b, c), ns, cyc);
+  report_pair("mult", ns0, cyc0, ns, cyc);
+
+  TIME_BEST(calls, NN_Sqr(t, b, KEYDIGITS), ns, cyc);
+  ns0 = ns; cyc0 = cyc;
+  TIME_BEST(calls, NN_SqrFixed<KEYDIGITS>(t, b), ns, cyc);
+  report_pair("sqr", ns0, cyc0, ns, cyc);
+
+  TIME_BEST(calls, NN_ModAdd(a, bs[run_i % PAIRS], cs[run_i % PAIRS], p, KEYDIGITS),
+            ns, cyc);
+  ns0 = ns; cyc0 = cyc;
+  TIME_BEST(calls, NN_ModAddFixed<KEYDIGITS>(a, bs[run_i % PAIRS], cs[run_i % PAIRS], p),
+            ns, cyc);
+  report_pair("modadd", ns0, cyc0, ns, cyc);
+
+  TIME_BEST(calls, NN_ModSub(a, bs[run_i % PAIRS], cs[run_i % PAIRS], p, KEYDIGITS),
+            ns, cyc);
+  ns0 = ns; cyc0 = cyc;
+  TIME_BEST(calls, NN_ModSubFixed<KEYDIGITS>(a, bs[run_i % PAIRS], cs[run_i % PAIRS], p),
+            ns, cyc);
+  report_pair("modsub", ns0, cyc0, ns, cyc);
+
+  return 0;
+}
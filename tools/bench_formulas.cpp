@@ -0,0 +1,88 @@
+/*
+ * Point formulas on one core of the host, per class of input: ecc_dbl_proj
+ * and ecc_add_proj on generic points, on Z = 1, on equal and opposite
+ * points and on the point at infinity, then ecdsa_sign_with_ctx and
+ * ecdsa_verify_with_ctx. The complete formulas run the same field
+ * operations for every class, the Jacobian ones range from a few cycles
+ * (the infinity shortcuts) to a full addition. On a shared or frequency
+ * scaled host, compare the classes over several runs. Reports the best of
+ * several runs in ns per call, and cycles per call where the CPU has a
+ * cycle counter the tool can read (x86-64: TSC).
+ *
+ * ECC_COMPLETE is fixed at build time. Build from the repository root as
+ * tools/bench_formulas.cpp, once as is (Jacobian) and once with the complete
+ * formulas to compare:
+ *
+ *   g++ -O2 -Isrc -I<dir of Arduino.h> tools/bench_formulas.cpp src/crypto/[a-z]*.cpp \
+ *       -lpthread -o bench_jacobian
+ *   g++ -O2 -DECC_COMPLETE=1 -Isrc -I<dir of Arduino.h> tools/bench_formulas.cpp \
+ *       src/crypto/[a-z]*.cpp -lpthread -o bench_complete
+ *   ./bench_jacobian [calls per run]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "crypto/ecc.h"
+#include "crypto/ecdsa.h"
+
+#include "bench.h"
+
+int
+main(int argc, char **argv)
+{
+  long calls = argc > 1 ? atol(argv[1]) : 20000;
+  curve_params_t param;
+  point_t P, Q, R, negP, inf;
+  NN_DIGIT zP[NUMWORDS], zQ[NUMWORDS], zR[NUMWORDS], one[NUMWORDS], zero[NUMWORDS];
+  NN_DIGIT d[NUMWORDS], r[NUMWORDS], s[NUMWORDS];
+  uint8_t digest[SHA256_DIGEST_LENGTH];
+  ecdsa_sign_ctx_t sign_ctx;
+  ecdsa_verify_ctx_t verify_ctx;
+  point_t pub;
+  int i;
+
+  ecc_init();
+  /* a copy, the NN_* functions take writable operands */
+  param = *ecc_get_param();
+  NN_AssignDigit(one, 1, NUMWORDS);
+  NN_AssignZero(zero, NUMWORDS);
+
+  /* P = 2G and Q = 4G with Z != 1, negP = -P */
+  ecc_dbl_proj(&P, zP, &param.G, one);
+  ecc_dbl_proj(&Q, zQ, &P, zP);
+  NN_Assign(negP.x, P.x, NUMWORDS);
+  NN_ModSub(negP.y, param.p, P.y, param.p, NUMWORDS);
+  /* (0:1:0) is the point at infinity for both, Jacobian only reads Z = 0 */
+  NN_AssignZero(inf.x, NUMWORDS);
+  NN_AssignDigit(inf.y, 1, NUMWORDS);
+
+  printf("formulas: %s, %d-bit digits\n",
+         ECC_COMPLETE ? "complete (homogeneous)" : "Jacobian", (int)NN_DIGIT_BITS);
+
+  TIME("dbl, Z != 1", calls, ecc_dbl_proj(&R, zR, &P, zP));
+  TIME("dbl, Z = 1", calls, ecc_dbl_proj(&R, zR, &param.G, one));
+  TIME("dbl, infinity", calls, ecc_dbl_proj(&R, zR, &inf, zero));
+  TIME("add, Z != 1", calls, ecc_add_proj(&R, zR, &P, zP, &Q, zQ));
+  TIME("add, Z2 = 1", calls, ecc_add_proj(&R, zR, &P, zP, &param.G, one));
+  TIME("add, P + P", calls, ecc_add_proj(&R, zR, &P, zP, &P, zP));
+  TIME("add, P - P", calls, ecc_add_proj(&R, zR, &P, zP, &negP, zP));
+  TIME("add, infinity + P", calls, ecc_add_proj(&R, zR, &inf, zero, &P, zP));
+
+  ecc_gen_private_key(d);
+  ecc_gen_pub_key(d, &pub);
+  ecdsa_sign_ctx_init(&sign_ctx, d);
+  ecdsa_verify_ctx_init(&verify_ctx, &pub);
+  for(i = 0; i < SHA256_DIGEST_LENGTH; i++) {
+    digest[i] = (uint8_t)(i * 31);
+  }
+  ecdsa_sign_with_ctx(digest, r, s, &sign_ctx);
+  if(ecdsa_verify_with_ctx(digest, r, s, &verify_ctx) != 1) {
+    printf("signature does not verify\n");
+    return 1;
+  }
+
+  TIME("sign", calls / 100 + 1, ecdsa_sign_with_ctx(digest, r, s, &sign_ctx));
+  TIME("verify", calls / 100 + 1, ecdsa_verify_with_ctx(digest, r, s, &verify_ctx));
+  return 0;
+}
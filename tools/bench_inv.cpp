@@ -0,0 +1,128 @@
+/*
+ * Modular inversion on one core of the host, per modulus: the extended
+ * Euclid of NN_ModInv, the Fermat addition chain of NN_ModInvOpt (the field
+ * prime p only) and the safegcd of NN_ModInvSafegcd (64-bit digits only),
+ * modulo p and modulo the group order r. Every result is checked with
+ * b * b^-1 = 1 first, then timed over 64 values in us and, where the CPU
+ * has a cycle counter the tool can read (x86-64: TSC), cycles per
+ * inversion, best of several runs.
+ *
+ * Build from the repository root as tools/bench_inv.cpp; add
+ * -DTHIRTYTWO_BIT_PROCESSOR for the routines the device has:
+ *
+ *   g++ -O2 -Isrc -I<dir of Arduino.h> tools/bench_inv.cpp src/crypto/[a-z]*.cpp \
+ *       -lpthread -o bench_inv
+ *   ./bench_inv [runs]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "crypto/ecc.h"
+
+#include "bench.h"
+
+#define VALUES 64
+
+typedef void (*inv_fn)(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *m);
+
+static NN_DIGIT values[VALUES][NUMWORDS];
+static curve_params_t param;
+
+static void
+inv_euclid(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *m)
+{
+  NN_ModInv(a, b, m, NUMWORDS);
+}
+
+static void
+inv_fermat(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *m)
+{
+  NN_ModInvOpt(a, b, m, param.omega, NUMWORDS);
+}
+
+#ifdef NN_HAVE_SAFEGCD
+static void
+inv_safegcd(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *m)
+{
+  NN_ModInvSafegcd(a, b, m, NUMWORDS);
+}
+#endif
+
+static void
+run(const char *label, inv_fn fn, NN_DIGIT *m, int runs)
+{
+  NN_DIGIT a[NUMWORDS], one[NUMWORDS], t[NUMWORDS];
+  double best = 1e30, best_cyc = 1e30, s;
+  unsigned long long c;
+  int i, r;
+
+  NN_AssignDigit(one, 1, NUMWORDS);
+  for(i = 0; i < VALUES; i++) {
+    fn(a, values[i], m);
+    NN_ModMult(t, a, values[i], m, NUMWORDS);
+    if(!NN_Equal(t, one, NUMWORDS)) {
+      printf("%s: wrong inverse of value %d\n", label, i);
+      exit(1);
+    }
+  }
+
+  for(r = 0; r < runs; r++) {
+    s = now();
+    c = cycles();
+    for(i = 0; i < VALUES; i++) {
+      fn(a, values[i], m);
+    }
+    c = cycles() - c;
+    s = now() - s;
+    if(s * 1e6 / VALUES < best) {
+      best = s * 1e6 / VALUES;
+    }
+    if((double)c / VALUES < best_cyc) {
+      best_cyc = (double)c / VALUES;
+    }
+  }
+
+  if(HAVE_CYCLES) {
+    printf("%-14s %8.2f us %9.0f cycles\n", label, best, best_cyc);
+  } else {
+    printf("%-14s %8.2f us\n", label, best);
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  int runs = argc > 1 ? atoi(argv[1]) : 20;
+  NN_DIGIT r[NUMWORDS];
+  int i;
+
+  ecc_init();
+  /* a copy, the NN_* functions take writable operands */
+  param = *ecc_get_param();
+  ecc_get_order(r);
+
+  /* below r < p, 1 and r - 1 included */
+  for(i = 0; i < VALUES; i++) {
+    ecc_gen_private_key(values[i]);
+  }
+  NN_AssignDigit(values[0], 1, NUMWORDS);
+  NN_AssignDigit(values[1], 1, NUMWORDS);
+  NN_Sub(values[1], r, values[1], NUMWORDS);
+
+  printf("%d-bit digits, field inversion: %d, order inversion: %d "
+         "(0 Euclid, 1 Fermat, 2 safegcd)\n",
+         (int)NN_DIGIT_BITS, ECC_FIELD_INV, ECC_ORDER_INV);
+  printf("mod p\n");
+  run("  euclid", inv_euclid, param.p, runs);
+  run("  fermat", inv_fermat, param.p, runs);
+#ifdef NN_HAVE_SAFEGCD
+  run("  safegcd", inv_safegcd, param.p, runs);
+#endif
+  printf("mod r\n");
+  run("  euclid", inv_euclid, r, runs);
+#ifdef NN_HAVE_SAFEGCD
+  run("  safegcd", inv_safegcd, r, runs);
+#endif
+  return 0;
+}
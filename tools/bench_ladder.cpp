@@ -0,0 +1,161 @@
+/*
+ * Cost spread of the scalar multiplications over the scalar, on one core
+ * of the host: the regular ladder of ecc_mul_regular and the regular comb
+ * of ecc_mul_base_regular against the variable time ecc_mul and
+ * ecc_win_mul_base, and ecc_secret_mul_base as the build sets it (the
+ * regular comb by default, ecc_win_mul_base with ECC_REGULAR=0). The
+ * scalars fall in four classes: random, small (below 256), r minus small,
+ * and sparse (every other digit zero). Each scalar takes the best of
+ * several interleaved runs, so noise spreads over all of them, and each
+ * class reports its minimum, median and maximum, in cycles where the CPU
+ * has a cycle counter the tool can read (x86-64: TSC), in ns otherwise.
+ * Both regular paths are first checked against ecc_mul on every scalar.
+ *
+ * Build from the repository root as tools/bench_ladder.cpp, with
+ * -DECC_REGULAR=0 for the variable-time comb on the signing paths:
+ *
+ *   g++ -O2 -Isrc -I<dir of Arduino.h> tools/bench_ladder.cpp src/crypto/[a-z]*.cpp \
+ *       -lpthread -o bench_ladder
+ *   ./bench_ladder [runs per scalar]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "crypto/ecc.h"
+
+#include "bench.h"
+
+/* cycles where the CPU has a counter, ns otherwise */
+#define stamp() (HAVE_CYCLES ? cycles() : (unsigned long long)(now() * 1e9))
+
+#define CLASSES 4
+#define PER_CLASS 50
+#define SCALARS (CLASSES * PER_CLASS)
+#define FUNCTIONS 5
+
+static const char *const class_names[CLASSES] = {
+  "random", "small", "r - small", "sparse"
+};
+static const char *const function_names[FUNCTIONS] = {
+  "ecc_mul_regular", "ecc_mul_base_regular", "ecc_mul", "ecc_win_mul_base",
+  "ecc_secret_mul_base"
+};
+
+static NN_DIGIT scalars[SCALARS][NUMWORDS];
+static unsigned long long best[FUNCTIONS][SCALARS];
+static curve_params_t param;
+
+static void
+multiply(int f, point_t *R, NN_DIGIT *n)
+{
+  switch(f) {
+  case 0:
+    ecc_mul_regular(R, &param.G, n);
+    break;
+  case 1:
+    ecc_mul_base_regular(R, n);
+    break;
+  case 2:
+    ecc_mul(R, &param.G, n);
+    break;
+  case 3:
+    ecc_win_mul_base(R, n);
+    break;
+  default:
+    ecc_secret_mul_base(R, n);
+    break;
+  }
+}
+
+static int
+compare(const void *a, const void *b)
+{
+  unsigned long long x = *(const unsigned long long *)a;
+  unsigned long long y = *(const unsigned long long *)b;
+
+  return x < y ? -1 : x > y;
+}
+
+int
+main(int argc, char **argv)
+{
+  int runs = argc > 1 ? atoi(argv[1]) : 15;
+  unsigned long long sorted[PER_CLASS], t;
+  point_t R, S;
+  int i, f, k, run;
+
+  ecc_init();
+  /* a copy, the NN_* functions take writable operands */
+  param = *ecc_get_param();
+  srand(18);
+
+  for(i = 0; i < SCALARS; i++) {
+    NN_DIGIT *n = scalars[i];
+
+    switch(i / PER_CLASS) {
+    case 0:
+      ecc_gen_private_key(n);
+      break;
+    case 1:
+      NN_AssignDigit(n, 1 + rand() % 255, NUMWORDS);
+      break;
+    case 2:
+      NN_AssignDigit(n, 1 + rand() % 255, NUMWORDS);
+      NN_Sub(n, param.r, n, NUMWORDS);
+      break;
+    default:
+      ecc_gen_private_key(n);
+      for(k = 0; k < KEYDIGITS; k += 2) {
+        n[k] = 0;
+      }
+      n[0] |= 1;
+      break;
+    }
+
+    ecc_mul_regular(&R, &param.G, n);
+    ecc_mul(&S, &param.G, n);
+    if(!NN_Equal(R.x, S.x, NUMWORDS) || !NN_Equal(R.y, S.y, NUMWORDS)) {
+      printf("ecc_mul_regular and ecc_mul differ on scalar %d\n", i);
+      return 1;
+    }
+    ecc_mul_base_regular(&R, n);
+    if(!NN_Equal(R.x, S.x, NUMWORDS) || !NN_Equal(R.y, S.y, NUMWORDS)) {
+      printf("ecc_mul_base_regular and ecc_mul differ on scalar %d\n", i);
+      return 1;
+    }
+  }
+
+  for(f = 0; f < FUNCTIONS; f++) {
+    for(i = 0; i < SCALARS; i++) {
+      best[f][i] = ~0ull;
+    }
+  }
+  for(run = 0; run < runs; run++) {
+    for(f = 0; f < FUNCTIONS; f++) {
+      for(i = 0; i < SCALARS; i++) {
+        t = stamp();
+        multiply(f, &R, scalars[i]);
+        t = stamp() - t;
+        if(t < best[f][i]) {
+          best[f][i] = t;
+        }
+      }
+    }
+  }
+
+  printf("ECC_REGULAR=%d, %d-bit digits, %s: min / median / max per class\n",
+         ECC_REGULAR, (int)NN_DIGIT_BITS, HAVE_CYCLES ? "cycles" : "ns");
+  for(f = 0; f < FUNCTIONS; f++) {
+    printf("%s\n", function_names[f]);
+    for(k = 0; k < CLASSES; k++) {
+      for(i = 0; i < PER_CLASS; i++) {
+        sorted[i] = best[f][k * PER_CLASS + i];
+      }
+      qsort(sorted, PER_CLASS, sizeof(sorted[0]), compare);
+      printf("  %-10s %9llu %9llu %9llu\n", class_names[k],
+             sorted[0], sorted[PER_CLASS / 2], sorted[PER_CLASS - 1]);
+    }
+  }
+  return 0;
+}
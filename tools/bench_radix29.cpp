@@ -0,0 +1,92 @@
+/*
+ * P-256 field products with 32-bit digits on one core of the host: the
+ * saturated Comba products of nn_fixed.h against the unsaturated 29-bit
+ * limb products of nn_radix29.cpp, then the whole NN_ModMultP256 and
+ * NN_ModSqrP256 of the build and a public key. Both products are first
+ * checked to agree on random operands. Reports the best of several runs
+ * in ns per call, and cycles per call where the CPU has a cycle counter
+ * the tool can read (x86-64: TSC). The host has a carry flag, so the gap
+ * on the Xtensa cores of the ESP32 is larger; examples/CryptoBenchmark.ino
+ * takes the device numbers.
+ *
+ * Build from the repository root as tools/bench_radix29.cpp, with 32-bit
+ * digits and NN_RADIX29 (add -Os for the flags of the Arduino cores):
+ *
+ *   g++ -O2 -DTHIRTYTWO_BIT_PROCESSOR -DNN_RADIX29 -Isrc -I<dir of Arduino.h> \
+ *       tools/bench_radix29.cpp src/crypto/[a-z]*.cpp -lpthread -o bench_radix29
+ *   ./bench_radix29 [calls per run]
+ *
+ * Without -DNN_RADIX29 only the saturated rows are timed, NN_ModMultP256
+ * then runs on them: build both ways to compare the whole operations.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "crypto/ecc.h"
+#include "crypto/nn_fixed.h"
+#include "crypto/nn_radix29.h"
+
+#include "bench.h"
+
+#ifndef THIRTYTWO_BIT_PROCESSOR
+#error "build with -DTHIRTYTWO_BIT_PROCESSOR, the radix-2^29 products take 32-bit digits"
+#endif
+
+int
+main(int argc, char **argv)
+{
+  long calls = argc > 1 ? atol(argv[1]) : 200000;
+  NN_DIGIT b[NUMWORDS], c[NUMWORDS], a[NUMWORDS], t[2 * KEYDIGITS];
+  point_t Q;
+#ifdef NN_RADIX29_KERNELS
+  NN_DIGIT u[2 * KEYDIGITS];
+  int i;
+#endif
+
+  ecc_init();
+  ecc_gen_private_key(b);
+  ecc_gen_private_key(c);
+
+#ifdef NN_RADIX29_KERNELS
+  for(i = 0; i < 10000; i++) {
+    ecc_gen_private_key(b);
+    ecc_gen_private_key(c);
+    /* operands up to 2^256 - 1 on the top digit */
+    if(i % 8 == 0) {
+      b[KEYDIGITS - 1] = c[KEYDIGITS - 1] = ~(NN_DIGIT)0;
+    }
+    NN_MultFixed<KEYDIGITS>(t, b, c);
+    NN_Radix29MultP256(u, b, c);
+    if(!NN_Equal(t, u, 2 * KEYDIGITS)) {
+      printf("mult differs on pair %d\n", i);
+      return 1;
+    }
+    NN_SqrFixed<KEYDIGITS>(t, b);
+    NN_Radix29SqrP256(u, b);
+    if(!NN_Equal(t, u, 2 * KEYDIGITS)) {
+      printf("sqr differs on pair %d\n", i);
+      return 1;
+    }
+  }
+  printf("field products: radix 2^29\n");
+#else
+  printf("field products: saturated (no -DNN_RADIX29)\n");
+#endif
+
+  /* operands and results escape, so barrier() keeps every call whole */
+  __asm__ __volatile__("" : : "r"(a), "r"(b), "r"(c), "r"(t) : "memory");
+
+  TIME("saturated mult", calls, NN_MultFixed<KEYDIGITS>(t, b, c));
+#ifdef NN_RADIX29_KERNELS
+  TIME("radix29 mult", calls, NN_Radix29MultP256(t, b, c));
+#endif
+  TIME("saturated sqr", calls, NN_SqrFixed<KEYDIGITS>(t, b));
+#ifdef NN_RADIX29_KERNELS
+  TIME("radix29 sqr", calls, NN_Radix29SqrP256(t, b));
+#endif
+  TIME("NN_ModMultP256", calls, NN_ModMultP256(a, b, c, NUMWORDS));
+  TIME("NN_ModSqrP256", calls, NN_ModSqrP256(a, b, NUMWORDS));
+  TIME("ecc_gen_pub_key", calls / 1000 + 1, ecc_gen_pub_key(b, &Q));
+  return 0;
+}
@@ -0,0 +1,210 @@
+/*
+ * SHA-256 throughput on one core of the host: the portable round loop
+ * against the backend sha256_transform() selected, on whole blocks and
+ * through the Sha256 class on JWT-sized messages, then 8 independent
+ * messages of 64 to 512 bytes through sha256_x8 on every multi-buffer
+ * backend the CPU runs, not only the one picked ("serial" hashes them one
+ * after the other). Each backend is first checked against Sha256 on
+ * messages of unequal lengths on both sides of the padding edges, the
+ * tool exits with 1 on a mismatch. Reports bytes per cycle where the CPU
+ * has a cycle counter the tool can read (x86-64: TSC), and MB/s
+ * everywhere.
+ *
+ * Build from the repository root as tools/bench_sha.cpp:
+ *
+ *   g++ -O2 -Isrc -I<dir of Arduino.h> tools/bench_sha.cpp src/crypto/[a-z]*.cpp \
+ *       -lpthread -o bench_sha
+ *   ./bench_sha [seconds per run]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crypto/sha256.h"
+#include "crypto/sha256_hw.h"
+#include "crypto/sha256_x4.h"
+
+#include "bench.h"
+
+#define BLOCKS 64
+/* a signed IoT Core JWT header and payload */
+#define MESSAGE 230
+
+static BYTE buf[BLOCKS * 64];
+
+/* every backend sha256_mb_set_backend() may take */
+static const char *const mb_backends[] = { "serial", "sse2", "neon", "avx2" };
+#define MB_BACKENDS (sizeof(mb_backends) / sizeof(mb_backends[0]))
+
+/*
+ * Prints the throughput of bytes hashed in seconds, and bytes per cycle
+ * where the CPU has a cycle counter
+ */
+static void
+report_rate(const char *label, double bytes, double seconds, unsigned long long c)
+{
+  if(HAVE_CYCLES) {
+    printf("%-22s %8.1f MB/s %7.3f bytes/cycle\n", label,
+           bytes / seconds / 1e6, bytes / c);
+  } else {
+    printf("%-22s %8.1f MB/s\n", label, bytes / seconds / 1e6);
+  }
+}
+
+static void
+run_transform(const char *label, void (*fn)(WORD *, const BYTE *, size_t),
+              double seconds)
+{
+  WORD state[8] = { 0 };
+  unsigned long long c;
+  double start, bytes = 0;
+
+  start = now();
+  c = cycles();
+  do {
+    fn(state, buf, BLOCKS);
+    bytes += sizeof(buf);
+  } while(now() - start < seconds);
+  c = cycles() - c;
+  report_rate(label, bytes, now() - start, c);
+}
+
+static void
+run_class(const char *label, double seconds)
+{
+  BYTE hash[SHA256_DIGEST_LENGTH];
+  unsigned long long c;
+  double start, bytes = 0;
+
+  start = now();
+  c = cycles();
+  do {
+    Sha256 sha;
+
+    sha.update(buf, MESSAGE);
+    sha.final(hash);
+    buf[0] ^= hash[0];
+    bytes += MESSAGE;
+  } while(now() - start < seconds);
+  c = cycles() - c;
+  report_rate(label, bytes, now() - start, c);
+}
+
+/*
+ * Checks sha256_x4 and sha256_x8 on the selected backend against Sha256,
+ * eight lengths per call, all different: a message of 55 bytes or less
+ * past its whole blocks pads into one block, 56 to 63 into two. Returns 0
+ * on the first mismatch.
+ */
+static int
+check_lanes(const char *name)
+{
+  static const size_t lens[] = {
+    0, 1, 55, 56, 57, 63, 64, 65, 119, 120, 127, 128, 183, 184
+  };
+  const size_t n = sizeof(lens) / sizeof(lens[0]);
+  const BYTE *in[8];
+  size_t len[8];
+  BYTE hash[8][SHA256_DIGEST_LENGTH], ref[SHA256_DIGEST_LENGTH];
+  size_t r, i;
+
+  for(r = 0; r < n; r++) {
+    for(i = 0; i < 8; i++) {
+      /* 3 is prime to n, the eight lengths differ */
+      len[i] = lens[(r + 3 * i) % n];
+      in[i] = buf + 7 * i;
+    }
+
+    sha256_x8(in, len, hash);
+    for(i = 0; i < 8; i++) {
+      Sha256::hash(in[i], len[i], ref);
+      if(memcmp(hash[i], ref, sizeof(ref)) != 0) {
+        printf("%s: sha256_x8 lane %u differs from Sha256 on %u bytes\n", name,
+               (unsigned)i, (unsigned)len[i]);
+        return 0;
+      }
+    }
+
+    sha256_x4(in, len, hash);
+    for(i = 0; i < 4; i++) {
+      Sha256::hash(in[i], len[i], ref);
+      if(memcmp(hash[i], ref, sizeof(ref)) != 0) {
+        printf("%s: sha256_x4 lane %u differs from Sha256 on %u bytes\n", name,
+               (unsigned)i, (unsigned)len[i]);
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/*
+ * Times 8 messages of size bytes through sha256_x8 on the selected
+ * backend, name
+ */
+static void
+run_lanes(size_t size, const char *name, double seconds)
+{
+  const BYTE *in[8];
+  size_t len[8];
+  BYTE hash[8][SHA256_DIGEST_LENGTH];
+  unsigned long long c;
+  double start, bytes = 0;
+  char label[32];
+  int i;
+
+  for(i = 0; i < 8; i++) {
+    in[i] = buf + i * size;
+    len[i] = size;
+  }
+
+  start = now();
+  c = cycles();
+  do {
+    sha256_x8(in, len, hash);
+    buf[0] ^= hash[7][0];
+    bytes += 8 * size;
+  } while(now() - start < seconds);
+  c = cycles() - c;
+  snprintf(label, sizeof(label), "%-6s x8 %3u bytes", name, (unsigned)size);
+  report_rate(label, bytes, now() - start, c);
+}
+
+int
+main(int argc, char **argv)
+{
+  double seconds = argc > 1 ? atof(argv[1]) : 1.0;
+  const char *picked;
+  size_t i, b;
+
+  for(i = 0; i < sizeof(buf); i++) {
+    buf[i] = (BYTE)(i * 131);
+  }
+
+  printf("backend: %s\n", sha256_backend_name());
+  run_transform("portable blocks", sha256_transform_portable, seconds);
+  run_transform("backend blocks", sha256_transform, seconds);
+  run_class("Sha256 230-byte msgs", seconds);
+
+  picked = sha256_mb_backend_name();
+  printf("multi-buffer: %s\n", picked);
+  for(b = 0; b < MB_BACKENDS; b++) {
+    if(!sha256_mb_set_backend(mb_backends[b])) {
+      continue;
+    }
+    if(!check_lanes(mb_backends[b])) {
+      return 1;
+    }
+    printf("%s: sha256_x4 and sha256_x8 match Sha256\n", mb_backends[b]);
+  }
+
+  for(i = 64; i <= 512; i *= 2) {
+    for(b = 0; b < MB_BACKENDS; b++) {
+      if(sha256_mb_set_backend(mb_backends[b])) {
+        run_lanes(i, mb_backends[b], seconds);
+      }
+    }
+  }
+  return 0;
+}
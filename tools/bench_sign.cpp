@@ -0,0 +1,69 @@
+/*
+ * Signing throughput on one core of the host: ecdsa_sign_with_ctx one
+ * signature at a time against ecdsa_sign_x4, in signatures per second.
+ *
+ * Build from the repository root with an Arduino.h on the include path that
+ * declares random(long, long) for prng.cpp, as for any host build:
+ *
+ *   g++ -O2 -Isrc -I<dir of Arduino.h> tools/bench_sign.cpp src/crypto/[a-z]*.cpp \
+ *       -lpthread -o bench_sign
+ *   ./bench_sign [seconds per run]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "crypto/ecc.h"
+#include "crypto/ecdsa.h"
+
+#include "bench.h"
+
+int
+main(int argc, char **argv)
+{
+  double seconds = argc > 1 ? atof(argv[1]) : 2.0;
+  uint8_t digest[4][SHA256_DIGEST_LENGTH];
+  NN_DIGIT r[4][NUMWORDS], s[4][NUMWORDS];
+  NN_DIGIT d[NUMWORDS];
+  ecdsa_sign_ctx_t ctx;
+  double start, single, x4;
+  unsigned long n;
+  int i, j;
+
+  ecc_init();
+  ecc_gen_private_key(d);
+  ecdsa_sign_ctx_init(&ctx, d);
+  for(i = 0; i < 4; i++) {
+    for(j = 0; j < SHA256_DIGEST_LENGTH; j++) {
+      digest[i][j] = (uint8_t)(i * 31 + j);
+    }
+  }
+
+#ifdef ECC_COMB_X4
+  printf("4-way kernels: %s\n", NN_X4Available() ? "yes" : "no, scalar fallback");
+#else
+  printf("4-way kernels: not built, scalar fallback\n");
+#endif
+
+  n = 0;
+  start = now();
+  do {
+    for(i = 0; i < 4; i++) {
+      ecdsa_sign_with_ctx(digest[i], r[i], s[i], &ctx);
+    }
+    n += 4;
+  } while(now() - start < seconds);
+  single = n / (now() - start);
+
+  n = 0;
+  start = now();
+  do {
+    ecdsa_sign_x4(digest, r, s, &ctx);
+    n += 4;
+  } while(now() - start < seconds);
+  x4 = n / (now() - start);
+
+  printf("ecdsa_sign_with_ctx %10.0f signatures/s\n", single);
+  printf("ecdsa_sign_x4       %10.0f signatures/s (x%.2f)\n", x4, x4 / single);
+  return 0;
+}
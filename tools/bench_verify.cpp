@@ -0,0 +1,129 @@
+/*
+ * Verification throughput on the host: ecdsa_verify_with_ctx one signature
+ * at a time against ecdsa_verify_batch over a run of signatures, in
+ * signatures per second. The signatures come in runs of 256, 16 and 1 under
+ * a key, rotating over 4 keys: the batch builds the table of a key once
+ * while it stays among its last ECDSA_BATCH_KEYS keys. Single and batch
+ * passes alternate and the best of several is kept, so that a change of
+ * clock speed weighs on both.
+ *
+ * The batch spreads its groups over ECDSA_BATCH_THREADS threads, fixed at
+ * build time. Build from the repository root, once as is and once per
+ * thread count to compare, and with -DTHIRTYTWO_BIT_PROCESSOR for the
+ * digits of the ESP32:
+ *
+ *   g++ -O2 -Isrc -I<dir of Arduino.h> tools/bench_verify.cpp src/crypto/[a-z]*.cpp \
+ *       -lpthread -o bench_verify
+ *   g++ -O2 -DECDSA_BATCH_THREADS=4 -Isrc -I<dir of Arduino.h> tools/bench_verify.cpp \
+ *       src/crypto/[a-z]*.cpp -lpthread -o bench_verify4
+ *   ./bench_verify [passes]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "crypto/ecc.h"
+#include "crypto/ecdsa.h"
+
+#include "bench.h"
+
+#define SIGS 256
+#define KEYS 4
+
+static uint8_t digest[SIGS][SHA256_DIGEST_LENGTH];
+static NN_DIGIT r[SIGS][NUMWORDS], s[SIGS][NUMWORDS];
+static point_t keys[SIGS];
+static uint8_t key_of[SIGS];
+static uint8_t results[SIGS];
+static point_t pub[KEYS];
+static ecdsa_verify_ctx_t ctx[KEYS];
+
+/*
+ * Signs all SIGS digests, signature i under key (i / run) % KEYS
+ */
+static void
+sign_all(NN_DIGIT d[][NUMWORDS], int run)
+{
+  int i;
+
+  for(i = 0; i < SIGS; i++) {
+    key_of[i] = (i / run) % KEYS;
+    ecdsa_sign(digest[i], r[i], s[i], d[key_of[i]]);
+    keys[i] = pub[key_of[i]];
+  }
+}
+
+/*
+ * One pass over the signatures with one prepared context per key, as a
+ * caller verifying a known key set would, in seconds
+ */
+static double
+run_single(void)
+{
+  double start;
+  int i;
+
+  start = now();
+  for(i = 0; i < SIGS; i++) {
+    if(ecdsa_verify_with_ctx(digest[i], r[i], s[i], &ctx[key_of[i]]) != 1) {
+      printf("signature %d does not verify\n", i);
+      exit(1);
+    }
+  }
+  return now() - start;
+}
+
+static double
+run_batch(void)
+{
+  double start;
+
+  start = now();
+  if(ecdsa_verify_batch(SIGS, digest, r, s, keys, results) != SIGS) {
+    printf("the batch does not verify\n");
+    exit(1);
+  }
+  return now() - start;
+}
+
+int
+main(int argc, char **argv)
+{
+  int passes = argc > 1 ? atoi(argv[1]) : 7;
+  NN_DIGIT d[KEYS][NUMWORDS];
+  double single, batch, t;
+  int i, j, run, pass;
+
+  ecc_init();
+  for(i = 0; i < KEYS; i++) {
+    ecc_gen_private_key(d[i]);
+    ecc_gen_pub_key(d[i], &pub[i]);
+    ecdsa_verify_ctx_init(&ctx[i], &pub[i]);
+  }
+  for(i = 0; i < SIGS; i++) {
+    for(j = 0; j < SHA256_DIGEST_LENGTH; j++) {
+      digest[i][j] = (uint8_t)(i * 31 + j);
+    }
+  }
+
+  printf("batch threads: %d, group size: %d, key tables: %d\n", ECDSA_BATCH_THREADS,
+         ECDSA_BATCH_SIZE, ECDSA_BATCH_KEYS);
+  for(run = SIGS; run >= 1; run /= 16) {
+    sign_all(d, run);
+    single = batch = 1e30;
+    for(pass = 0; pass < passes; pass++) {
+      t = run_single();
+      if(t < single) {
+        single = t;
+      }
+      t = run_batch();
+      if(t < batch) {
+        batch = t;
+      }
+    }
+    printf("%3d signatures per key\n", run);
+    printf("  ecdsa_verify_with_ctx %10.0f signatures/s\n", SIGS / single);
+    printf("  ecdsa_verify_batch    %10.0f signatures/s (x%.2f)\n", SIGS / batch, single / batch);
+  }
+  return 0;
+}
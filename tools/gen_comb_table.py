@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""Generates src/crypto/secp256r1_comb.h, the fixed-base comb table for the
+P-256 generator used by ecc_win_mul_base() when ECC_COMB is enabled.
+
+The scalar is split into TEETH * BLOCKS rows of SPACING bits,
+SPACING = ceil(256 / (TEETH * BLOCKS)). Entry m (1 <= m < 2^TEETH) of block b
+is the affine point
+
+    sum over t with bit t of m set: 2^(SPACING * (TEETH * b + t)) * G
+
+so a multiplication costs SPACING - 1 doublings and at most
+SPACING * BLOCKS mixed additions. The table holds
+BLOCKS * (2^TEETH - 1) points of 64 bytes.
+
+Usage: tools/gen_comb_table.py [--teeth T] [--blocks B] [-o FILE]
+The values must match ECC_COMB_TEETH / ECC_COMB_BLOCKS of the build.
+"""
+
+import argparse
+import os
+
+P = 0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff
+A = P - 3
+GX = 0x6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296
+GY = 0x4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5
+BITS = 256
+
+
+def add(p1, p2):
+    if p1 is None:
+        return p2
+    if p2 is None:
+        return p1
+    x1, y1 = p1
+    x2, y2 = p2
+    if x1 == x2:
+        if (y1 + y2) % P == 0:
+            return None
+        lam = (3 * x1 * x1 + A) * pow(2 * y1, P - 2, P) % P
+    else:
+        lam = (y2 - y1) * pow(x2 - x1, P - 2, P) % P
+    x3 = (lam * lam - x1 - x2) % P
+    return x3, (lam * (x1 - x3) - y1) % P
+
+
+def dbl_n(pt, n):
+    for _ in range(n):
+        pt = add(pt, pt)
+    return pt
+
+
+def coord(v):
+    """Little-endian COMB_W(hi, lo) 64-bit words of a coordinate."""
+    words = []
+    for i in range(BITS // 64):
+        w = (v >> (64 * i)) & ((1 << 64) - 1)
+        words.append("COMB_W(0x%08x, 0x%08x)" % (w >> 32, w & 0xffffffff))
+    return ", ".join(words)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("--teeth", type=int, default=6)
+    ap.add_argument("--blocks", type=int, default=4)
+    ap.add_argument("-o", "--output", default=os.path.join(
+        os.path.dirname(os.path.abspath(__file__)),
+        "..", "src", "crypto", "secp256r1_comb.h"))
+    args = ap.parse_args()
+
+    teeth, blocks = args.teeth, args.blocks
+    spacing = -(-BITS // (teeth * blocks))
+    entries = (1 << teeth) - 1
+
+    out = []
+    out.append("// Generated by tools/gen_comb_table.py --teeth %d --blocks %d, "
+               "do not edit." % (teeth, blocks))
+    out.append("/**")
+    out.append(" * \\file")
+    out.append(" * Fixed-base comb table for the P-256 generator, %d blocks of %d"
+               % (blocks, entries))
+    out.append(" * affine points (%d bytes). Included by ecc.cpp only."
+               % (blocks * entries * 64))
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef __SECP256R1_COMB_H__")
+    out.append("#define __SECP256R1_COMB_H__")
+    out.append("")
+    out.append("#define ECC_COMB_TABLE_TEETH %d" % teeth)
+    out.append("#define ECC_COMB_TABLE_BLOCKS %d" % blocks)
+    out.append("")
+    out.append("/* keep the table in flash where const data is not mapped there */")
+    out.append("#if defined(ESP8266)")
+    out.append("#include <pgmspace.h>")
+    out.append("#define COMB_ROM PROGMEM")
+    out.append("#else")
+    out.append("#define COMB_ROM")
+    out.append("#endif")
+    out.append("")
+    out.append("/* one 64-bit word of a coordinate, split into NN_DIGITs */")
+    out.append("#if defined(SIXTY_FOUR_BIT_PROCESSOR)")
+    out.append("#define COMB_W(hi, lo) (((NN_DIGIT)(hi) << 32) | (lo))")
+    out.append("#elif defined(THIRTYTWO_BIT_PROCESSOR)")
+    out.append("#define COMB_W(hi, lo) (lo), (hi)")
+    out.append("#elif defined(SIXTEEN_BIT_PROCESSOR)")
+    out.append("#define COMB_W(hi, lo) ((lo) & 0xffff), ((lo) >> 16), "
+               "((hi) & 0xffff), ((hi) >> 16)")
+    out.append("#else")
+    out.append("#define COMB_W(hi, lo) ((lo) & 0xff), (((lo) >> 8) & 0xff), "
+               "(((lo) >> 16) & 0xff), ((lo) >> 24), \\")
+    out.append("  ((hi) & 0xff), (((hi) >> 8) & 0xff), "
+               "(((hi) >> 16) & 0xff), ((hi) >> 24)")
+    out.append("#endif")
+    out.append("")
+    out.append("static const NN_DIGIT ecc_comb_table[ECC_COMB_TABLE_BLOCKS]"
+               "[(1 << ECC_COMB_TABLE_TEETH) - 1][2][KEYDIGITS] COMB_ROM = {")
+
+    G = (GX, GY)
+    for b in range(blocks):
+        teeth_pts = [dbl_n(G, spacing * (teeth * b + t)) for t in range(teeth)]
+        table = [None] * (entries + 1)
+        for m in range(1, entries + 1):
+            low = (m & -m).bit_length() - 1
+            table[m] = add(table[m & (m - 1)], teeth_pts[low])
+        out.append("  { /* block %d */" % b)
+        for m in range(1, entries + 1):
+            x, y = table[m]
+            out.append("    { /* %d */" % m)
+            out.append("      { %s }," % coord(x))
+            out.append("      { %s }" % coord(y))
+            out.append("    }%s" % ("," if m < entries else ""))
+        out.append("  }%s" % ("," if b < blocks - 1 else ""))
+    out.append("};")
+    out.append("")
+    out.append("#undef COMB_W")
+    out.append("#undef COMB_ROM")
+    out.append("")
+    out.append("#endif /* __SECP256R1_COMB_H__ */")
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
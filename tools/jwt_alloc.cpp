@@ -0,0 +1,89 @@
+/*
+ * Heap allocations and time per token on the host: CreateJwt, which hands
+ * back an Arduino String, against CreateJwtInto writing into a stack
+ * buffer. malloc, calloc and realloc are counted by replacing them over
+ * glibc's own (operator new goes through malloc), so this builds on glibc
+ * hosts only.
+ *
+ * Build from the repository root as tools/jwt_alloc.cpp, with an Arduino.h
+ * whose String lives on the heap:
+ *
+ *   g++ -O2 -Isrc -I<dir of Arduino.h> tools/jwt_alloc.cpp src/jwt.cpp \
+ *       src/crypto/[a-z]*.cpp -lpthread -o jwt_alloc
+ *   ./jwt_alloc [tokens per run]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "jwt.h"
+#include "crypto/ecc.h"
+
+#include "bench.h"
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t n, size_t size);
+extern "C" void *__libc_realloc(void *p, size_t size);
+
+static unsigned long allocations;
+
+extern "C" void *
+malloc(size_t size)
+{
+  allocations++;
+  return __libc_malloc(size);
+}
+
+extern "C" void *
+calloc(size_t n, size_t size)
+{
+  allocations++;
+  return __libc_calloc(n, size);
+}
+
+extern "C" void *
+realloc(void *p, size_t size)
+{
+  allocations++;
+  return __libc_realloc(p, size);
+}
+
+int
+main(int argc, char **argv)
+{
+  int tokens = argc > 1 ? atoi(argv[1]) : 1000;
+  const char *project = "my-iot-project-123456";
+  char token[JWT_BUFFER_SIZE(64)];
+  NN_DIGIT d[NUMWORDS];
+  ecdsa_sign_ctx_t ctx;
+  unsigned long before;
+  double start;
+  size_t len = 0;
+  int i;
+
+  ecc_init();
+  ecc_gen_private_key(d);
+  ecdsa_sign_ctx_init(&ctx, d);
+  /* the first token resolves the kernels and backends */
+  CreateJwtInto(token, sizeof(token), project, 1600000000LL, &ctx, 3600);
+
+  before = allocations;
+  start = now();
+  for(i = 0; i < tokens; i++) {
+    String jwt = CreateJwt(project, 1600000000LL + i, &ctx, 3600);
+    len += jwt.length();
+  }
+  printf("CreateJwt      %6.2f allocations/token %8.1f us/token\n",
+         (double)(allocations - before) / tokens, (now() - start) * 1e6 / tokens);
+
+  before = allocations;
+  start = now();
+  for(i = 0; i < tokens; i++) {
+    len += CreateJwtInto(token, sizeof(token), project, 1600000000LL + i, &ctx, 3600);
+  }
+  printf("CreateJwtInto  %6.2f allocations/token %8.1f us/token\n",
+         (double)(allocations - before) / tokens, (now() - start) * 1e6 / tokens);
+
+  printf("%s\n", token);
+  return len == 0;
+}
@@ -0,0 +1,270 @@
+/*
+ * Known-answer tests for the field products: NN_ModMultP256 and
+ * NN_ModSqrP256, then the generic NN_ModMultOpt and NN_ModSqrOpt modulo p,
+ * against fixed vectors (edge operands up to 2^256 - 1, then random ones)
+ * and against NN_Mult followed by the long division of NN_Mod on
+ * pseudo-random operands. NN_ModMultOpt and NN_ModSqrOpt are then checked
+ * the same way modulo q = 2^256 - 189, which the P-256 reduction would get
+ * wrong. Exits with 1 on the first mismatch.
+ *
+ * The P-256 reduction under test is the one nn.cpp picks for the build: the
+ * host kernels on 64-bit x86/ARM hosts, the fast reduction with 32-bit
+ * digits or -DNN_NO_HOST_KERNELS, none with -DSIXTEEN_BIT_PROCESSOR. Build
+ * from the repository root as tools/kat_reduction.cpp, once per path:
+ *
+ *   g++ -O2 -Isrc -I<dir of Arduino.h> tools/kat_reduction.cpp src/crypto/[a-z]*.cpp \
+ *       -lpthread -o kat_reduction
+ *   g++ -O2 -DTHIRTYTWO_BIT_PROCESSOR -Isrc -I<dir of Arduino.h> tools/kat_reduction.cpp \
+ *       src/crypto/[a-z]*.cpp -lpthread -o kat_reduction32
+ *   ./kat_reduction [random operand pairs]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crypto/ecc.h"
+#include "crypto/nn_host.h"
+
+/* b, c, b * c mod p, b^2 mod p, big endian */
+static const char *const vectors[][4] = {
+  { "0000000000000000000000000000000000000000000000000000000000000000",
+    "714682adf218f762760500e7c4baee47ab9f01dc2cad988e9e96f7509ea2a536",
+    "0000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000" },
+  { "0000000000000000000000000000000000000000000000000000000000000001",
+    "ffffffff00000001000000000000000000000000fffffffffffffffffffffffe",
+    "ffffffff00000001000000000000000000000000fffffffffffffffffffffffe",
+    "0000000000000000000000000000000000000000000000000000000000000001" },
+  { "ffffffff00000001000000000000000000000000fffffffffffffffffffffffe",
+    "ffffffff00000001000000000000000000000000fffffffffffffffffffffffe",
+    "0000000000000000000000000000000000000000000000000000000000000001",
+    "0000000000000000000000000000000000000000000000000000000000000001" },
+  { "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",
+    "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",
+    "00000002fffffffffffffffffffffffefffffffdffffffff0000000000000002",
+    "00000002fffffffffffffffffffffffefffffffdffffffff0000000000000002" },
+  { "ffffffff00000001000000000000000000000000ffffffffffffffffffffffff",
+    "0000000000000000000000000000000000000000000000000000000000000002",
+    "0000000000000000000000000000000000000000000000000000000000000000",
+    "0000000000000000000000000000000000000000000000000000000000000000" },
+  { "8000000000000000000000000000000000000000000000000000000000000000",
+    "0000000100000000000000000000000000000000000000000000000000000001",
+    "8000000180000001000000007fffffffffffffff7fffffff7fffffff80000000",
+    "c0000000800000003fffffffffffffffbfffffffbfffffffc000000000000000" },
+  { "0000000000000000000000000000000000000001000000000000000000000000",
+    "0000000000000000000000010000000000000000000000000000000000000000",
+    "00000000fffffffeffffffffffffffffffffffff000000000000000000000001",
+    "0000000000000001000000000000000000000000000000000000000000000000" },
+  { "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",
+    "ffffffff00000001000000000000000000000001000000000000000000000000",
+    "00000000fffffffeffffffffffffffffffffffff000000000000000000000000",
+    "00000002fffffffffffffffffffffffefffffffdffffffff0000000000000002" },
+  { "1777b3e59e120a4d288ea8708b011a076b581a55ef030a995e5f039779629c87",
+    "9ac21292348e8d2fab9460d968e43b9a35a75d8beae967653d748647cc03fc41",
+    "b424306ba741f5e75b4538a7c5e66914db9a34393f1c76faea1bbd0a77b12742",
+    "4bbc2e720ec3c157c3661510c53c0d782a938a01af265928db4c68618a0e60c7" },
+  { "f52c4154c06538fc43525d929ced53d9fa54e376ff344ac717f2a634e31d1f27",
+    "239936e4190b4d6e803857290b8802d4a2d15359e691350e80347685cce53920",
+    "fc35f0cfda1ffbc7dc6ceaa3de44a721a5c96367965ca997d3622e22b220f930",
+    "1d514251b347944758c717faff7fb43532eb6a1e240243dfaab0ad7c9160a4a5" },
+  { "59101dcd5054850633c994ce14919914710aeee6acf94a4b56ee1641cd977bea",
+    "f402d3a566c768ecc1a7affc8806fa55a561e851d54cbfbe982280cac06fa902",
+    "fac233d2de7339d661216b35beb56a6f1419321565a3cc41e11c5a9c2af34821",
+    "b19e7e559c89e32761dfca009ead3f26a36b6bccb535b1027411c9cd49849098" },
+  { "50c5428f11261728a36b0bfbb70bed8aaa44347240d05b0af3ed81eea891cfa3",
+    "8924cc096519ccb1eb7eb58599c85e76e44347677a944928e9bc977fd6aae41c",
+    "91033b98319cbefe45964d1067e844f8cbcd266852bec87321014b336bfe98ca",
+    "e69562fc80c72f8c5d0699371af52b277b4d2db0c02dedbc0b4b34f42a5f94c5" },
+};
+
+static void
+from_hex(NN_DIGIT *a, const char *hex)
+{
+  unsigned char b[KEY_BIT_LEN / 8];
+  unsigned int byte;
+  int i;
+
+  for(i = 0; i < KEY_BIT_LEN / 8; i++) {
+    sscanf(hex + 2 * i, "%2x", &byte);
+    b[i] = (unsigned char)byte;
+  }
+  NN_Decode(a, KEYDIGITS, b, sizeof(b));
+  a[KEYDIGITS] = 0;
+}
+
+static void
+print_hex(const char *label, NN_DIGIT *a)
+{
+  unsigned char b[KEY_BIT_LEN / 8];
+  size_t i;
+
+  NN_Encode(b, sizeof(b), a, KEYDIGITS);
+  printf("  %-8s ", label);
+  for(i = 0; i < sizeof(b); i++) {
+    printf("%02x", b[i]);
+  }
+  printf("\n");
+}
+
+static void
+check(const char *path, const char *what, int index, NN_DIGIT *got, NN_DIGIT *want)
+{
+  if(!NN_Equal(got, want, NUMWORDS)) {
+    printf("%s, %s %d: mismatch\n", path, what, index);
+    print_hex("got", got);
+    print_hex("expected", want);
+    exit(1);
+  }
+}
+
+/* xorshift64, the same operands on every run */
+static unsigned long long rng = 0x9e3779b97f4a7c15ull;
+
+static void
+random_operand(NN_DIGIT *a)
+{
+  unsigned char b[KEY_BIT_LEN / 8];
+  size_t i;
+
+  for(i = 0; i < sizeof(b); i++) {
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    b[i] = (unsigned char)(rng >> 24);
+  }
+  /* every eighth operand has its top word forced to all ones */
+  if((rng & 7) == 0) {
+    memset(b, 0xff, 4);
+  }
+  NN_Decode(a, KEYDIGITS, b, sizeof(b));
+  a[KEYDIGITS] = 0;
+}
+
+/* the products under test, modulo the d and omega of the run */
+typedef struct product {
+  const char *name;
+  void (*mult)(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_DIGIT *d, NN_DIGIT *omega);
+  void (*sqr)(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *d, NN_DIGIT *omega);
+} product_t;
+
+#ifdef NN_HAVE_P256_REDUCTION
+static void
+mult_p256(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_DIGIT *d, NN_DIGIT *omega)
+{
+  (void)d;
+  (void)omega;
+  NN_ModMultP256(a, b, c, NUMWORDS);
+}
+
+static void
+sqr_p256(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *d, NN_DIGIT *omega)
+{
+  (void)d;
+  (void)omega;
+  NN_ModSqrP256(a, b, NUMWORDS);
+}
+#endif
+
+static void
+mult_omega(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *c, NN_DIGIT *d, NN_DIGIT *omega)
+{
+  NN_ModMultOpt(a, b, c, d, omega, NUMWORDS);
+}
+
+static void
+sqr_omega(NN_DIGIT *a, NN_DIGIT *b, NN_DIGIT *d, NN_DIGIT *omega)
+{
+  NN_ModSqrOpt(a, b, d, omega, NUMWORDS);
+}
+
+/*
+ * Checks one product on pairs random pairs modulo d against NN_Mod
+ */
+static void
+check_random(const char *path, const product_t *pr, NN_DIGIT *d, NN_DIGIT *omega, long pairs)
+{
+  NN_DIGIT b[NUMWORDS], c[NUMWORDS], bc[NUMWORDS], bb[NUMWORDS];
+  NN_DIGIT a[NUMWORDS], t[2 * NUMWORDS];
+  long i;
+
+  for(i = 0; i < pairs; i++) {
+    random_operand(b);
+    random_operand(c);
+
+    NN_Mult(t, b, c, KEYDIGITS);
+    NN_Mod(bc, t, 2 * KEYDIGITS, d, NUMWORDS);
+    pr->mult(a, b, c, d, omega);
+    check(path, "mult random", i, a, bc);
+
+    NN_Sqr(t, b, KEYDIGITS);
+    NN_Mod(bb, t, 2 * KEYDIGITS, d, NUMWORDS);
+    pr->sqr(a, b, d, omega);
+    check(path, "sqr random", i, a, bb);
+  }
+  printf("%s: %ld random pairs passed\n", path, i);
+}
+
+int
+main(int argc, char **argv)
+{
+  long pairs = argc > 1 ? atol(argv[1]) : 100000;
+  static const product_t products[] = {
+#ifdef NN_HAVE_P256_REDUCTION
+    { "p256", mult_p256, sqr_p256 },
+#endif
+    { "omega", mult_omega, sqr_omega },
+  };
+  char path[64];
+  curve_params_t param;
+  NN_DIGIT b[NUMWORDS], c[NUMWORDS], bc[NUMWORDS], bb[NUMWORDS], a[NUMWORDS];
+  NN_DIGIT q[NUMWORDS], q_omega[NUMWORDS];
+  size_t k;
+  long i;
+
+  ecc_init();
+  /* a copy, the NN_* functions take writable operands */
+  param = *ecc_get_param();
+
+#if defined(NN_HOST_KERNELS)
+  printf("p256: host kernel %s\n", NN_HostKernelName());
+#elif defined(NN_HAVE_P256_REDUCTION)
+  printf("p256: fast reduction, %d-bit digits\n", (int)NN_DIGIT_BITS);
+#else
+  printf("p256: none, %d-bit digits\n", (int)NN_DIGIT_BITS);
+#endif
+
+  for(k = 0; k < sizeof(products) / sizeof(products[0]); k++) {
+    const product_t *pr = &products[k];
+
+    snprintf(path, sizeof(path), "%s mod p", pr->name);
+    for(i = 0; i < (long)(sizeof(vectors) / sizeof(vectors[0])); i++) {
+      from_hex(b, vectors[i][0]);
+      from_hex(c, vectors[i][1]);
+      from_hex(bc, vectors[i][2]);
+      from_hex(bb, vectors[i][3]);
+
+      pr->mult(a, b, c, param.p, param.omega);
+      check(path, "mult vector", i, a, bc);
+      pr->sqr(a, b, param.p, param.omega);
+      check(path, "sqr vector", i, a, bb);
+
+      /* in place */
+      NN_Assign(a, b, NUMWORDS);
+      pr->mult(a, a, c, param.p, param.omega);
+      check(path, "mult in place vector", i, a, bc);
+      NN_Assign(a, b, NUMWORDS);
+      pr->sqr(a, a, param.p, param.omega);
+      check(path, "sqr in place vector", i, a, bb);
+    }
+    printf("%s: %ld vectors passed\n", path, i);
+    check_random(path, pr, param.p, param.omega, pairs);
+  }
+
+  /* q = 2^256 - 189, the omega loop takes any d = 2^256 - omega */
+  NN_AssignDigit(q_omega, 189, NUMWORDS);
+  NN_AssignZero(q, NUMWORDS);
+  NN_Sub(q, q, q_omega, KEYDIGITS);
+  check_random("omega mod 2^256 - 189", &products[k - 1], q, q_omega, pairs);
+  return 0;
+}